@@ -0,0 +1,29 @@
+#include <iostream>
+
+#include "benchmark.h"
+// MPI
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
+int main(int argc, char** argv) {
+  try {
+#ifdef USE_MPI
+    // Initialise MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    int result = mpm_bench::run(argc, argv);
+
+#ifdef USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+  } catch (std::exception& exception) {
+    std::cerr << "Benchmark: " << exception.what() << std::endl;
+#ifdef USE_MPI
+    MPI_Abort(MPI_COMM_WORLD, 1);
+#endif
+  }
+}
@@ -0,0 +1,146 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "benchmark.h"
+#include "element.h"
+#include "factory.h"
+
+namespace {
+
+//! Number of particle locations evaluated per iteration
+const unsigned nlocations = 256;
+
+//! Particle locations spread over the unit cell
+template <unsigned Tdim>
+std::vector<Eigen::VectorXd> particle_locations() {
+  std::vector<Eigen::VectorXd> locations;
+  for (unsigned p = 0; p < nlocations; ++p) {
+    Eigen::VectorXd xi(Tdim);
+    for (unsigned i = 0; i < Tdim; ++i)
+      xi(i) = -0.99 + 1.98 * ((p * (2 * i + 3)) % nlocations) / nlocations;
+    locations.emplace_back(xi);
+  }
+  return locations;
+}
+
+//! Kernel evaluating shape functions and gradients of an element
+//! \param[in] type Element type
+//! \param[in] gradient Evaluate gradient of shape functions
+//! \retval kernel Benchmark kernel
+template <unsigned Tdim>
+mpm_bench::Kernel shapefn_kernel(const std::string& type, bool gradient) {
+  auto element = std::make_shared<std::shared_ptr<mpm::Element<Tdim>>>();
+  const auto locations = particle_locations<Tdim>();
+
+  return [=](unsigned long long niterations) {
+    // Elements are created on first use, after the factory is populated
+    if (!(*element))
+      (*element) = Factory<mpm::Element<Tdim>>::instance()->create(type);
+
+    const Eigen::Matrix<double, Tdim, 1> zero =
+        Eigen::Matrix<double, Tdim, 1>::Zero();
+    // Particle size in natural coordinates (2 particles per direction)
+    const Eigen::Matrix<double, Tdim, 1> size =
+        Eigen::Matrix<double, Tdim, 1>::Constant(1.);
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      for (const auto& location : locations) {
+        const Eigen::Matrix<double, Tdim, 1> xi = location;
+        if (gradient) {
+          const Eigen::MatrixXd grad_sf =
+              (*element)->grad_shapefn(xi, size, zero);
+          mpm_bench::do_not_optimize(grad_sf.data()[0]);
+        } else {
+          const Eigen::VectorXd sf = (*element)->shapefn(xi, size, zero);
+          mpm_bench::do_not_optimize(sf.data()[0]);
+        }
+      }
+    }
+  };
+}
+
+//! Kernel evaluating shape functions and gradients of an element in place
+//! \param[in] type Element type
+//! \retval kernel Benchmark kernel
+template <unsigned Tdim>
+mpm_bench::Kernel shapefn_grad_shapefn_kernel(const std::string& type) {
+  auto element = std::make_shared<std::shared_ptr<mpm::Element<Tdim>>>();
+  const auto locations = particle_locations<Tdim>();
+
+  return [=](unsigned long long niterations) {
+    // Elements are created on first use, after the factory is populated
+    if (!(*element))
+      (*element) = Factory<mpm::Element<Tdim>>::instance()->create(type);
+
+    const Eigen::Matrix<double, Tdim, 1> zero =
+        Eigen::Matrix<double, Tdim, 1>::Zero();
+    const Eigen::Matrix<double, Tdim, 1> size =
+        Eigen::Matrix<double, Tdim, 1>::Constant(1.);
+    // Storage reused across evaluations, as in a particle
+    Eigen::VectorXd sf;
+    Eigen::MatrixXd grad_sf;
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      for (const auto& location : locations) {
+        const Eigen::Matrix<double, Tdim, 1> xi = location;
+        (*element)->shapefn_grad_shapefn(xi, size, zero, &sf, &grad_sf);
+        mpm_bench::do_not_optimize(grad_sf.data()[0]);
+      }
+    }
+  };
+}
+
+// 2D
+mpm_bench::Register gimp_2d_shapefn("GIMP2D/shapefn",
+                                    shapefn_kernel<2>("ED2Q16G", false),
+                                    nlocations);
+
+mpm_bench::Register gimp_2d_grad_shapefn("GIMP2D/grad_shapefn",
+                                         shapefn_kernel<2>("ED2Q16G", true),
+                                         nlocations);
+
+mpm_bench::Register gimp_2d_shapefn_grad_shapefn(
+    "GIMP2D/shapefn_grad_shapefn", shapefn_grad_shapefn_kernel<2>("ED2Q16G"),
+    nlocations);
+
+// 3D
+mpm_bench::Register gimp_3d_shapefn("GIMP3D/shapefn",
+                                    shapefn_kernel<3>("ED3H64G", false),
+                                    nlocations);
+
+mpm_bench::Register gimp_3d_grad_shapefn("GIMP3D/grad_shapefn",
+                                         shapefn_kernel<3>("ED3H64G", true),
+                                         nlocations);
+
+mpm_bench::Register gimp_3d_shapefn_grad_shapefn(
+    "GIMP3D/shapefn_grad_shapefn", shapefn_grad_shapefn_kernel<3>("ED3H64G"),
+    nlocations);
+
+// CPDI 2D
+mpm_bench::Register cpdi_2d_shapefn("CPDI2D/shapefn",
+                                    shapefn_kernel<2>("ED2Q16C", false),
+                                    nlocations);
+
+mpm_bench::Register cpdi_2d_grad_shapefn("CPDI2D/grad_shapefn",
+                                         shapefn_kernel<2>("ED2Q16C", true),
+                                         nlocations);
+
+mpm_bench::Register cpdi_2d_shapefn_grad_shapefn(
+    "CPDI2D/shapefn_grad_shapefn", shapefn_grad_shapefn_kernel<2>("ED2Q16C"),
+    nlocations);
+
+// CPDI 3D
+mpm_bench::Register cpdi_3d_shapefn("CPDI3D/shapefn",
+                                    shapefn_kernel<3>("ED3H64C", false),
+                                    nlocations);
+
+mpm_bench::Register cpdi_3d_grad_shapefn("CPDI3D/grad_shapefn",
+                                         shapefn_kernel<3>("ED3H64C", true),
+                                         nlocations);
+
+mpm_bench::Register cpdi_3d_shapefn_grad_shapefn(
+    "CPDI3D/shapefn_grad_shapefn", shapefn_grad_shapefn_kernel<3>("ED3H64C"),
+    nlocations);
+
+}  // namespace
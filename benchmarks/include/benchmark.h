@@ -0,0 +1,97 @@
+#ifndef MPM_BENCHMARK_H_
+#define MPM_BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mpm_bench {
+
+//! Benchmark kernel
+//! \details Runs the kernel `niterations` times
+using Kernel = std::function<void(unsigned long long niterations)>;
+
+//! Benchmark case
+struct Benchmark {
+  //! Name of the benchmark
+  std::string name;
+  //! Kernel to time
+  Kernel kernel;
+  //! Number of items (e.g., particles) processed per iteration
+  unsigned long long nitems{1};
+};
+
+//! Registry of benchmarks
+inline std::vector<Benchmark>& registry() {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+//! Register a benchmark at static initialisation
+struct Register {
+  //! Constructor
+  //! \param[in] name Name of the benchmark
+  //! \param[in] kernel Kernel to time
+  //! \param[in] nitems Number of items processed per iteration
+  Register(const std::string& name, Kernel kernel,
+           unsigned long long nitems = 1) {
+    registry().emplace_back(Benchmark{name, std::move(kernel), nitems});
+  }
+};
+
+//! Prevent the compiler from optimising away a value
+template <typename Ttype>
+inline void do_not_optimize(const Ttype& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+//! Run registered benchmarks
+//! \details Usage: mpmbench [filter] [--min-time seconds]
+//! \retval status Zero on success
+inline int run(int argc, char** argv) {
+  std::string filter;
+  double min_time = 0.2;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+      min_time = std::atof(argv[++i]);
+    else
+      filter = argv[i];
+  }
+
+  std::printf("%-56s %14s %14s\n", "Benchmark", "Iterations", "ns/item");
+  for (const auto& benchmark : registry()) {
+    if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+      continue;
+    // Warm up
+    benchmark.kernel(1);
+    // Increase the number of iterations until the minimum time is reached
+    unsigned long long niterations = 1;
+    double elapsed = 0.;
+    while (true) {
+      const auto start = std::chrono::steady_clock::now();
+      benchmark.kernel(niterations);
+      const auto end = std::chrono::steady_clock::now();
+      elapsed = std::chrono::duration<double>(end - start).count();
+      if (elapsed >= min_time || niterations >= (1ULL << 40)) break;
+      const double factor =
+          (elapsed > 0.) ? std::min(1.4 * min_time / elapsed, 10.) : 10.;
+      niterations = std::max(niterations + 1,
+                             static_cast<unsigned long long>(
+                                 static_cast<double>(niterations) * factor));
+    }
+    const double ns_per_item =
+        elapsed * 1.E+9 /
+        (static_cast<double>(niterations) * benchmark.nitems);
+    std::printf("%-56s %14llu %14.2f\n", benchmark.name.c_str(), niterations,
+                ns_per_item);
+  }
+  return 0;
+}
+
+}  // namespace mpm_bench
+
+#endif  // MPM_BENCHMARK_H_
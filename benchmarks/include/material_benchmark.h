@@ -0,0 +1,151 @@
+#ifndef MPM_MATERIAL_BENCHMARK_H_
+#define MPM_MATERIAL_BENCHMARK_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "cell.h"
+#include "element.h"
+#include "factory.h"
+#include "material.h"
+#include "node.h"
+#include "particle.h"
+
+namespace mpm_bench {
+
+//! Number of particles updated per benchmark iteration
+const unsigned nmaterial_particles = 256;
+
+//! Particle generator
+template <unsigned Tdim>
+using ParticleGenerator = std::function<std::shared_ptr<mpm::Particle<Tdim>>()>;
+
+//! Particle at rest without a cell
+//! \details Sufficient for materials that only use the strain increment
+//! \tparam Tdim Dimension
+//! \retval particle Particle at the origin
+template <unsigned Tdim>
+std::shared_ptr<mpm::Particle<Tdim>> stationary_particle() {
+  return std::make_shared<mpm::Particle<Tdim>>(
+      0, Eigen::Matrix<double, Tdim, 1>::Zero());
+}
+
+//! Particle inside a single deforming cell
+//! \details Node 0 of a 2 x 2 (x 2) cell moves with `velocity`, which gives
+//! the particle a non-zero strain rate and volumetric strain increment, as
+//! required by the fluid materials
+//! \tparam Tdim Dimension
+//! \param[in] velocity Velocity of the first node
+//! \retval generator Particle generator
+template <unsigned Tdim>
+ParticleGenerator<Tdim> deforming_particle(
+    const Eigen::Matrix<double, Tdim, 1>& velocity) {
+  // Dynamic storage avoids over-aligned fixed-size captures
+  const Eigen::VectorXd nodal_velocity = velocity;
+  return [nodal_velocity]() {
+    const unsigned nnodes = (Tdim == 2) ? 4 : 8;
+    std::shared_ptr<mpm::Element<Tdim>> element =
+        Factory<mpm::Element<Tdim>>::instance()->create(
+            (Tdim == 2) ? "ED2Q4" : "ED3H8");
+    auto cell = std::make_shared<mpm::Cell<Tdim>>(0, nnodes, element);
+    // Nodes at twice the unit cell coordinates
+    const Eigen::MatrixXd unit_cell = element->unit_cell_coordinates();
+    for (unsigned i = 0; i < nnodes; ++i) {
+      const Eigen::Matrix<double, Tdim, 1> coords =
+          2. * unit_cell.row(i).transpose();
+      std::shared_ptr<mpm::NodeBase<Tdim>> node =
+          std::make_shared<mpm::Node<Tdim, Tdim, 1>>(i, coords);
+      if (i == 0) {
+        for (unsigned dir = 0; dir < Tdim; ++dir)
+          node->assign_velocity_constraint(dir, nodal_velocity(dir));
+        node->apply_velocity_constraints();
+      }
+      cell->add_node(i, node);
+    }
+    cell->initialise();
+
+    auto particle = std::make_shared<mpm::Particle<Tdim>>(
+        0, Eigen::Matrix<double, Tdim, 1>::Constant(0.5));
+    particle->assign_cell(cell);
+    particle->compute_shapefn();
+    particle->compute_strain(1.);
+    return particle;
+  };
+}
+
+//! Kernel driving batched stress updates along a strain path
+//! \details Every particle starts from `stress` and receives `dstrain` at each
+//! update. For cyclic paths the sign of the increment alternates, which keeps
+//! the particles within the elastic domain
+//! \tparam Tdim Dimension
+//! \param[in] material_type Registered material type
+//! \param[in] properties Material properties
+//! \param[in] stress Initial stress
+//! \param[in] dstrain Strain increment per update
+//! \param[in] cyclic Alternate the sign of the strain increment
+//! \param[in] particle_generator Generator of the particle passed to materials
+//! \retval kernel Benchmark kernel
+template <unsigned Tdim>
+Kernel material_kernel(
+    const std::string& material_type, const Json& properties,
+    const Eigen::Matrix<double, 6, 1>& stress,
+    const Eigen::Matrix<double, 6, 1>& dstrain, bool cyclic,
+    ParticleGenerator<Tdim> particle_generator = stationary_particle<Tdim>) {
+  using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+  //! Particles updated by the kernel
+  struct Particles {
+    //! Material
+    std::shared_ptr<mpm::Material<Tdim>> material;
+    //! Particle used by materials that depend on particle kinematics
+    std::shared_ptr<mpm::Particle<Tdim>> particle;
+    //! Stresses
+    std::vector<Vector6d> stresses;
+    //! State variables
+    std::vector<mpm::dense_map> states;
+    //! Strain increment of the update
+    Vector6d dstrain;
+    //! Stress updates of the particles
+    std::vector<mpm::StressPoint<Tdim>> points;
+    //! Sign of the strain increment
+    double sign{1.};
+  };
+  auto particles = std::make_shared<Particles>();
+
+  return [=](unsigned long long niterations) {
+    // Materials are created on first use, after the factory is populated
+    if (!particles->material) {
+      particles->material =
+          Factory<mpm::Material<Tdim>, unsigned, const Json&>::instance()
+              ->create(material_type, 0, properties);
+      particles->particle = particle_generator();
+      particles->stresses.assign(nmaterial_particles, stress);
+      particles->states.assign(
+          nmaterial_particles,
+          particles->material->initialise_state_variables());
+      for (unsigned i = 0; i < nmaterial_particles; ++i)
+        particles->points.emplace_back(mpm::StressPoint<Tdim>{
+            particles->material.get(), &particles->stresses[i],
+            &particles->dstrain, &particles->particle->strain_rate(),
+            particles->particle->dvolumetric_strain(), &particles->states[i],
+            particles->particle.get()});
+    }
+    for (unsigned long long itr = 0; itr < niterations; ++itr) {
+      particles->dstrain = particles->sign * dstrain;
+      particles->material->compute_stresses(particles->points.data(),
+                                            particles->points.size());
+      if (cyclic) particles->sign = -particles->sign;
+      do_not_optimize(particles->stresses[0]);
+    }
+  };
+}
+
+}  // namespace mpm_bench
+
+#endif  // MPM_MATERIAL_BENCHMARK_H_
@@ -0,0 +1,103 @@
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "Eigen/Dense"
+
+#include "benchmark.h"
+#include "io_mesh_ascii.h"
+
+namespace {
+
+//! Number of cells along each direction of the synthetic mesh
+const unsigned ncells_dir = 700;
+//! Number of nodes of the synthetic mesh
+const unsigned nnodes = (ncells_dir + 1) * (ncells_dir + 1);
+//! Number of cells of the synthetic mesh
+const unsigned ncells = ncells_dir * ncells_dir;
+//! Number of particles of the synthetic particles file
+const unsigned nparticles = 1000000;
+
+//! Write a synthetic 2D mesh file of about a million lines, once
+//! \retval mesh Name of the mesh file
+const std::string& mesh_file() {
+  static const std::string mesh = [] {
+    const std::string filename = "benchmark-mesh-2d.txt";
+    std::ofstream file(filename);
+    file << "! elementShape quadrilateral\n";
+    file << "! elementNumPoints 4\n";
+    file << nnodes << "\t" << ncells << "\n";
+    file.precision(10);
+    for (unsigned j = 0; j <= ncells_dir; ++j)
+      for (unsigned i = 0; i <= ncells_dir; ++i)
+        file << 0.0125 * i << "\t" << 0.0125 * j << "\n";
+    for (unsigned j = 0; j < ncells_dir; ++j)
+      for (unsigned i = 0; i < ncells_dir; ++i) {
+        const unsigned n0 = j * (ncells_dir + 1) + i;
+        file << n0 << "\t" << n0 + 1 << "\t" << n0 + ncells_dir + 2 << "\t"
+             << n0 + ncells_dir + 1 << "\n";
+      }
+    return filename;
+  }();
+  return mesh;
+}
+
+//! Write a synthetic 2D particles file of a million lines, once
+//! \retval particles Name of the particles file
+const std::string& particles_file() {
+  static const std::string particles = [] {
+    const std::string filename = "benchmark-particles-2d.txt";
+    std::ofstream file(filename);
+    file << nparticles << "\n";
+    file.precision(10);
+    for (unsigned p = 0; p < nparticles; ++p)
+      file << 0.001 * (p % 1000) + 0.0005 << "\t"
+           << 0.001 * (p / 1000) + 0.0005 << "\n";
+    return filename;
+  }();
+  return particles;
+}
+
+//! Kernel reading the nodes of the mesh file
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel read_mesh_nodes_kernel() {
+  return [](unsigned long long niterations) {
+    auto io_mesh = std::make_unique<mpm::IOMeshAscii<2>>();
+    for (unsigned long long n = 0; n < niterations; ++n)
+      mpm_bench::do_not_optimize(io_mesh->read_mesh_nodes(mesh_file()).size());
+  };
+}
+
+//! Kernel reading the cells of the mesh file
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel read_mesh_cells_kernel() {
+  return [](unsigned long long niterations) {
+    auto io_mesh = std::make_unique<mpm::IOMeshAscii<2>>();
+    for (unsigned long long n = 0; n < niterations; ++n)
+      mpm_bench::do_not_optimize(io_mesh->read_mesh_cells(mesh_file()).size());
+  };
+}
+
+//! Kernel reading the particles file
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel read_particles_kernel() {
+  return [](unsigned long long niterations) {
+    auto io_mesh = std::make_unique<mpm::IOMeshAscii<2>>();
+    for (unsigned long long n = 0; n < niterations; ++n)
+      mpm_bench::do_not_optimize(
+          io_mesh->read_particles(particles_file()).size());
+  };
+}
+
+mpm_bench::Register read_mesh_nodes_2d("IOMeshAscii2D/read_mesh_nodes",
+                                       read_mesh_nodes_kernel(),
+                                       nnodes + ncells);
+
+mpm_bench::Register read_mesh_cells_2d("IOMeshAscii2D/read_mesh_cells",
+                                       read_mesh_cells_kernel(),
+                                       nnodes + ncells);
+
+mpm_bench::Register read_particles_2d("IOMeshAscii2D/read_particles",
+                                      read_particles_kernel(), nparticles);
+
+}  // namespace
@@ -0,0 +1,66 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! Bingham material properties
+//! \param[in] tau0 Yield stress
+Json bingham_properties(double tau0) {
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  jmaterial["tau0"] = tau0;
+  jmaterial["mu"] = 200.;
+  jmaterial["critical_shear_rate"] = 0.2;
+  return jmaterial;
+}
+
+//! Velocity of the moving node
+template <unsigned Tdim>
+Eigen::Matrix<double, Tdim, 1> nodal_velocity(double magnitude) {
+  Eigen::Matrix<double, Tdim, 1> velocity;
+  for (unsigned i = 0; i < Tdim; ++i) velocity(i) = magnitude * (i + 2);
+  return velocity;
+}
+
+// 2D
+mpm_bench::Register bingham_2d_rigid(
+    "Bingham2D/rigid",
+    mpm_bench::material_kernel<2>(
+        "Bingham2D", bingham_properties(771.8), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<2>(nodal_velocity<2>(0.01))),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register bingham_2d_flow(
+    "Bingham2D/flow",
+    mpm_bench::material_kernel<2>(
+        "Bingham2D", bingham_properties(200.), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<2>(nodal_velocity<2>(1.))),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register bingham_3d_rigid(
+    "Bingham3D/rigid",
+    mpm_bench::material_kernel<3>(
+        "Bingham3D", bingham_properties(771.8), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<3>(nodal_velocity<3>(0.01))),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register bingham_3d_flow(
+    "Bingham3D/flow",
+    mpm_bench::material_kernel<3>(
+        "Bingham3D", bingham_properties(200.), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<3>(nodal_velocity<3>(1.))),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
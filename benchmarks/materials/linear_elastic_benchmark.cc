@@ -0,0 +1,68 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! Linear elastic material properties
+Json linear_elastic_properties() {
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  return jmaterial;
+}
+
+//! Isotropic compressive stress
+Vector6d compressive_stress() {
+  return (Vector6d() << -20000., -20000., -20000., 0., 0., 0.).finished();
+}
+
+//! Axial and shear strain increment
+Vector6d elastic_dstrain() {
+  return (Vector6d() << -1.E-6, 5.E-7, 0., 1.E-6, 0., 0.).finished();
+}
+
+//! Volumetric expansion increment
+template <unsigned Tdim>
+Vector6d tension_dstrain() {
+  Vector6d dstrain = Vector6d::Zero();
+  for (unsigned i = 0; i < Tdim; ++i) dstrain(i) = 1.E-4;
+  return dstrain;
+}
+
+// 2D
+mpm_bench::Register linear_elastic_2d_elastic(
+    "LinearElastic2D/elastic",
+    mpm_bench::material_kernel<2>("LinearElastic2D",
+                                  linear_elastic_properties(),
+                                  compressive_stress(), elastic_dstrain(), true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register linear_elastic_2d_tension(
+    "LinearElastic2D/tension",
+    mpm_bench::material_kernel<2>("LinearElastic2D",
+                                  linear_elastic_properties(), Vector6d::Zero(),
+                                  tension_dstrain<2>(), true),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register linear_elastic_3d_elastic(
+    "LinearElastic3D/elastic",
+    mpm_bench::material_kernel<3>("LinearElastic3D",
+                                  linear_elastic_properties(),
+                                  compressive_stress(), elastic_dstrain(), true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register linear_elastic_3d_tension(
+    "LinearElastic3D/tension",
+    mpm_bench::material_kernel<3>("LinearElastic3D",
+                                  linear_elastic_properties(), Vector6d::Zero(),
+                                  tension_dstrain<3>(), true),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
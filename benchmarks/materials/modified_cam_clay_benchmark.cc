@@ -0,0 +1,95 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! Modified Cam Clay material properties
+//! \param[in] ocr Overconsolidation ratio
+//! \param[in] subloading Enable the subloading surface
+Json modified_cam_clay_properties(double ocr, bool subloading) {
+  Json jmaterial;
+  jmaterial["density"] = 1800.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  jmaterial["p_ref"] = 100000;
+  jmaterial["e_ref"] = 1.12;
+  jmaterial["pc0"] = 200000;
+  jmaterial["ocr"] = ocr;
+  jmaterial["m"] = 1.2;
+  jmaterial["lambda"] = 0.1;
+  jmaterial["kappa"] = 0.03;
+  jmaterial["three_invariants"] = false;
+  jmaterial["bonding"] = false;
+  jmaterial["subloading"] = subloading;
+  if (subloading) jmaterial["subloading_u"] = 0.5;
+  return jmaterial;
+}
+
+//! Isotropic compressive stress
+Vector6d compressive_stress() {
+  return (Vector6d() << -200000., -200000., -200000., 0., 0., 0.).finished();
+}
+
+//! Triaxial compression strain increment
+Vector6d triaxial_dstrain(double magnitude) {
+  return (Vector6d() << 0.5 * magnitude, 0.5 * magnitude, -magnitude, 0., 0.,
+          0.)
+      .finished();
+}
+
+// 2D
+mpm_bench::Register modified_cam_clay_2d_elastic(
+    "ModifiedCamClay2D/elastic",
+    mpm_bench::material_kernel<2>("ModifiedCamClay2D",
+                                  modified_cam_clay_properties(1.5, false),
+                                  compressive_stress(), triaxial_dstrain(1.E-6),
+                                  true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register modified_cam_clay_2d_plastic(
+    "ModifiedCamClay2D/plastic",
+    mpm_bench::material_kernel<2>("ModifiedCamClay2D",
+                                  modified_cam_clay_properties(1., false),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register modified_cam_clay_2d_subloading(
+    "ModifiedCamClay2D/plastic_subloading",
+    mpm_bench::material_kernel<2>("ModifiedCamClay2D",
+                                  modified_cam_clay_properties(1.5, true),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register modified_cam_clay_3d_elastic(
+    "ModifiedCamClay3D/elastic",
+    mpm_bench::material_kernel<3>("ModifiedCamClay3D",
+                                  modified_cam_clay_properties(1.5, false),
+                                  compressive_stress(), triaxial_dstrain(1.E-6),
+                                  true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register modified_cam_clay_3d_plastic(
+    "ModifiedCamClay3D/plastic",
+    mpm_bench::material_kernel<3>("ModifiedCamClay3D",
+                                  modified_cam_clay_properties(1., false),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register modified_cam_clay_3d_subloading(
+    "ModifiedCamClay3D/plastic_subloading",
+    mpm_bench::material_kernel<3>("ModifiedCamClay3D",
+                                  modified_cam_clay_properties(1.5, true),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
@@ -0,0 +1,111 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! Mohr Coulomb material properties
+Json mohr_coulomb_properties(bool softening) {
+  Json jmaterial;
+  jmaterial["density"] = 1800.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  jmaterial["softening"] = softening;
+  jmaterial["friction"] = 30.;
+  jmaterial["dilation"] = 5.;
+  jmaterial["cohesion"] = 2000.;
+  jmaterial["residual_friction"] = 20.;
+  jmaterial["residual_dilation"] = 0.;
+  jmaterial["residual_cohesion"] = 1000.;
+  jmaterial["peak_pdstrain"] = 0.;
+  jmaterial["residual_pdstrain"] = 1.;
+  jmaterial["tension_cutoff"] = 1000.;
+  return jmaterial;
+}
+
+//! Isotropic compressive stress
+Vector6d compressive_stress() {
+  return (Vector6d() << -20000., -20000., -20000., 0., 0., 0.).finished();
+}
+
+//! Small axial strain increment
+Vector6d elastic_dstrain() {
+  return (Vector6d() << -1.E-6, 0., 0., 0., 0., 0.).finished();
+}
+
+//! Shear strain increment
+Vector6d shear_dstrain() {
+  return (Vector6d() << 0., 0., 0., 1.E-4, 0., 0.).finished();
+}
+
+//! Volumetric expansion increment
+template <unsigned Tdim>
+Vector6d tension_dstrain() {
+  Vector6d dstrain = Vector6d::Zero();
+  for (unsigned i = 0; i < Tdim; ++i) dstrain(i) = 1.E-4;
+  return dstrain;
+}
+
+// 2D
+mpm_bench::Register mohr_coulomb_2d_elastic(
+    "MohrCoulomb2D/elastic",
+    mpm_bench::material_kernel<2>("MohrCoulomb2D",
+                                  mohr_coulomb_properties(false),
+                                  compressive_stress(), elastic_dstrain(), true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_2d_shear(
+    "MohrCoulomb2D/shear",
+    mpm_bench::material_kernel<2>("MohrCoulomb2D",
+                                  mohr_coulomb_properties(false),
+                                  compressive_stress(), shear_dstrain(), false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_2d_shear_softening(
+    "MohrCoulomb2D/shear_softening",
+    mpm_bench::material_kernel<2>("MohrCoulomb2D",
+                                  mohr_coulomb_properties(true),
+                                  compressive_stress(), shear_dstrain(), false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_2d_tension(
+    "MohrCoulomb2D/tension",
+    mpm_bench::material_kernel<2>("MohrCoulomb2D",
+                                  mohr_coulomb_properties(false), Vector6d::Zero(),
+                                  tension_dstrain<2>(), false),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register mohr_coulomb_3d_elastic(
+    "MohrCoulomb3D/elastic",
+    mpm_bench::material_kernel<3>("MohrCoulomb3D",
+                                  mohr_coulomb_properties(false),
+                                  compressive_stress(), elastic_dstrain(), true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_3d_shear(
+    "MohrCoulomb3D/shear",
+    mpm_bench::material_kernel<3>("MohrCoulomb3D",
+                                  mohr_coulomb_properties(false),
+                                  compressive_stress(), shear_dstrain(), false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_3d_shear_softening(
+    "MohrCoulomb3D/shear_softening",
+    mpm_bench::material_kernel<3>("MohrCoulomb3D",
+                                  mohr_coulomb_properties(true),
+                                  compressive_stress(), shear_dstrain(), false),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register mohr_coulomb_3d_tension(
+    "MohrCoulomb3D/tension",
+    mpm_bench::material_kernel<3>("MohrCoulomb3D",
+                                  mohr_coulomb_properties(false), Vector6d::Zero(),
+                                  tension_dstrain<3>(), false),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
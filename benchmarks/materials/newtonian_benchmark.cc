@@ -0,0 +1,64 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! Newtonian material properties
+//! \param[in] incompressible Incompressible fluid
+Json newtonian_properties(bool incompressible) {
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["bulk_modulus"] = 8333333.333333333;
+  jmaterial["dynamic_viscosity"] = 8.9E-4;
+  jmaterial["incompressible"] = incompressible;
+  return jmaterial;
+}
+
+//! Velocity of the moving node
+template <unsigned Tdim>
+Eigen::Matrix<double, Tdim, 1> nodal_velocity() {
+  Eigen::Matrix<double, Tdim, 1> velocity;
+  for (unsigned i = 0; i < Tdim; ++i) velocity(i) = 0.01 * (i + 2);
+  return velocity;
+}
+
+// 2D
+mpm_bench::Register newtonian_2d_flow(
+    "Newtonian2D/flow",
+    mpm_bench::material_kernel<2>(
+        "Newtonian2D", newtonian_properties(false), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<2>(nodal_velocity<2>())),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register newtonian_2d_incompressible(
+    "Newtonian2D/incompressible",
+    mpm_bench::material_kernel<2>(
+        "Newtonian2D", newtonian_properties(true), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<2>(nodal_velocity<2>())),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register newtonian_3d_flow(
+    "Newtonian3D/flow",
+    mpm_bench::material_kernel<3>(
+        "Newtonian3D", newtonian_properties(false), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<3>(nodal_velocity<3>())),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register newtonian_3d_incompressible(
+    "Newtonian3D/incompressible",
+    mpm_bench::material_kernel<3>(
+        "Newtonian3D", newtonian_properties(true), Vector6d::Zero(),
+        Vector6d::Zero(), false,
+        mpm_bench::deforming_particle<3>(nodal_velocity<3>())),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
@@ -0,0 +1,71 @@
+#include "Eigen/Dense"
+#include "json.hpp"
+
+#include "benchmark.h"
+#include "material_benchmark.h"
+
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+//! NorSand material properties
+Json norsand_properties() {
+  Json jmaterial;
+  jmaterial["density"] = 1800.;
+  jmaterial["poisson_ratio"] = 0.3;
+  jmaterial["reference_pressure"] = 1000.;
+  jmaterial["friction_cs"] = 30;
+  jmaterial["N"] = 0.3;
+  jmaterial["lambda"] = 0.1;
+  jmaterial["kappa"] = 0.03;
+  jmaterial["gamma"] = 1.3;
+  jmaterial["chi"] = 3.5;
+  jmaterial["hardening_modulus"] = 200.0;
+  jmaterial["void_ratio_initial"] = 0.85;
+  jmaterial["p_image_initial"] = 87014.6;
+  return jmaterial;
+}
+
+//! Isotropic compressive stress
+Vector6d compressive_stress() {
+  return (Vector6d() << -200000., -200000., -200000., 0., 0., 0.).finished();
+}
+
+//! Triaxial compression strain increment
+Vector6d triaxial_dstrain(double magnitude) {
+  return (Vector6d() << 0.5 * magnitude, 0.5 * magnitude, -magnitude, 0., 0.,
+          0.)
+      .finished();
+}
+
+// 2D
+mpm_bench::Register norsand_2d_elastic(
+    "NorSand2D/elastic",
+    mpm_bench::material_kernel<2>("NorSand2D", norsand_properties(),
+                                  compressive_stress(), triaxial_dstrain(1.E-7),
+                                  true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register norsand_2d_plastic(
+    "NorSand2D/plastic",
+    mpm_bench::material_kernel<2>("NorSand2D", norsand_properties(),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+// 3D
+mpm_bench::Register norsand_3d_elastic(
+    "NorSand3D/elastic",
+    mpm_bench::material_kernel<3>("NorSand3D", norsand_properties(),
+                                  compressive_stress(), triaxial_dstrain(1.E-7),
+                                  true),
+    mpm_bench::nmaterial_particles);
+
+mpm_bench::Register norsand_3d_plastic(
+    "NorSand3D/plastic",
+    mpm_bench::material_kernel<3>("NorSand3D", norsand_properties(),
+                                  compressive_stress(), triaxial_dstrain(1.E-5),
+                                  false),
+    mpm_bench::nmaterial_particles);
+
+}  // namespace
@@ -0,0 +1,162 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "benchmark.h"
+#include "cell.h"
+#include "element.h"
+#include "factory.h"
+#include "material.h"
+#include "mesh.h"
+#include "node.h"
+#include "particle.h"
+
+namespace {
+
+//! Number of cells along each direction
+const unsigned ncells_dir = 64;
+//! Number of material points per direction in a cell
+const unsigned nquadratures = 3;
+
+//! Create a structured mesh of unit quadrilateral cells
+//! \retval mesh Mesh with materials
+std::shared_ptr<mpm::Mesh<2>> structured_mesh() {
+  const unsigned Dim = 2;
+  auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+  std::shared_ptr<mpm::Element<Dim>> element =
+      Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+
+  // Nodes
+  std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes;
+  for (unsigned j = 0; j <= ncells_dir; ++j)
+    for (unsigned i = 0; i <= ncells_dir; ++i) {
+      const Eigen::Matrix<double, Dim, 1> coordinates(i, j);
+      nodes.emplace_back(std::make_shared<mpm::Node<Dim, Dim, 1>>(
+          nodes.size(), coordinates));
+      mesh->add_node(nodes.back());
+    }
+
+  // Cells
+  for (unsigned j = 0; j < ncells_dir; ++j)
+    for (unsigned i = 0; i < ncells_dir; ++i) {
+      const unsigned n0 = j * (ncells_dir + 1) + i;
+      auto cell = std::make_shared<mpm::Cell<Dim>>(j * ncells_dir + i, 4,
+                                                   element);
+      cell->add_node(0, nodes.at(n0));
+      cell->add_node(1, nodes.at(n0 + 1));
+      cell->add_node(2, nodes.at(n0 + ncells_dir + 2));
+      cell->add_node(3, nodes.at(n0 + ncells_dir + 1));
+      cell->initialise();
+      mesh->add_cell(cell);
+    }
+
+  // Material
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>> materials;
+  materials[0] =
+      Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+          "LinearElastic2D", 0, jmaterial);
+  mesh->initialise_material_models(materials);
+  return mesh;
+}
+
+//! Kernel generating material points at the Gauss points of every cell
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel generate_points_kernel() {
+  return [](unsigned long long niterations) {
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      auto mesh = structured_mesh();
+      mesh->generate_material_points(nquadratures, "P2D", {0}, -1, 0);
+      mpm_bench::do_not_optimize(mesh->nparticles());
+    }
+  };
+}
+
+//! Kernel creating the mesh only, to subtract from the generation
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel structured_mesh_kernel() {
+  return [](unsigned long long niterations) {
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      auto mesh = structured_mesh();
+      mpm_bench::do_not_optimize(mesh->ncells());
+    }
+  };
+}
+
+//! Kernel finding the neighbours of every cell
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel cell_neighbours_kernel() {
+  auto mesh = std::make_shared<std::shared_ptr<mpm::Mesh<2>>>();
+  return [=](unsigned long long niterations) {
+    // Mesh is created on first use, after the factories are populated
+    if (!(*mesh)) (*mesh) = structured_mesh();
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      (*mesh)->find_cell_neighbours();
+      mpm_bench::do_not_optimize((*mesh)->ncells());
+    }
+  };
+}
+
+//! Kernel moving a particle across the cells of the mesh
+//! \details Assigning a cell refers to the nodes and matrices of the cell
+//! without copying them
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel cell_crossing_kernel() {
+  auto cells = std::make_shared<mpm::Vector<mpm::Cell<2>>>();
+  auto particle = std::make_shared<mpm::Particle<2>>(
+      0, Eigen::Matrix<double, 2, 1>::Zero());
+  return [=](unsigned long long niterations) {
+    // Mesh is created on first use, after the factories are populated
+    if (cells->size() == 0) (*cells) = structured_mesh()->cells();
+    const Eigen::Matrix<double, 2, 1> xi(0.25, -0.5);
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      bool status =
+          particle->assign_cell_xi(*(cells->cbegin() + n % cells->size()), xi);
+      mpm_bench::do_not_optimize(status);
+    }
+  };
+}
+
+//! Kernel extracting the stresses of all particles for output
+//! \retval kernel Benchmark kernel
+mpm_bench::Kernel particles_tensor_data_kernel() {
+  auto mesh = std::make_shared<std::shared_ptr<mpm::Mesh<2>>>();
+  return [=](unsigned long long niterations) {
+    // Mesh is created on first use, after the factories are populated
+    if (!(*mesh)) {
+      (*mesh) = structured_mesh();
+      (*mesh)->generate_material_points(nquadratures, "P2D", {0}, -1, 0);
+    }
+    for (unsigned long long n = 0; n < niterations; ++n) {
+      auto stresses = (*mesh)->template particles_tensor_data<6>("stresses");
+      mpm_bench::do_not_optimize(stresses.data());
+    }
+  };
+}
+
+mpm_bench::Register mesh_2d("Mesh2D/structured_mesh", structured_mesh_kernel(),
+                            ncells_dir * ncells_dir * nquadratures *
+                                nquadratures);
+
+mpm_bench::Register generate_points_2d(
+    "Mesh2D/generate_material_points", generate_points_kernel(),
+    ncells_dir * ncells_dir * nquadratures * nquadratures);
+
+mpm_bench::Register cell_neighbours_2d("Mesh2D/find_cell_neighbours",
+                                       cell_neighbours_kernel(),
+                                       ncells_dir * ncells_dir);
+
+mpm_bench::Register cell_crossing_2d("Mesh2D/particle_cell_crossing",
+                                     cell_crossing_kernel(), 1);
+
+mpm_bench::Register particles_tensor_data_2d(
+    "Mesh2D/particles_tensor_data", particles_tensor_data_kernel(),
+    ncells_dir * ncells_dir * nquadratures * nquadratures);
+
+}  // namespace
@@ -21,6 +21,12 @@
 
 namespace mpm {
 
+//! Cell geometry
+//! Cartesian: axis-aligned affine image of the unit cell
+//! Affine: constant Jacobian over the cell
+//! General: Jacobian varies over the cell
+enum class CellGeometry { Cartesian, Affine, General };
+
 //! Cell class
 //! \brief Base class that stores the information about cells
 //! \tparam Tdim Dimension
@@ -67,6 +73,15 @@ class Cell {
   //! Generate points
   std::vector<Eigen::Matrix<double, Tdim, 1>> generate_points();
 
+  //! Generate points from shape functions evaluated at reference points
+  //! \details Maps all points with a single product, without checking the
+  //! points by an inverse mapping
+  //! \param[in] shapefns Shape functions at the reference points (nfunctions
+  //! x npoints)
+  //! \retval points Coordinates of the points (Tdim x npoints)
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> generate_points(
+      const Eigen::MatrixXd& shapefns) const;
+
   //! Return the number of particles
   unsigned nparticles() const { return particles_.size(); }
 
@@ -84,13 +99,13 @@ class Cell {
   bool status() const { return particles_.size(); }
 
   //! Return particles_
-  std::vector<Index> particles() const { return particles_; }
+  const std::vector<Index>& particles() const { return particles_; }
 
   //! Number of nodes
   unsigned nnodes() const { return nodes_.size(); }
 
   //! Return nodes of the cell
-  std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> nodes() const {
+  const std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>>& nodes() const {
     return nodes_;
   }
 
@@ -127,11 +142,15 @@ class Cell {
   //! \retval insertion_status Return the successful addition of a node
   bool add_neighbour(mpm::Index neighbour_id);
 
+  //! Assign neighbour cells, replacing any existing neighbours
+  //! \param[in] neighbours Sorted and unique ids of the neighbouring cells
+  void assign_neighbours(const std::vector<mpm::Index>& neighbours);
+
   //! Number of neighbours
   unsigned nneighbours() const { return neighbours_.size(); }
 
-  //! Return neighbour ids
-  std::set<mpm::Index> neighbours() const { return neighbours_; }
+  //! Return neighbour ids in ascending order
+  const std::vector<mpm::Index>& neighbours() const { return neighbours_; }
 
   //! Add an id of a particle in the cell
   //! \param[in] id Global id of a particle
@@ -158,7 +177,58 @@ class Cell {
   Eigen::Matrix<double, Tdim, 1> centroid() const { return centroid_; }
 
   //! Return the dN/dx at the centroid of the cell
-  Eigen::MatrixXd dn_dx_centroid() const { return dn_dx_centroid_; }
+  const Eigen::MatrixXd& dn_dx_centroid() const { return dn_dx_centroid_; }
+
+  //! Return the geometry classification of the cell
+  mpm::CellGeometry geometry() const { return geometry_; }
+
+  //! Return if the cell is an affine image of the unit cell, i.e., the
+  //! Jacobian is constant over the cell
+  bool affine() const { return geometry_ != mpm::CellGeometry::General; }
+
+  //! Return the (constant) Jacobian of an affine cell
+  const Eigen::Matrix<double, Tdim, Tdim>& jacobian() const {
+    return jacobian_;
+  }
+
+  //! Return the dN/dx at given local coordinates
+  //! Uses the cached inverse Jacobian for affine cells and falls back to the
+  //! element dN/dx otherwise
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval dn_dx Gradient of shape functions in real coordinates
+  Eigen::MatrixXd dn_dx(const VectorDim& xi, const VectorDim& particle_size,
+                        const VectorDim& deformation_gradient) const;
+
+  //! Evaluate shape functions and dN/dx at given local coordinates in place
+  //! \details Does not allocate in affine cells when the element evaluates
+  //! in place and the storage has the right size
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] dn_dx Gradient of shape functions in real coordinates
+  void shapefn_dn_dx(const VectorDim& xi, const VectorDim& particle_size,
+                     const VectorDim& deformation_gradient,
+                     Eigen::VectorXd* shapefn, Eigen::MatrixXd* dn_dx) const;
+
+  //! Evaluate shape functions and dN/dx of a deformed particle domain in
+  //! place
+  //! \details The domain is spanned by the half lengths of the particle along
+  //! the local axes, mapped by its deformation gradient. Does not allocate
+  //! in affine cells when the element evaluates in place and the storage has
+  //! the right size
+  //! \param[in] xi given local coordinates
+  //! \param[in] natural_size Undeformed size of the particle in natural
+  //! coordinates
+  //! \param[in] deformation_gradient Deformation gradient of the particle
+  //! \param[out] shapefn Shape functions
+  //! \param[out] dn_dx Gradient of shape functions in real coordinates
+  void domain_shapefn_dn_dx(
+      const VectorDim& xi, const VectorDim& natural_size,
+      const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient,
+      Eigen::VectorXd* shapefn, Eigen::MatrixXd* dn_dx) const;
 
   //! Compute mean length of cell
   void compute_mean_length();
@@ -167,7 +237,9 @@ class Cell {
   double mean_length() const { return mean_length_; }
 
   //! Return nodal coordinates
-  Eigen::MatrixXd nodal_coordinates() const { return nodal_coordinates_; }
+  const Eigen::MatrixXd& nodal_coordinates() const {
+    return nodal_coordinates_;
+  }
 
   //! Check if a point is in a cartesian cell by checking the domain ranges
   //! \param[in] point Coordinates of point
@@ -218,6 +290,17 @@ class Cell {
   unsigned previous_mpirank() const;
 
  private:
+  //! Classify the cell geometry and cache the constant Jacobian, its inverse
+  //! and the origin of the affine map for Cartesian and affine cells
+  void compute_affine_jacobian();
+
+  //! Return the local coordinates of a point using the inverse affine map of
+  //! a Cartesian or affine cell
+  //! \param[in] point Coordinates of a point
+  //! \retval xi Local coordinates of a point
+  inline Eigen::Matrix<double, Tdim, 1> affine_local_coordinates(
+      const Eigen::Matrix<double, Tdim, 1>& point) const;
+
   //! Approximately check if a point is in a cell
   //! \param[in] point Coordinates of point
   bool approx_point_in_cell(const Eigen::Matrix<double, Tdim, 1>& point);
@@ -249,14 +332,22 @@ class Cell {
   std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
   //! Nodal coordinates
   Eigen::MatrixXd nodal_coordinates_;
-  //! Container of cell neighbour ids
-  std::set<mpm::Index> neighbours_;
+  //! Container of cell neighbour ids in ascending order
+  std::vector<mpm::Index> neighbours_;
   //! Shape function
   std::shared_ptr<const Element<Tdim>> element_{nullptr};
   //! Quadrature
   std::shared_ptr<Quadrature<Tdim>> quadrature_{nullptr};
   //! dN/dx
   Eigen::MatrixXd dn_dx_centroid_;
+  //! Cell geometry classification
+  mpm::CellGeometry geometry_{mpm::CellGeometry::General};
+  //! Origin of the affine map x = x_0 + J^T xi
+  VectorDim affine_origin_;
+  //! Jacobian of an affine cell dx_j/dxi_i
+  Eigen::Matrix<double, Tdim, Tdim> jacobian_;
+  //! Transpose of the inverse Jacobian of an affine cell
+  Eigen::Matrix<double, Tdim, Tdim> inverse_jacobian_transpose_;
   //! Velocity constraints
   //! key: face_id, value: pair of direction [0/1/2] and velocity value
   std::map<unsigned, std::vector<std::pair<unsigned, double>>>
@@ -45,9 +45,11 @@ bool mpm::Cell<Tdim>::initialise() {
       Eigen::Matrix<double, Tdim, 1> zero;
       zero.setZero();
 
+      // Cache the Jacobian of affine cells
+      this->compute_affine_jacobian();
+
       // dN/dX at the centroid
-      dn_dx_centroid_ =
-          element_->dn_dx(xi_centroid, this->nodal_coordinates_, zero, zero);
+      dn_dx_centroid_ = this->dn_dx(xi_centroid, zero, zero);
 
       status = true;
     } else {
@@ -60,6 +62,115 @@ bool mpm::Cell<Tdim>::initialise() {
   return status;
 }
 
+//! Classify the cell as Cartesian, affine or general
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::compute_affine_jacobian() {
+  geometry_ = mpm::CellGeometry::General;
+  jacobian_.setZero();
+  inverse_jacobian_transpose_.setZero();
+  affine_origin_.setZero();
+
+  // Natural coordinates of all nodes, including those beyond the unit cell
+  // of GIMP and B-spline elements
+  const Eigen::MatrixXd& natural_nodes = element_->natural_nodal_coordinates();
+  if (natural_nodes.rows() != nodal_coordinates_.rows()) return;
+
+  // Jacobian at the centroid dx_j/dxi_i
+  const VectorDim zero = VectorDim::Zero();
+  jacobian_ = element_->jacobian(zero, nodal_coordinates_, zero, zero);
+
+  const double determinant = jacobian_.determinant();
+  if (!(std::fabs(determinant) > std::numeric_limits<double>::epsilon()))
+    return;
+
+  // The cell is affine if x = x_0 + xi J holds for every node
+  const Eigen::Matrix<double, 1, Tdim> origin =
+      nodal_coordinates_.colwise().mean() -
+      natural_nodes.colwise().mean() * jacobian_;
+  const double residual =
+      ((natural_nodes * jacobian_).rowwise() + origin - nodal_coordinates_)
+          .cwiseAbs()
+          .maxCoeff();
+
+  const double tolerance =
+      1.0E-10 *
+      std::max(mean_length_, nodal_coordinates_.cwiseAbs().maxCoeff());
+  if (residual < tolerance) {
+    affine_origin_ = origin.transpose();
+    inverse_jacobian_transpose_ = jacobian_.inverse().transpose();
+
+    // Cartesian if the Jacobian is diagonal
+    Eigen::Matrix<double, Tdim, Tdim> off_diagonal = jacobian_;
+    off_diagonal.diagonal().setZero();
+    geometry_ = (off_diagonal.cwiseAbs().maxCoeff() < tolerance)
+                    ? mpm::CellGeometry::Cartesian
+                    : mpm::CellGeometry::Affine;
+  }
+}
+
+//! Return the dN/dx at given local coordinates
+template <unsigned Tdim>
+Eigen::MatrixXd mpm::Cell<Tdim>::dn_dx(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  // dN/dx = [J]^-1 * dN/dxi, with a constant Jacobian for affine cells
+  if (geometry_ != mpm::CellGeometry::General)
+    return element_->grad_shapefn(xi, particle_size, deformation_gradient) *
+           inverse_jacobian_transpose_;
+
+  return element_->dn_dx(xi, nodal_coordinates_, particle_size,
+                         deformation_gradient);
+}
+
+//! Evaluate shape functions and dN/dx at given local coordinates in place
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::shapefn_dn_dx(const VectorDim& xi,
+                                    const VectorDim& particle_size,
+                                    const VectorDim& deformation_gradient,
+                                    Eigen::VectorXd* shapefn,
+                                    Eigen::MatrixXd* dn_dx) const {
+  if (geometry_ != mpm::CellGeometry::General) {
+    element_->shapefn_grad_shapefn(xi, particle_size, deformation_gradient,
+                                   shapefn, dn_dx);
+    // dN/dx = [J]^-1 * dN/dxi, row by row to avoid a temporary
+    for (unsigned i = 0; i < dn_dx->rows(); ++i)
+      dn_dx->row(i) = (dn_dx->row(i) * inverse_jacobian_transpose_).eval();
+    return;
+  }
+
+  *shapefn = element_->shapefn(xi, particle_size, deformation_gradient);
+  *dn_dx = element_->dn_dx(xi, nodal_coordinates_, particle_size,
+                           deformation_gradient);
+}
+
+//! Evaluate shape functions and dN/dx of a deformed particle domain in place
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::domain_shapefn_dn_dx(
+    const VectorDim& xi, const VectorDim& natural_size,
+    const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient,
+    Eigen::VectorXd* shapefn, Eigen::MatrixXd* dn_dx) const {
+  // Jacobian at the particle, constant in affine cells
+  Eigen::Matrix<double, Tdim, Tdim> jacobian = jacobian_;
+  Eigen::Matrix<double, Tdim, Tdim> inverse_jacobian_transpose =
+      inverse_jacobian_transpose_;
+  if (geometry_ == mpm::CellGeometry::General) {
+    jacobian = element_->jacobian(xi, nodal_coordinates_, VectorDim::Zero(),
+                                  VectorDim::Zero());
+    inverse_jacobian_transpose = jacobian.inverse().transpose();
+  }
+
+  // Half vectors of the domain in local coordinates: the deformation
+  // gradient in local coordinates applied to the half lengths
+  const Eigen::Matrix<double, Tdim, Tdim> domain =
+      inverse_jacobian_transpose * deformation_gradient *
+      jacobian.transpose() * (0.5 * natural_size).asDiagonal();
+  element_->domain_shapefn_grad_shapefn(xi, domain, shapefn, dn_dx);
+
+  // dN/dx = [J]^-1 * dN/dxi, row by row to avoid a temporary
+  for (unsigned i = 0; i < dn_dx->rows(); ++i)
+    dn_dx->row(i) = (dn_dx->row(i) * inverse_jacobian_transpose).eval();
+}
+
 //! Return the initialisation status of cells
 //! \retval initialisation_status Cell has nodes, shape functions and volumes
 template <unsigned Tdim>
@@ -94,7 +205,7 @@ std::vector<Eigen::Matrix<double, Tdim, 1>> mpm::Cell<Tdim>::generate_points() {
   std::vector<Eigen::Matrix<double, Tdim, 1>> points;
 
   // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
+  const Eigen::VectorXi& indices = element_->corner_indices();
 
   // Matrix of nodal coordinates
   const Eigen::MatrixXd nodal_coords = nodal_coordinates_.transpose();
@@ -125,6 +236,21 @@ std::vector<Eigen::Matrix<double, Tdim, 1>> mpm::Cell<Tdim>::generate_points() {
   return points;
 }
 
+//! Generate points from shape functions evaluated at reference points
+template <unsigned Tdim>
+Eigen::Matrix<double, Tdim, Eigen::Dynamic> mpm::Cell<Tdim>::generate_points(
+    const Eigen::MatrixXd& shapefns) const {
+  try {
+    if (shapefns.rows() != nodal_coordinates_.rows())
+      throw std::runtime_error(
+          "Number of shape functions does not match the nodes of the cell");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return Eigen::Matrix<double, Tdim, Eigen::Dynamic>(Tdim, 0);
+  }
+  return nodal_coordinates_.transpose() * shapefns;
+}
+
 //! Add a node pointer and return the status of addition of a node
 template <unsigned Tdim>
 bool mpm::Cell<Tdim>::add_node(
@@ -167,7 +293,7 @@ std::vector<std::array<mpm::Index, 2>> mpm::Cell<Tdim>::side_node_pairs()
   // Create a vector of node_pairs
   std::vector<std::array<mpm::Index, 2>> node_pairs;
   // Get the indices of sides
-  Eigen::MatrixXi indices = element_->sides_indices();
+  const Eigen::MatrixXi& indices = element_->sides_indices();
   // Iterate over indices and get node ids
   for (unsigned i = 0; i < indices.rows(); ++i)
     node_pairs.emplace_back(std::array<mpm::Index, 2>(
@@ -182,9 +308,15 @@ bool mpm::Cell<Tdim>::add_neighbour(mpm::Index neighbour_id) {
   bool insertion_status = false;
   try {
     // If cell id is not the same as the current cell
-    if (neighbour_id != this->id())
-      insertion_status = (neighbours_.insert(neighbour_id)).second;
-    else
+    if (neighbour_id != this->id()) {
+      // Insert in order, if not present
+      auto itr =
+          std::lower_bound(neighbours_.begin(), neighbours_.end(), neighbour_id);
+      if (itr == neighbours_.end() || *itr != neighbour_id) {
+        neighbours_.insert(itr, neighbour_id);
+        insertion_status = true;
+      }
+    } else
       throw std::runtime_error("Invalid local id of a cell neighbour");
 
   } catch (std::exception& exception) {
@@ -193,6 +325,13 @@ bool mpm::Cell<Tdim>::add_neighbour(mpm::Index neighbour_id) {
   return insertion_status;
 }
 
+//! Assign neighbour cells
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::assign_neighbours(
+    const std::vector<mpm::Index>& neighbours) {
+  neighbours_ = neighbours;
+}
+
 //! Add a particle id and return the status of addition of a particle id
 template <unsigned Tdim>
 bool mpm::Cell<Tdim>::add_particle_id(Index id) {
@@ -238,7 +377,7 @@ inline void mpm::Cell<Tdim>::compute_volume() {
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_centroid() {
   // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
+  const Eigen::VectorXi& indices = element_->corner_indices();
 
   // Calculate the centroid of the cell
   centroid_.setZero();
@@ -252,7 +391,7 @@ void mpm::Cell<Tdim>::compute_centroid() {
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_mean_length() {
   // Get the indices of sub-triangles
-  Eigen::MatrixXi indices = element_->sides_indices();
+  const Eigen::MatrixXi& indices = element_->sides_indices();
   this->mean_length_ = 0.;
   // Calculate the mean length
   for (unsigned i = 0; i < indices.rows(); ++i)
@@ -328,8 +467,12 @@ inline bool mpm::Cell<Tdim>::is_point_in_cell(
 
   bool status = true;
 
+  // Cartesian and affine cells have an exact inverse map
+  if (geometry_ != mpm::CellGeometry::General)
+    (*xi) = this->affine_local_coordinates(point);
   // Check if cell is cartesian, if so use cartesian local coordinates
-  if (!isoparametric_) (*xi) = this->local_coordinates_point(point);
+  else if (!isoparametric_)
+    (*xi) = this->local_coordinates_point(point);
   // Isoparametric element
   else
     (*xi) = this->transform_real_to_unit_cell(point);
@@ -371,7 +514,7 @@ inline Eigen::Matrix<double, 1, 1> mpm::Cell<1>::local_coordinates_point(
 
   try {
     // Indices of corner nodes
-    Eigen::VectorXi indices = element_->corner_indices();
+    const Eigen::VectorXi& indices = element_->corner_indices();
 
     // Linear
     if (indices.size() == 2) {
@@ -406,7 +549,7 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::local_coordinates_point(
 
   try {
     // Indices of corner nodes
-    Eigen::VectorXi indices = element_->corner_indices();
+    const Eigen::VectorXi& indices = element_->corner_indices();
 
     // Triangle
     if (indices.size() == 3) {
@@ -476,7 +619,7 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::local_coordinates_point(
 
   try {
     // Indices of corner nodes
-    Eigen::VectorXi indices = element_->corner_indices();
+    const Eigen::VectorXi& indices = element_->corner_indices();
 
     // Hexahedron
     if (indices.size() == 8) {
@@ -523,6 +666,19 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::local_coordinates_point(
 }
 
 
+//! Return the local coordinates of a point in a Cartesian or affine cell
+template <unsigned Tdim>
+inline Eigen::Matrix<double, Tdim, 1> mpm::Cell<Tdim>::affine_local_coordinates(
+    const Eigen::Matrix<double, Tdim, 1>& point) const {
+  // Cartesian: xi_i = (x_i - x0_i) / J_ii
+  if (geometry_ == mpm::CellGeometry::Cartesian)
+    return (point - affine_origin_)
+        .cwiseProduct(inverse_jacobian_transpose_.diagonal());
+
+  // Affine: xi = J^-T (x - x0)
+  return inverse_jacobian_transpose_ * (point - affine_origin_);
+}
+
 //! Return the local coordinates of a point in a 1D cell
 template <>
 inline Eigen::Matrix<double, 1, 1> mpm::Cell<1>::transform_real_to_unit_cell(
@@ -536,11 +692,15 @@ inline Eigen::Matrix<double, Tdim, 1>
     mpm::Cell<Tdim>::transform_real_to_unit_cell(
         const Eigen::Matrix<double, Tdim, 1>& point) {
 
+  // Cartesian and affine cells have an exact inverse map
+  if (geometry_ != mpm::CellGeometry::General)
+    return this->affine_local_coordinates(point);
+
   // If regular cartesian grid use cartesian transformation
   if (!this->isoparametric_) return this->local_coordinates_point(point);
 
   // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
+  const Eigen::VectorXi& indices = element_->corner_indices();
 
   // Analytical solution for 2D linear triangle element
   if (Tdim == 2 && indices.size() == 3) {
@@ -557,8 +717,13 @@ inline Eigen::Matrix<double, Tdim, 1>
   const Eigen::Matrix<double, Tdim, 1> zero =
       Eigen::Matrix<double, Tdim, 1>::Zero();
 
-  // Matrix of nodal coordinates
-  const Eigen::MatrixXd nodal_coords = nodal_coordinates_.transpose();
+  // Coordinates of a unit cell
+  const auto& unit_cell = element_->unit_cell_coordinates();
+
+  // Matrix of nodal coordinates of the unit cell, elements with nodes beyond
+  // the cell (GIMP, B-spline) list the corner nodes first
+  const Eigen::MatrixXd nodal_coords =
+      nodal_coordinates_.topRows(unit_cell.rows()).transpose();
 
   // Analytical xi
   Eigen::Matrix<double, Tdim, 1> analytical_xi;
@@ -600,9 +765,6 @@ inline Eigen::Matrix<double, Tdim, 1>
   // Affine tolerance
   const double affine_tolerance = 1.0E-16 * mean_length_ * mean_length_;
 
-  // Coordinates of a unit cell
-  const auto unit_cell = element_->unit_cell_coordinates();
-
   // Affine residual
   Eigen::Matrix<double, Tdim, 1> affine_residual;
 
@@ -754,7 +916,7 @@ inline void mpm::Cell<2>::compute_normals() {
   //! Set number of faces from element
   for (unsigned face_id = 0; face_id < element_->nfaces(); ++face_id) {
     // Get the nodes of the face
-    const Eigen::VectorXi indices = element_->face_indices(face_id);
+    const Eigen::VectorXi& indices = element_->face_indices(face_id);
 
     // Compute the vector to calculate normal (perpendicular)
     // a = node(0) - node(1)
@@ -782,7 +944,7 @@ inline void mpm::Cell<3>::compute_normals() {
   //! Set number of faces from element
   for (unsigned face_id = 0; face_id < element_->nfaces(); ++face_id) {
     // Get the nodes of the face
-    const Eigen::VectorXi indices = element_->face_indices(face_id);
+    const Eigen::VectorXi& indices = element_->face_indices(face_id);
 
     // Compute two vectors to calculate normal
     // a = node(1) - node(0)
@@ -814,7 +976,7 @@ inline std::vector<std::vector<mpm::Index>>
     std::vector<mpm::Index> face_nodes;
 
     // Get the nodes of the face
-    const Eigen::VectorXi indices = element_->face_indices(face_id);
+    const Eigen::VectorXi& indices = element_->face_indices(face_id);
     for (int id = 0; id < indices.size(); ++id)
       face_nodes.emplace_back(nodes_[indices(id)]->id());
 
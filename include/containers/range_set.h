@@ -0,0 +1,97 @@
+#ifndef MPM_RANGE_SET_H_
+#define MPM_RANGE_SET_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! RangeSet class
+//! \brief Set of ids stored as disjoint ranges of consecutive ids
+//! \details Sets of consecutive ids, such as those of particles generated in
+//! a cell set, take memory of their number of ranges. Ids keep the order in
+//! which they were given, without duplicates, so that entities of a set are
+//! visited in the order of the input. Ids are accessed by their position in
+//! the set, in logarithmic time of the number of ranges.
+class RangeSet {
+ public:
+  //! Range of count consecutive ids from first
+  struct Range {
+    //! First id
+    mpm::Index first;
+    //! Number of ids
+    mpm::Index count;
+  };
+
+  //! Default constructor of an empty set
+  RangeSet() = default;
+
+  //! Construct a set of ids
+  //! \param[in] ids Ids in input order, later duplicates are dropped
+  explicit RangeSet(const std::vector<mpm::Index>& ids);
+
+  //! Construct a set of ranges of ids
+  //! \param[in] ranges Ranges in input order, which may overlap, ids of later
+  //! ranges already in the set are dropped
+  explicit RangeSet(std::vector<Range> ranges);
+
+  //! Number of ids
+  std::size_t size() const { return offsets_.back(); }
+
+  //! Return if the set has no ids
+  bool empty() const { return ranges_.empty(); }
+
+  //! Return disjoint ranges of ids in input order
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  //! Return if an id is in the set
+  //! \param[in] id Id
+  bool contains(mpm::Index id) const;
+
+  //! Return id at a position in the set
+  //! \param[in] position Position of the id, less than size
+  mpm::Index operator[](std::size_t position) const;
+
+  //! Iterate over ids at consecutive positions in the set
+  //! \details The range of the first position is searched once, and the
+  //! ranges are walked from there
+  //! \param[in] begin Position of the first id
+  //! \param[in] end Position after the last id, at most size
+  //! \param[in] oper Operation on an id
+  //! \tparam Toper Callable with an id
+  template <typename Toper>
+  void for_each(std::size_t begin, std::size_t end, Toper oper) const {
+    if (begin >= end) return;
+    std::size_t range = this->range_index(begin);
+    mpm::Index id = ranges_[range].first + (begin - offsets_[range]);
+    for (std::size_t position = begin; position < end; ++position, ++id) {
+      if (position == offsets_[range + 1]) id = ranges_[++range].first;
+      oper(id);
+    }
+  }
+
+  //! Return ids in input order
+  std::vector<mpm::Index> ids() const;
+
+ private:
+  //! Drop empty ranges and ids already in the set, and compute offsets
+  void merge();
+
+  //! Return index of the range of a position
+  std::size_t range_index(std::size_t position) const {
+    return std::upper_bound(offsets_.cbegin(), offsets_.cend(), position) -
+           offsets_.cbegin() - 1;
+  }
+
+  //! Disjoint ranges in input order
+  std::vector<Range> ranges_;
+  //! Position of the first id of each range in the set, and the size
+  std::vector<std::size_t> offsets_{0};
+  //! Sorted disjoint and non-adjacent ranges to search ids
+  std::vector<Range> sorted_;
+};  // RangeSet class
+}  // namespace mpm
+
+#endif  // MPM_RANGE_SET_H_
@@ -7,12 +7,11 @@
 //! 0 0----------0 1
 
 //! Return shape functions of a 4-node Quadrilateral Element at a given local
-//! coordinate, with particle size and deformation gradient
+//! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 4, 1>
+    mpm::QuadrilateralElement<2, 4>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 4, 1> shapefn;
   shapefn(0) = 0.25 * (1 - xi(0)) * (1 - xi(1));
   shapefn(1) = 0.25 * (1 + xi(0)) * (1 - xi(1));
@@ -22,12 +21,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
 }
 
 //! Return gradient of shape functions of a 4-node Quadrilateral Element at a
-//! given local coordinate, with particle size and deformation gradient
+//! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 4, 2>
+    mpm::QuadrilateralElement<2, 4>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 4, 2> grad_shapefn;
   grad_shapefn(0, 0) = -0.25 * (1 - xi(1));
   grad_shapefn(1, 0) = 0.25 * (1 - xi(1));
@@ -44,16 +42,16 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::QuadrilateralElement<2, 4>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 4, 2> unit_cell;
   // clang-format off
-  unit_cell << -1., -1.,
-                1., -1.,
-                1.,  1.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 4, 2>() << -1., -1.,
+                                         1., -1.,
+                                         1.,  1.,
     // cppcheck-suppress *
-               -1.,  1.;
+                                        -1.,  1.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -70,12 +68,11 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::unit_cell_coordinates()
 //! 0       4       1
 
 //! Return shape functions of a 8-node Quadrilateral Element at a given local
-//! coordinate, with particle size and deformation gradient
+//! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::QuadrilateralElement<2, 8>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = -0.25 * (1. - xi(0)) * (1. - xi(1)) * (xi(0) + xi(1) + 1.);
   shapefn(1) = 0.25 * (1. + xi(0)) * (1. - xi(1)) * (xi(0) - xi(1) - 1.);
@@ -89,12 +86,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
 }
 
 //! Return gradient of shape functions of a 8-node Quadrilateral Element at a
-//! given local coordinate, with particle size and deformation gradient
+//! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 2>
+    mpm::QuadrilateralElement<2, 8>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 8, 2> grad_shapefn;
   grad_shapefn(0, 0) = 0.25 * (2. * xi(0) + xi(1)) * (1. - xi(1));
   grad_shapefn(1, 0) = 0.25 * (2. * xi(0) - xi(1)) * (1. - xi(1));
@@ -118,20 +114,20 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::QuadrilateralElement<2, 8>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 8, 2> unit_cell;
   // clang-format off
-  unit_cell << -1., -1.,
-                1., -1.,
-                1.,  1.,
-               -1.,  1.,
-                0., -1.,
-                1.,  0.,
-                0.,  1.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 8, 2>() << -1., -1.,
+                                         1., -1.,
+                                         1.,  1.,
+                                        -1.,  1.,
+                                         0., -1.,
+                                         1.,  0.,
+                                         0.,  1.,
   // cppcheck-suppress *
-               -1.,  0.;
+                                        -1.,  0.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -148,12 +144,11 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::unit_cell_coordinates()
 //!  0      4       1
 
 //! Return shape functions of a 9-node Quadrilateral Element at a given local
-//! coordinate, with particle size and deformation gradient
+//! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 9, 1>
+    mpm::QuadrilateralElement<2, 9>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 9, 1> shapefn;
 
   shapefn(0) = 0.25 * xi(0) * xi(1) * (xi(0) - 1.) * (xi(1) - 1.);
@@ -170,12 +165,11 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
 }
 
 //! Return gradient of shape functions of a 9-node Quadrilateral Element at a
-//! given local coordinate, with particle size and deformation gradient
+//! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 9>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 9, 2>
+    mpm::QuadrilateralElement<2, 9>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 9, 2> grad_shapefn;
   // 9-noded
   grad_shapefn(0, 0) = 0.25 * xi(1) * (xi(1) - 1.) * (2 * xi(0) - 1.);
@@ -201,21 +195,21 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 9>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 9>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::QuadrilateralElement<2, 9>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 9, 2> unit_cell;
   // clang-format off
-  unit_cell << -1., -1.,
-                1., -1.,
-                1.,  1.,
-               -1.,  1.,
-                0., -1.,
-                1.,  0.,
-                0.,  1.,
-               -1.,  0.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 9, 2>() << -1., -1.,
+                                         1., -1.,
+                                         1.,  1.,
+                                        -1.,  1.,
+                                         0., -1.,
+                                         1.,  0.,
+                                         0.,  1.,
+                                        -1.,  0.,
   // cppcheck-suppress *
-                0.,  0.;
+                                         0.,  0.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -241,6 +235,45 @@ inline mpm::ElementDegree mpm::QuadrilateralElement<2, 9>::degree() const {
   return mpm::ElementDegree::Quadratic;
 }
 
+//! Return shape functions of a Quadrilateral Element at a given local
+//! coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::QuadrilateralElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->fixed_shapefn(xi);
+}
+
+//! Return gradient of shape functions of a Quadrilateral Element at a given
+//! local coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::QuadrilateralElement<Tdim, Tnfunctions>::grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return this->fixed_grad_shapefn(xi);
+}
+
+//! Evaluate shape functions and gradients of a Quadrilateral Element in place,
+//! without allocating when the storage has the right size
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void
+    mpm::QuadrilateralElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient, Eigen::VectorXd* shapefn,
+        Eigen::MatrixXd* grad_shapefn) const {
+  // Elements derived from this one have shape functions of their own
+  if (this->shapefn_type() != mpm::ShapefnType::NORMAL_MPM) {
+    mpm::Element<Tdim>::shapefn_grad_shapefn(
+        xi, particle_size, deformation_gradient, shapefn, grad_shapefn);
+    return;
+  }
+  shapefn->resize(Tnfunctions);
+  grad_shapefn->resize(Tnfunctions, Tdim);
+  *shapefn = this->fixed_shapefn(xi);
+  *grad_shapefn = this->fixed_grad_shapefn(xi);
+}
+
 //! Return local shape functions of a Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -420,41 +453,40 @@ inline Eigen::MatrixXd
 //! \tparam Tdim Dimension
 //! \tparam Tnfunctions Number of shape functions
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi
+inline const Eigen::MatrixXi&
     mpm::QuadrilateralElement<Tdim, Tnfunctions>::sides_indices() const {
-  Eigen::Matrix<int, 4, 2> indices;
   // clang-format off
-  indices << 0, 1,
-             1, 2,
-             2, 3,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 4, 2>() << 0, 1,
+                                     1, 2,
+                                     2, 3,
   // cppcheck-suppress *
-             3, 0;
+                                     3, 0).finished();
   // clang-format on
   return indices;
 }
 
 //! Return the corner indices of a cell to calculate the cell volume
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::QuadrilateralElement<Tdim, Tnfunctions>::corner_indices() const {
-  Eigen::Matrix<int, 4, 1> indices;
   // cppcheck-suppress *
-  indices << 0, 1, 2, 3;
+  static const Eigen::VectorXi indices =
+      (Eigen::Matrix<int, 4, 1>() << 0, 1, 2, 3).finished();
   return indices;
 }
 
 //! Return indices of a sub-tetrahedrons in a volume
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi
+inline const Eigen::MatrixXi&
     mpm::QuadrilateralElement<Tdim, Tnfunctions>::inhedron_indices() const {
-  Eigen::Matrix<int, 4, Tdim, Eigen::RowMajor> indices;
-
   // clang-format off
-  indices << 0, 1,
-             1, 2,
-             2, 3,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 4, Tdim, Eigen::RowMajor>() << 0, 1,
+                                                         1, 2,
+                                                         2, 3,
   // cppcheck-suppress *
-             3, 0;
+                                                         3, 0).finished();
   //clang-format on
   return indices;
 }
@@ -462,11 +494,11 @@ inline Eigen::MatrixXi
 //! Return indices of a face of the element
 //! 4-noded quadrilateral
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::QuadrilateralElement<2, 4>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 2, 1>>
+  static const std::map<unsigned, Eigen::VectorXi>
       face_indices_quadrilateral{{0, Eigen::Matrix<int, 2, 1>(0, 1)},
                                  {1, Eigen::Matrix<int, 2, 1>(1, 2)},
                                  {2, Eigen::Matrix<int, 2, 1>(2, 3)},
@@ -478,11 +510,11 @@ inline Eigen::VectorXi
 //! Return indices of a face of the element
 //! 8-noded quadrilateral
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::QuadrilateralElement<2, 8>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 3, 1>>
+  static const std::map<unsigned, Eigen::VectorXi>
       face_indices_quadrilateral{{0, Eigen::Matrix<int, 3, 1>(0, 1, 4)},
                                  {1, Eigen::Matrix<int, 3, 1>(1, 2, 5)},
                                  {2, Eigen::Matrix<int, 3, 1>(2, 3, 6)},
@@ -494,11 +526,11 @@ inline Eigen::VectorXi
 //! Return indices of a face of the element
 //! 9-noded quadrilateral
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::QuadrilateralElement<2, 9>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 3, 1>>
+  static const std::map<unsigned, Eigen::VectorXi>
       face_indices_quadrilateral{{0, Eigen::Matrix<int, 3, 1>(0, 1, 4)},
                                  {1, Eigen::Matrix<int, 3, 1>(1, 2, 5)},
                                  {2, Eigen::Matrix<int, 3, 1>(2, 3, 6)},
@@ -1,6 +1,7 @@
 #ifndef MPM_GIMP_ELEMENT_H_
 #define MPM_GIMP_ELEMENT_H_
 
+#include "gimp_basis.h"
 #include "quadrilateral_element.h"
 
 namespace mpm {
@@ -130,9 +131,12 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
       const VectorDim& point,
       const Eigen::MatrixXd& nodal_coordinates) const override;
 
- private:
   //! Return natural nodal coordinates
-  Eigen::MatrixXd natural_nodal_coordinates() const;
+  const Eigen::MatrixXd& natural_nodal_coordinates() const override;
+
+ private:
+  //! Return the axis indices (0-3) of the nodes along each dimension
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& node_axes() const;
 
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
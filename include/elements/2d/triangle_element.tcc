@@ -8,12 +8,11 @@
 //!   0 0----------0 1
 
 //! Return shape functions of a 3-node Triangle Element at a given local
-//! coordinate, with particle size and deformation gradient
+//! coordinate
 template <>
-inline Eigen::VectorXd mpm::TriangleElement<2, 3>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 3, 1>
+    mpm::TriangleElement<2, 3>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 3, 1> shapefn;
   shapefn(0) = 1 - (xi(0) + xi(1));
   shapefn(1) = xi(0);
@@ -22,12 +21,11 @@ inline Eigen::VectorXd mpm::TriangleElement<2, 3>::shapefn(
 }
 
 //! Return gradient of shape functions of a 3-node Triangle Element at a
-//! given local coordinate, with particle size and deformation gradient
+//! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 3, 2>
+    mpm::TriangleElement<2, 3>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 3, 2> grad_shapefn;
 
   grad_shapefn(0, 0) = -1.;
@@ -41,15 +39,15 @@ inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::TriangleElement<2, 3>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 3, 2> unit_cell;
   // clang-format off
-  unit_cell << 0., 0.,
-               1., 0.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 3, 2>() << 0., 0.,
+                                        1., 0.,
     // cppcheck-suppress *
-               0., 1.;
+                                        0., 1.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -65,12 +63,11 @@ inline Eigen::MatrixXd mpm::TriangleElement<2, 3>::unit_cell_coordinates()
 //!           3
 
 //! Return shape functions of a 6-node Triangle Element at a given local
-//! coordinate, with particle size and deformation gradient
+//! coordinate
 template <>
-inline Eigen::VectorXd mpm::TriangleElement<2, 6>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 6, 1>
+    mpm::TriangleElement<2, 6>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 6, 1> shapefn;
   shapefn(0) = (1. - xi(0) - xi(1)) * (1. - 2. * xi(0) - 2. * xi(1));
   shapefn(1) = xi(0) * (2. * xi(0) - 1.);
@@ -82,12 +79,11 @@ inline Eigen::VectorXd mpm::TriangleElement<2, 6>::shapefn(
 }
 
 //! Return gradient of shape functions of a 6-node Triangle Element at a
-//! given local coordinate, with particle size and deformation gradient
+//! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 6>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi,
-    const Eigen::Matrix<double, 2, 1>& particle_size,
-    const Eigen::Matrix<double, 2, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 6, 2>
+    mpm::TriangleElement<2, 6>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 6, 2> grad_shapefn;
   grad_shapefn(0, 0) = 4. * xi(0) + 4. * xi(1) - 3.;
   grad_shapefn(1, 0) = 4. * xi(0) - 1.;
@@ -107,18 +103,18 @@ inline Eigen::MatrixXd mpm::TriangleElement<2, 6>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::TriangleElement<2, 6>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::TriangleElement<2, 6>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 6, 2> unit_cell;
   // clang-format off
-  unit_cell << 0. , 0. ,
-               1. , 0. ,
-               0. , 1. ,
-               0.5, 0. ,
-               0.5, 0.5,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 6, 2>() << 0. , 0. ,
+                                        1. , 0. ,
+                                        0. , 1. ,
+                                        0.5, 0. ,
+                                        0.5, 0.5,
     // cppcheck-suppress *
-               0. , 0.5;
+                                        0. , 0.5).finished();
   // clang-format on
   return unit_cell;
 }
@@ -137,6 +133,43 @@ inline mpm::ElementDegree mpm::TriangleElement<2, 6>::degree() const {
   return mpm::ElementDegree::Quadratic;
 }
 
+//! Return shape functions of a Triangle Element at a given local coordinate,
+//! with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::TriangleElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->fixed_shapefn(xi);
+}
+
+//! Return gradient of shape functions of a Triangle Element at a given local
+//! coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd mpm::TriangleElement<Tdim, Tnfunctions>::grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->fixed_grad_shapefn(xi);
+}
+
+//! Evaluate shape functions and gradients of a Triangle Element in place,
+//! without allocating when the storage has the right size
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::TriangleElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient, Eigen::VectorXd* shapefn,
+    Eigen::MatrixXd* grad_shapefn) const {
+  // Elements derived from this one have shape functions of their own
+  if (this->shapefn_type() != mpm::ShapefnType::NORMAL_MPM) {
+    mpm::Element<Tdim>::shapefn_grad_shapefn(
+        xi, particle_size, deformation_gradient, shapefn, grad_shapefn);
+    return;
+  }
+  shapefn->resize(Tnfunctions);
+  grad_shapefn->resize(Tnfunctions, Tdim);
+  *shapefn = this->fixed_shapefn(xi);
+  *grad_shapefn = this->fixed_grad_shapefn(xi);
+}
+
 //! Return local shape functions of a Triangle Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -312,39 +345,38 @@ inline Eigen::MatrixXd mpm::TriangleElement<Tdim, Tnfunctions>::laplace_matrix(
 //! \tparam Tdim Dimension
 //! \tparam Tnfunctions Number of shape functions
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi mpm::TriangleElement<Tdim, Tnfunctions>::sides_indices()
-    const {
-  Eigen::Matrix<int, 3, 2> indices;
+inline const Eigen::MatrixXi&
+    mpm::TriangleElement<Tdim, Tnfunctions>::sides_indices() const {
   // clang-format off
-  indices << 0, 1,
-             1, 2,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 3, 2>() << 0, 1,
+                                     1, 2,
     // cppcheck-suppress *
-             2, 0;
+                                     2, 0).finished();
   // clang-format on
   return indices;
 }
 
 //! Return the corner indices of a cell to calculate the cell volume
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::VectorXi mpm::TriangleElement<Tdim, Tnfunctions>::corner_indices()
-    const {
-  Eigen::Matrix<int, 3, 1> indices;
+inline const Eigen::VectorXi&
+    mpm::TriangleElement<Tdim, Tnfunctions>::corner_indices() const {
   // cppcheck-suppress *
-  indices << 0, 1, 2;
+  static const Eigen::VectorXi indices =
+      (Eigen::Matrix<int, 3, 1>() << 0, 1, 2).finished();
   return indices;
 }
 
 //! Return indices of a sub-tetrahedrons in a volume
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi
+inline const Eigen::MatrixXi&
     mpm::TriangleElement<Tdim, Tnfunctions>::inhedron_indices() const {
-  Eigen::Matrix<int, 3, Tdim, Eigen::RowMajor> indices;
-
   // clang-format off
-  indices << 0, 1,
-             1, 2,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 3, Tdim, Eigen::RowMajor>() << 0, 1,
+                                                         1, 2,
     // cppcheck-suppress *
-             2, 0;
+                                                         2, 0).finished();
   //clang-format on
   return indices;
 }
@@ -352,11 +384,11 @@ inline Eigen::MatrixXi
 //! Return indices of a face of the element
 //! 3-noded triangle
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::TriangleElement<2, 3>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 2, 1>>
+  static const std::map<unsigned, Eigen::VectorXi>
       face_indices_triangle{{0, Eigen::Matrix<int, 2, 1>(0, 1)},
                             {1, Eigen::Matrix<int, 2, 1>(1, 2)},
                             {2, Eigen::Matrix<int, 2, 1>(2, 0)}}; 
@@ -367,11 +399,11 @@ inline Eigen::VectorXi
 //! Return indices of a face of the element
 //! 6-noded triangle
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::TriangleElement<2, 6>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 3, 1>>
+  static const std::map<unsigned, Eigen::VectorXi>
       face_indices_triangle{{0, Eigen::Matrix<int, 3, 1>(0, 1, 3)},
                             {1, Eigen::Matrix<int, 3, 1>(1, 2, 4)},
                             {2, Eigen::Matrix<int, 3, 1>(2, 0, 5)}};
@@ -0,0 +1,132 @@
+#ifndef MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
+#define MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
+
+#include "bspline_basis.h"
+#include "gimp_basis.h"
+#include "hexahedron_element.h"
+
+namespace mpm {
+
+//! Hexahedron B-spline element class derived from Hexahedron
+//! \brief Hexahedron quadratic / cubic B-spline element
+//! \details 64-noded hexahedron B-spline element, evaluated as the tensor
+//! product of 1D uniform B-splines of the four nodes along each axis. The
+//! eight corners of the cell come first, ordered as the 8-noded hexahedron,
+//! followed by the other nodes of the 4 x 4 x 4 stencil ordered by z, y and x
+//! natural coordinates \n
+//!
+template <unsigned Tdim, unsigned Tpolynomial>
+class HexahedronBSplineElement : public HexahedronElement<3, 8> {
+
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Number of shape functions
+  static const unsigned Tnfunctions = 64;
+
+  //! constructor with polynomial order
+  HexahedronBSplineElement() : HexahedronElement<3, 8>() {
+    static_assert(Tdim == 3, "Invalid dimension for a B-spline element");
+    static_assert((Tpolynomial == 2 || Tpolynomial == 3),
+                  "Specified B-spline polynomial order is not defined");
+
+    //! Logger
+    std::string logger = "hexahedron_bspline::<" + std::to_string(Tdim) +
+                         ", " + std::to_string(Tpolynomial) + ">";
+    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  }
+
+  //! Evaluate shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                          const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate local shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn_local(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate gradient of shape functions
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::MatrixXd grad_shapefn(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Compute Jacobian
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval jacobian Jacobian matrix
+  Eigen::Matrix<double, Tdim, Tdim> jacobian(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Compute Jacobian local
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval jacobian Jacobian matrix
+  Eigen::Matrix<double, Tdim, Tdim> jacobian_local(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate the B matrix at given local coordinates for a real cell
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval bmatrix B matrix
+  std::vector<Eigen::MatrixXd> bmatrix(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Return the type of shape function
+  mpm::ShapefnType shapefn_type() const override {
+    return mpm::ShapefnType::BSPLINE;
+  }
+
+  //! Return number of shape functions
+  unsigned nfunctions() const override { return Tnfunctions; }
+
+  //! Return if natural coordinates can be evaluates
+  bool isvalid_natural_coordinates_analytical() const override { return false; }
+
+  //! Compute Natural coordinates of a point (analytical)
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] point Location of the point in cell
+  //! \retval xi Return the local coordinates
+  VectorDim natural_coordinates_analytical(
+      const VectorDim& point,
+      const Eigen::MatrixXd& nodal_coordinates) const override;
+
+  //! Return natural nodal coordinates
+  const Eigen::MatrixXd& natural_nodal_coordinates() const override;
+
+ private:
+  //! Return the axis indices (0-3) of the nodes along each dimension
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& node_axes() const;
+
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};
+
+}  // namespace mpm
+#include "hexahedron_bspline_element.tcc"
+
+#endif  // MPM_HEXAHEDRON_BSPLINE_ELEMENT_H_
@@ -0,0 +1,223 @@
+// Return natural nodal coordinates
+template <unsigned Tdim, unsigned Tpolynomial>
+inline const Eigen::MatrixXd& mpm::HexahedronBSplineElement<
+    Tdim, Tpolynomial>::natural_nodal_coordinates() const {
+  //! Natural coordinates of nodes
+  static const Eigen::MatrixXd local_nodes = [this]() {
+    Eigen::Matrix<double, Tnfunctions, Tdim> nodes;
+    // Corners of the cell
+    const unsigned ncorners = 8;
+    nodes.topRows(ncorners) = this->unit_cell_coordinates();
+    // Remaining nodes of the stencil
+    unsigned node = ncorners;
+    for (int k = -3; k <= 3; k += 2)
+      for (int j = -3; j <= 3; j += 2)
+        for (int i = -3; i <= 3; i += 2)
+          if (std::abs(i) != 1 || std::abs(j) != 1 || std::abs(k) != 1) {
+            nodes.row(node) << i, j, k;
+            ++node;
+          }
+    return nodes;
+  }();
+  return local_nodes;
+}
+
+// Return the axis indices of the nodes
+template <unsigned Tdim, unsigned Tpolynomial>
+inline const std::array<std::array<unsigned, Tdim>,
+                        mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::
+                            Tnfunctions>&
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::node_axes() const {
+  static const std::array<std::array<unsigned, Tdim>, Tnfunctions> axes =
+      mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+          this->natural_nodal_coordinates());
+  return axes;
+}
+
+//! Return shape functions of a 64-node Hexahedron B-spline Element at a
+//! given local coordinate
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::VectorXd
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::shapefn(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+
+  //! Axis indices of the nodes
+  const auto& axes = this->node_axes();
+  //! To store shape functions
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn;
+
+  try {
+    //! 1D shape functions and gradients of the four nodes along each axis
+    std::array<std::array<double, mpm::bspline::nnodes_axis>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::bspline::axis_weights<Tpolynomial>(xi(i), &sn[i], &dn[i]))
+        throw std::runtime_error("B-spline shapefn: Invalid local coordinates");
+
+    //! Tensor product of the 1D shape functions
+    for (unsigned n = 0; n < Tnfunctions; ++n)
+      shapefn(n) = sn[0][axes[n][0]] * sn[1][axes[n][1]] * sn[2][axes[n][2]];
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    shapefn.setZero();
+  }
+  return shapefn;
+}
+
+//! Return gradient of shape functions of a 64-node Hexahedron B-spline
+//! Element at a given local coordinate
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::MatrixXd
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::grad_shapefn(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+
+  //! Axis indices of the nodes
+  const auto& axes = this->node_axes();
+  //! To store grad shape functions
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
+
+  try {
+    //! 1D shape functions and gradients of the four nodes along each axis
+    std::array<std::array<double, mpm::bspline::nnodes_axis>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::bspline::axis_weights<Tpolynomial>(xi(i), &sn[i], &dn[i]))
+        throw std::runtime_error(
+            "B-spline grad shapefn: Invalid local coordinates");
+
+    //! Tensor product of the 1D shape functions and gradients
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      const unsigned ax = axes[n][0];
+      const unsigned ay = axes[n][1];
+      const unsigned az = axes[n][2];
+      grad_shapefn(n, 0) = dn[0][ax] * sn[1][ay] * sn[2][az];
+      grad_shapefn(n, 1) = dn[1][ay] * sn[0][ax] * sn[2][az];
+      grad_shapefn(n, 2) = dn[2][az] * sn[0][ax] * sn[1][ay];
+    }
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    grad_shapefn.setZero();
+  }
+  return grad_shapefn;
+}
+
+//! Return the B-matrix of a Hexahedron B-spline Element at a given local
+//! coordinate for a real cell
+template <unsigned Tdim, unsigned Tpolynomial>
+inline std::vector<Eigen::MatrixXd>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::bmatrix(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+
+  // Get gradient shape functions
+  Eigen::MatrixXd grad_sf =
+      this->grad_shapefn(xi, particle_size, deformation_gradient);
+
+  // B-Matrix
+  std::vector<Eigen::MatrixXd> bmatrix;
+  bmatrix.reserve(Tnfunctions);
+
+  try {
+    // Check if matrices dimensions are correct
+    if ((grad_sf.rows() != nodal_coordinates.rows()) ||
+        (xi.rows() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "BMatrix - Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return bmatrix;
+  }
+
+  // Jacobian dx_i/dxi_j
+  Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      (grad_sf.transpose() * nodal_coordinates);
+
+  // Gradient shapefn of the cell
+  // dN/dx = [J]^-1 * dN/dxi
+  Eigen::MatrixXd grad_shapefn = grad_sf * (jacobian.inverse()).transpose();
+
+  for (unsigned i = 0; i < Tnfunctions; ++i) {
+    // clang-format off
+    Eigen::Matrix<double, 6, Tdim> bi;
+    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;                 bi(0, 2) = 0.;
+    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1); bi(1, 2) = 0.;
+    bi(2, 0) = 0.;                 bi(2, 1) = 0.;                 bi(2, 2) = grad_shapefn(i, 2);
+    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0); bi(3, 2) = 0.;
+    bi(4, 0) = 0.;                 bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
+    bi(5, 0) = grad_shapefn(i, 2); bi(5, 1) = 0.;                 bi(5, 2) = grad_shapefn(i, 0);
+    // clang-format on
+    bmatrix.push_back(bi);
+  }
+  return bmatrix;
+}
+
+//! Return local shape functions of a B-spline Hexahedron Element at a given
+//! local coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::VectorXd
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::shapefn_local(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return mpm::HexahedronElement<Tdim, 8>::shapefn(xi, particle_size,
+                                                  deformation_gradient);
+}
+
+//! Compute Jacobian with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::Matrix<double, Tdim, Tdim>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::jacobian(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+
+  // Get gradient shape functions
+  const Eigen::MatrixXd grad_shapefn =
+      this->grad_shapefn(xi, particle_size, deformation_gradient);
+
+  try {
+    // Check if matrices dimensions are correct
+    if ((grad_shapefn.rows() != nodal_coordinates.rows()) ||
+        (xi.size() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return Eigen::Matrix<double, Tdim, Tdim>::Zero();
+  }
+
+  // Jacobian dx_i/dxi_j
+  return (grad_shapefn.transpose() * nodal_coordinates);
+}
+
+//! Compute Jacobian local with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::Matrix<double, Tdim, Tdim>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::jacobian_local(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  // Jacobian dx_i/dxi_j
+  return mpm::HexahedronElement<3, 8>::jacobian(
+      xi, nodal_coordinates, particle_size, deformation_gradient);
+}
+
+//! Compute natural coordinates of a point (analytical)
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::Matrix<double, Tdim, 1> mpm::HexahedronBSplineElement<
+    Tdim, Tpolynomial>::natural_coordinates_analytical(const VectorDim& point,
+                                                       const Eigen::MatrixXd&
+                                                           nodal_coordinates)
+    const {
+  // Local point coordinates
+  Eigen::Matrix<double, 3, 1> xi;
+  xi.fill(std::numeric_limits<double>::max());
+  throw std::runtime_error(
+      "Analytical solution for HexBSpline<Tdim, Tpolynomial> has not been "
+      "implemented");
+  return xi;
+}
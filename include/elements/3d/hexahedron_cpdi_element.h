@@ -0,0 +1,169 @@
+#ifndef MPM_HEXAHEDRON_CPDI_ELEMENT_H_
+#define MPM_HEXAHEDRON_CPDI_ELEMENT_H_
+
+#include <atomic>
+
+#include "cpdi_basis.h"
+#include "gimp_basis.h"
+#include "hexahedron_element.h"
+
+namespace mpm {
+
+//! Hexahedron CPDI element class derived from Hexahedron
+//! \brief Hexahedron CPDI element
+//! \details 64-noded hexahedron CPDI1 element for particles with a
+//! parallelepiped domain, spanned by the half lengths of the particle mapped
+//! by its deformation gradient. Evaluated from the linear shape functions of
+//! the four nodes along each axis at the corners of the domain. The eight
+//! corners of the cell come first, ordered as the 8-noded hexahedron,
+//! followed by the other nodes of the 4 x 4 x 4 stencil ordered by z, y and
+//! x natural coordinates \n
+//!
+template <unsigned Tdim, unsigned Tnfunctions>
+class HexahedronCPDIElement : public HexahedronElement<3, 8> {
+
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! constructor with number of shape functions
+  HexahedronCPDIElement() : HexahedronElement<3, 8>() {
+    static_assert(Tdim == 3, "Invalid dimension for a CPDI element");
+    static_assert((Tnfunctions == 64),
+                  "Specified number of shape functions is not defined");
+
+    //! Logger
+    std::string logger = "hexahedron_cpdi::<" + std::to_string(Tdim) +
+                         ", " + std::to_string(Tnfunctions) + ">";
+    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  }
+
+  //! Evaluate shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                          const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate local shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval shapefn Shape function of a given cell
+  Eigen::VectorXd shapefn_local(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate gradient of shape functions
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval grad_shapefn Gradient of shape function of a given cell
+  Eigen::MatrixXd grad_shapefn(
+      const VectorDim& xi, const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate shape functions and their gradient in place
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Size of the particle domain
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void shapefn_grad_shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                            const VectorDim& deformation_gradient,
+                            Eigen::VectorXd* shapefn,
+                            Eigen::MatrixXd* grad_shapefn) const override;
+
+  //! Evaluate shape functions and their gradient of a particle domain in
+  //! place
+  //! \param[in] xi given local coordinates
+  //! \param[in] domain Half vectors spanning the particle domain as columns,
+  //! in natural coordinates
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void domain_shapefn_grad_shapefn(
+      const VectorDim& xi, const Eigen::Matrix<double, Tdim, Tdim>& domain,
+      Eigen::VectorXd* shapefn, Eigen::MatrixXd* grad_shapefn) const override;
+
+  //! Compute Jacobian
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval jacobian Jacobian matrix
+  Eigen::Matrix<double, Tdim, Tdim> jacobian(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Compute Jacobian local
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval jacobian Jacobian matrix
+  Eigen::Matrix<double, Tdim, Tdim> jacobian_local(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Evaluate the B matrix at given local coordinates for a real cell
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \retval bmatrix B matrix
+  std::vector<Eigen::MatrixXd> bmatrix(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      const VectorDim& particle_size,
+      const VectorDim& deformation_gradient) const override;
+
+  //! Return the type of shape function
+  mpm::ShapefnType shapefn_type() const override {
+    return mpm::ShapefnType::CPDI;
+  }
+
+  //! Return number of shape functions
+  unsigned nfunctions() const override { return Tnfunctions; }
+
+  //! Return if natural coordinates can be evaluates
+  bool isvalid_natural_coordinates_analytical() const override { return false; }
+
+  //! Compute Natural coordinates of a point (analytical)
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] point Location of the point in cell
+  //! \retval xi Return the local coordinates
+  VectorDim natural_coordinates_analytical(
+      const VectorDim& point,
+      const Eigen::MatrixXd& nodal_coordinates) const override;
+
+  //! Return natural nodal coordinates
+  const Eigen::MatrixXd& natural_nodal_coordinates() const override;
+
+ private:
+  //! Evaluate shape functions and gradients of a particle domain with the
+  //! fixed size of the element
+  //! \param[in] xi given local coordinates
+  //! \param[in] domain Half vectors spanning the particle domain as columns,
+  //! in natural coordinates
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void domain_weights(
+      const VectorDim& xi, const Eigen::Matrix<double, Tdim, Tdim>& domain,
+      Eigen::Matrix<double, Tnfunctions, 1>* shapefn,
+      Eigen::Matrix<double, Tnfunctions, Tdim>* grad_shapefn) const;
+
+  //! Return the axis indices (0-3) of the nodes along each dimension
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& node_axes() const;
+
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+  //! A particle domain has been shrunk to the nodes of the element
+  mutable std::atomic<bool> clamped_{false};
+};
+
+}  // namespace mpm
+#include "hexahedron_cpdi_element.tcc"
+
+#endif  // MPM_HEXAHEDRON_CPDI_ELEMENT_H_
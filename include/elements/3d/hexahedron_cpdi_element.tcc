@@ -0,0 +1,235 @@
+// Return natural nodal coordinates
+template <unsigned Tdim, unsigned Tnfunctions>
+inline const Eigen::MatrixXd& mpm::HexahedronCPDIElement<
+    Tdim, Tnfunctions>::natural_nodal_coordinates() const {
+  //! Natural coordinates of nodes
+  static const Eigen::MatrixXd local_nodes = [this]() {
+    Eigen::Matrix<double, Tnfunctions, Tdim> nodes;
+    // Corners of the cell
+    const unsigned ncorners = 8;
+    nodes.topRows(ncorners) = this->unit_cell_coordinates();
+    // Remaining nodes of the stencil
+    unsigned node = ncorners;
+    for (int k = -3; k <= 3; k += 2)
+      for (int j = -3; j <= 3; j += 2)
+        for (int i = -3; i <= 3; i += 2)
+          if (std::abs(i) != 1 || std::abs(j) != 1 || std::abs(k) != 1) {
+            nodes.row(node) << i, j, k;
+            ++node;
+          }
+    return nodes;
+  }();
+  return local_nodes;
+}
+
+// Return the axis indices of the nodes
+template <unsigned Tdim, unsigned Tnfunctions>
+inline const std::array<std::array<unsigned, Tdim>, Tnfunctions>&
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::node_axes() const {
+  static const std::array<std::array<unsigned, Tdim>, Tnfunctions> axes =
+      mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+          this->natural_nodal_coordinates());
+  return axes;
+}
+
+//! Evaluate shape functions and gradients of a particle domain with the fixed
+//! size of the 64-node Hexahedron CPDI Element
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::domain_weights(
+    const VectorDim& xi, const Eigen::Matrix<double, Tdim, Tdim>& domain,
+    Eigen::Matrix<double, Tnfunctions, 1>* shapefn,
+    Eigen::Matrix<double, Tnfunctions, Tdim>* grad_shapefn) const {
+  // Domain within the nodes of the element
+  Eigen::Matrix<double, Tdim, Tdim> support = domain;
+  if (mpm::cpdi::clamp_domain<Tdim>(&support) && !clamped_.exchange(true))
+    console_->warn(
+        "CPDI particle domain extends beyond the nodes around its cell and "
+        "is shrunk; later domains shrunk are not reported");
+
+  if (!mpm::cpdi::domain_weights<Tdim, Tnfunctions>(
+          xi, support, this->node_axes(), shapefn, grad_shapefn)) {
+    console_->error("{} #{}: CPDI shapefn: Invalid local coordinates\n",
+                    __FILE__, __LINE__);
+    shapefn->setZero();
+    grad_shapefn->setZero();
+  }
+}
+
+//! Return shape functions of a 64-node Hexahedron CPDI Element at a
+//! given local coordinate, for a domain of the particle size along the axes
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::shapefn(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn;
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
+  this->domain_weights(xi, (0.5 * particle_size).asDiagonal(), &shapefn,
+                       &grad_shapefn);
+  return shapefn;
+}
+
+//! Return gradient of shape functions of a 64-node Hexahedron CPDI
+//! Element at a given local coordinate, for a domain of the particle size
+//! along the axes
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::grad_shapefn(
+        const Eigen::Matrix<double, Tdim, 1>& xi,
+        const Eigen::Matrix<double, Tdim, 1>& particle_size,
+        const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
+  Eigen::Matrix<double, Tnfunctions, 1> shapefn;
+  Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
+  this->domain_weights(xi, (0.5 * particle_size).asDiagonal(), &shapefn,
+                       &grad_shapefn);
+  return grad_shapefn;
+}
+
+//! Evaluate shape functions and gradients of a 64-node Hexahedron CPDI
+//! Element in place, for a domain of the particle size along the axes
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient, Eigen::VectorXd* shapefn,
+        Eigen::MatrixXd* grad_shapefn) const {
+  this->domain_shapefn_grad_shapefn(xi, (0.5 * particle_size).asDiagonal(),
+                                    shapefn, grad_shapefn);
+}
+
+//! Evaluate shape functions and gradients of a particle domain of a
+//! 64-node Hexahedron CPDI Element in place, without allocating when the
+//! storage has the right size
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::domain_shapefn_grad_shapefn(
+        const VectorDim& xi, const Eigen::Matrix<double, Tdim, Tdim>& domain,
+        Eigen::VectorXd* shapefn, Eigen::MatrixXd* grad_shapefn) const {
+  Eigen::Matrix<double, Tnfunctions, 1> fixed_shapefn;
+  Eigen::Matrix<double, Tnfunctions, Tdim> fixed_grad_shapefn;
+  this->domain_weights(xi, domain, &fixed_shapefn, &fixed_grad_shapefn);
+  shapefn->resize(Tnfunctions);
+  grad_shapefn->resize(Tnfunctions, Tdim);
+  *shapefn = fixed_shapefn;
+  *grad_shapefn = fixed_grad_shapefn;
+}
+
+//! Return the B-matrix of a Hexahedron CPDI Element at a given local
+//! coordinate for a real cell
+template <unsigned Tdim, unsigned Tnfunctions>
+inline std::vector<Eigen::MatrixXd>
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::bmatrix(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+
+  // Get gradient shape functions
+  Eigen::MatrixXd grad_sf =
+      this->grad_shapefn(xi, particle_size, deformation_gradient);
+
+  // B-Matrix
+  std::vector<Eigen::MatrixXd> bmatrix;
+  bmatrix.reserve(Tnfunctions);
+
+  try {
+    // Check if matrices dimensions are correct
+    if ((grad_sf.rows() != nodal_coordinates.rows()) ||
+        (xi.rows() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "BMatrix - Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return bmatrix;
+  }
+
+  // Jacobian dx_i/dxi_j
+  Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      (grad_sf.transpose() * nodal_coordinates);
+
+  // Gradient shapefn of the cell
+  // dN/dx = [J]^-1 * dN/dxi
+  Eigen::MatrixXd grad_shapefn = grad_sf * (jacobian.inverse()).transpose();
+
+  for (unsigned i = 0; i < Tnfunctions; ++i) {
+    // clang-format off
+    Eigen::Matrix<double, 6, Tdim> bi;
+    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;                 bi(0, 2) = 0.;
+    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1); bi(1, 2) = 0.;
+    bi(2, 0) = 0.;                 bi(2, 1) = 0.;                 bi(2, 2) = grad_shapefn(i, 2);
+    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0); bi(3, 2) = 0.;
+    bi(4, 0) = 0.;                 bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
+    bi(5, 0) = grad_shapefn(i, 2); bi(5, 1) = 0.;                 bi(5, 2) = grad_shapefn(i, 0);
+    // clang-format on
+    bmatrix.push_back(bi);
+  }
+  return bmatrix;
+}
+
+//! Return local shape functions of a CPDI Hexahedron Element at a given
+//! local coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::shapefn_local(
+        const VectorDim& xi, const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  return mpm::HexahedronElement<Tdim, 8>::shapefn(xi, particle_size,
+                                                  deformation_gradient);
+}
+
+//! Compute Jacobian with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::Matrix<double, Tdim, Tdim>
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::jacobian(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+
+  // Get gradient shape functions
+  const Eigen::MatrixXd grad_shapefn =
+      this->grad_shapefn(xi, particle_size, deformation_gradient);
+
+  try {
+    // Check if matrices dimensions are correct
+    if ((grad_shapefn.rows() != nodal_coordinates.rows()) ||
+        (xi.size() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return Eigen::Matrix<double, Tdim, Tdim>::Zero();
+  }
+
+  // Jacobian dx_i/dxi_j
+  return (grad_shapefn.transpose() * nodal_coordinates);
+}
+
+//! Compute Jacobian local with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::Matrix<double, Tdim, Tdim>
+    mpm::HexahedronCPDIElement<Tdim, Tnfunctions>::jacobian_local(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        const VectorDim& particle_size,
+        const VectorDim& deformation_gradient) const {
+  // Jacobian dx_i/dxi_j
+  return mpm::HexahedronElement<3, 8>::jacobian(
+      xi, nodal_coordinates, particle_size, deformation_gradient);
+}
+
+//! Compute natural coordinates of a point (analytical)
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::Matrix<double, Tdim, 1> mpm::HexahedronCPDIElement<
+    Tdim, Tnfunctions>::natural_coordinates_analytical(const VectorDim& point,
+                                                       const Eigen::MatrixXd&
+                                                           nodal_coordinates)
+    const {
+  // Local point coordinates
+  Eigen::Matrix<double, 3, 1> xi;
+  xi.fill(std::numeric_limits<double>::max());
+  throw std::runtime_error(
+      "Analytical solution for HexCPDI<Tdim, Tnfunctions> has not been "
+      "implemented");
+  return xi;
+}
@@ -149,6 +149,17 @@ class HexahedronElement : public Element<Tdim> {
       const VectorDim& xi, const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions and their gradient in place
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void shapefn_grad_shapefn(const VectorDim& xi, const VectorDim& particle_size,
+                            const VectorDim& deformation_gradient,
+                            Eigen::VectorXd* shapefn,
+                            Eigen::MatrixXd* grad_shapefn) const override;
+
   //! Compute Jacobian
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -217,25 +228,25 @@ class HexahedronElement : public Element<Tdim> {
   }
 
   //! Return nodal coordinates of a unit cell
-  Eigen::MatrixXd unit_cell_coordinates() const override;
+  const Eigen::MatrixXd& unit_cell_coordinates() const override;
 
   //! Return the side indices of a cell to calculate the cell length
   //! \retval indices Outer-indices that form the sides of the cell
-  Eigen::MatrixXi sides_indices() const override;
+  const Eigen::MatrixXi& sides_indices() const override;
 
   //! Return the corner indices of a cell to calculate the cell volume
   //! \retval indices Outer-indices that form the cell
-  Eigen::VectorXi corner_indices() const override;
+  const Eigen::VectorXi& corner_indices() const override;
 
   //! Return indices of a sub-tetrahedrons in a volume
   //! to check if a point is inside /outside of a hedron
   //! \retval indices Indices that form sub-tetrahedrons
-  Eigen::MatrixXi inhedron_indices() const override;
+  const Eigen::MatrixXi& inhedron_indices() const override;
 
   //! Return indices of a face of an element
   //! \param[in] face_id given id of the face
   //! \retval indices Indices that make the face
-  Eigen::VectorXi face_indices(unsigned face_id) const override;
+  const Eigen::VectorXi& face_indices(unsigned face_id) const override;
 
   //! Return the number of faces in a hexahedron
   unsigned nfaces() const override { return 6; }
@@ -265,6 +276,16 @@ class HexahedronElement : public Element<Tdim> {
       const Eigen::MatrixXd& nodal_coordinates) const override;
 
  private:
+  //! Evaluate shape functions with the fixed size of the element
+  //! \param[in] xi given local coordinates
+  Eigen::Matrix<double, Tnfunctions, 1> fixed_shapefn(
+      const VectorDim& xi) const;
+
+  //! Evaluate gradient of shape functions with the fixed size of the element
+  //! \param[in] xi given local coordinates
+  Eigen::Matrix<double, Tnfunctions, Tdim> fixed_grad_shapefn(
+      const VectorDim& xi) const;
+
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
@@ -12,15 +12,13 @@
 //!       0_ _ _ _ _ _ 0
 //!     4               5
 
-//! Return shape function of a 8-noded hexahedron, with particle size and
-//! deformation gradient
-//! \param[in] xi Coordinates of point of interest \retval
-//! shapefn Shape function of a given cell
+//! Return shape function of a 8-noded hexahedron
+//! \param[in] xi Coordinates of point of interest
+//! \retval shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::HexahedronElement<3, 8>::fixed_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   // 8-noded
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = 0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2));
@@ -34,15 +32,13 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
   return shapefn;
 }
 
-//! Return gradient of shape functions of a 8-noded hexahedron, with particle
-//! size and deformation gradient
+//! Return gradient of shape functions of a 8-noded hexahedron
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 8, 3>
+    mpm::HexahedronElement<3, 8>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 8, 3> grad_shapefn;
   grad_shapefn(0, 0) = -0.125 * (1 - xi(1)) * (1 - xi(2));
   grad_shapefn(1, 0) = 0.125 * (1 - xi(1)) * (1 - xi(2));
@@ -75,20 +71,20 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::grad_shapefn(
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::HexahedronElement<3, 8>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 8, 3> unit_cell;
   // clang-format off
-  unit_cell << -1., -1., -1.,
-                1., -1., -1.,
-                1.,  1., -1.,
-               -1.,  1., -1.,
-               -1., -1.,  1.,
-                1., -1.,  1.,
-                1.,  1.,  1.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 8, 3>() << -1., -1., -1.,
+                                         1., -1., -1.,
+                                         1.,  1., -1.,
+                                        -1.,  1., -1.,
+                                        -1., -1.,  1.,
+                                         1., -1.,  1.,
+                                         1.,  1.,  1.,
     // cppcheck-suppress *
-               -1.,  1.,  1.;
+                                        -1.,  1.,  1.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -109,15 +105,13 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::unit_cell_coordinates()
 //!       0_ _ _ 0 _ _ _ 0
 //!     4        16         5
 
-//! Return the shape function of a 20-noded hexahedron, with particle
-//! size and deformation gradient
+//! Return the shape function of a 20-noded hexahedron
 //! \param[in] xi Coordinates of point of interest
 //! \retval shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 20, 1>
+    mpm::HexahedronElement<3, 20>::fixed_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 20, 1> shapefn;
   shapefn(0) = -0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2)) *
                (2 + xi(0) + xi(1) + xi(2));
@@ -151,15 +145,13 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
   return shapefn;
 }
 
-//! Return gradient of shape functions of a 20-noded hexahedron, with particle
-//! size and deformation gradient
+//! Return gradient of shape functions of a 20-noded hexahedron
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi,
-    const Eigen::Matrix<double, 3, 1>& particle_size,
-    const Eigen::Matrix<double, 3, 1>& deformation_gradient) const {
+inline Eigen::Matrix<double, 20, 3>
+    mpm::HexahedronElement<3, 20>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 20, 3> grad_shapefn;
 
   grad_shapefn(0, 0) =
@@ -251,6 +243,43 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
   return grad_shapefn;
 }
 
+//! Return shape functions of a Hexahedron Element at a given local coordinate,
+//! with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::HexahedronElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->fixed_shapefn(xi);
+}
+
+//! Return gradient of shape functions of a Hexahedron Element at a given local
+//! coordinate, with particle size and deformation gradient
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient) const {
+  return this->fixed_grad_shapefn(xi);
+}
+
+//! Evaluate shape functions and gradients of a Hexahedron Element in place,
+//! without allocating when the storage has the right size
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronElement<Tdim, Tnfunctions>::shapefn_grad_shapefn(
+    const VectorDim& xi, const VectorDim& particle_size,
+    const VectorDim& deformation_gradient, Eigen::VectorXd* shapefn,
+    Eigen::MatrixXd* grad_shapefn) const {
+  // Elements derived from this one have shape functions of their own
+  if (this->shapefn_type() != mpm::ShapefnType::NORMAL_MPM) {
+    mpm::Element<Tdim>::shapefn_grad_shapefn(
+        xi, particle_size, deformation_gradient, shapefn, grad_shapefn);
+    return;
+  }
+  shapefn->resize(Tnfunctions);
+  grad_shapefn->resize(Tnfunctions, Tdim);
+  *shapefn = this->fixed_shapefn(xi);
+  *grad_shapefn = this->fixed_grad_shapefn(xi);
+}
+
 //! Return local shape functions of a Hexahedron Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -441,32 +470,32 @@ inline mpm::ElementDegree mpm::HexahedronElement<3, 20>::degree() const {
 
 //! Return nodal coordinates of a unit cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::unit_cell_coordinates()
-    const {
+inline const Eigen::MatrixXd&
+    mpm::HexahedronElement<3, 20>::unit_cell_coordinates() const {
   // Coordinates of a unit cell
-  Eigen::Matrix<double, 20, 3> unit_cell;
   // clang-format off
-  unit_cell << -1., -1., -1.,
-                1., -1., -1.,
-                1.,  1., -1.,
-               -1.,  1., -1.,
-               -1., -1.,  1.,
-                1., -1.,  1.,
-                1.,  1.,  1.,
-               -1.,  1.,  1.,
-                0., -1., -1.,
-               -1.,  0., -1.,
-               -1., -1.,  0.,
-                1.,  0., -1.,
-                1., -1.,  0.,
-                0.,  1., -1.,
-                1.,  1.,  0.,
-               -1.,  1.,  0.,
-                0., -1.,  1.,
-               -1.,  0.,  1.,
-                1.,  0.,  1.,
+  static const Eigen::MatrixXd unit_cell =
+      (Eigen::Matrix<double, 20, 3>() << -1., -1., -1.,
+                                          1., -1., -1.,
+                                          1.,  1., -1.,
+                                         -1.,  1., -1.,
+                                         -1., -1.,  1.,
+                                          1., -1.,  1.,
+                                          1.,  1.,  1.,
+                                         -1.,  1.,  1.,
+                                          0., -1., -1.,
+                                         -1.,  0., -1.,
+                                         -1., -1.,  0.,
+                                          1.,  0., -1.,
+                                          1., -1.,  0.,
+                                          0.,  1., -1.,
+                                          1.,  1.,  0.,
+                                         -1.,  1.,  0.,
+                                          0., -1.,  1.,
+                                         -1.,  0.,  1.,
+                                          1.,  0.,  1.,
     // cppcheck-suppress *
-                0.,  1.,  1.;
+                                          0.,  1.,  1.).finished();
   // clang-format on
   return unit_cell;
 }
@@ -502,23 +531,23 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::unit_cell_coordinates()
 //! \tparam Tdim Dimension
 //! \tparam Tnfunctions Number of shape functions
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi
+inline const Eigen::MatrixXi&
     mpm::HexahedronElement<Tdim, Tnfunctions>::sides_indices() const {
-  Eigen::Matrix<int, 12, 2> indices;
   // clang-format off
-  indices << 0, 1,
-             1, 2,
-             2, 3,
-             3, 0,
-             4, 5,
-             5, 6,
-             6, 7,
-             7, 4,
-             0, 4,
-             1, 5,
-             2, 6,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 12, 2>() << 0, 1,
+                                      1, 2,
+                                      2, 3,
+                                      3, 0,
+                                      4, 5,
+                                      5, 6,
+                                      6, 7,
+                                      7, 4,
+                                      0, 4,
+                                      1, 5,
+                                      2, 6,
     // cppcheck-suppress *
-             3, 7;
+                                      3, 7).finished();
   // clang-format on
   return indices;
 }
@@ -528,11 +557,11 @@ inline Eigen::MatrixXi
 //! \tparam Tdim Dimension
 //! \tparam Tnfunctions Number of shape functions
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::HexahedronElement<Tdim, Tnfunctions>::corner_indices() const {
-  Eigen::Matrix<int, 8, 1> indices;
   // cppcheck-suppress *
-  indices << 0, 1, 2, 3, 4, 5, 6, 7;
+  static const Eigen::VectorXi indices =
+      (Eigen::Matrix<int, 8, 1>() << 0, 1, 2, 3, 4, 5, 6, 7).finished();
   return indices;
 }
 
@@ -540,24 +569,23 @@ inline Eigen::VectorXi
 //! to check if a point is inside /outside of a hedron
 //! \retval indices Indices that form sub-tetrahedrons
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXi
+inline const Eigen::MatrixXi&
     mpm::HexahedronElement<Tdim, Tnfunctions>::inhedron_indices() const {
-  Eigen::Matrix<int, 12, Tdim, Eigen::RowMajor> indices;
-
   // clang-format off
-  indices << 0, 5, 4,
-             0, 1, 5,
-             3, 6, 7,
-             3, 2, 6,
-             2, 1, 6,
-             6, 1, 5,
-             7, 6, 5,
-             5, 4, 7,
-             7, 4, 0,
-             7, 0, 3,
-             3, 0, 1,
+  static const Eigen::MatrixXi indices =
+      (Eigen::Matrix<int, 12, Tdim, Eigen::RowMajor>() << 0, 5, 4,
+                                                          0, 1, 5,
+                                                          3, 6, 7,
+                                                          3, 2, 6,
+                                                          2, 1, 6,
+                                                          6, 1, 5,
+                                                          7, 6, 5,
+                                                          5, 4, 7,
+                                                          7, 4, 0,
+                                                          7, 0, 3,
+                                                          3, 0, 1,
     // cppcheck-suppress *
-             3, 1, 2;
+                                                          3, 1, 2).finished();
   //clang-format on
   return indices;
 }
@@ -565,11 +593,11 @@ inline Eigen::MatrixXi
 //! Return indices of a face of the element
 //! 8-noded hexahedron
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::HexahedronElement<3, 8>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 4, 1>> face_indices_hexahedron{
+  static const std::map<unsigned, Eigen::VectorXi> face_indices_hexahedron{
       {0, Eigen::Matrix<int, 4, 1>(0, 1, 5, 4)},
       {1, Eigen::Matrix<int, 4, 1>(5, 1, 2, 6)},
       {2, Eigen::Matrix<int, 4, 1>(7, 6, 2, 3)},
@@ -583,12 +611,12 @@ inline Eigen::VectorXi
 //! Return indices of a face of the element
 //! 20-noded hexahedron
 template <>
-inline Eigen::VectorXi
+inline const Eigen::VectorXi&
     mpm::HexahedronElement<3, 20>::face_indices(unsigned face_id) const {
   
   //! Face ids and its associated nodal indices
   // clang-format off
-  const std::map<unsigned, Eigen::Matrix<int, 8, 1>> face_indices_hexahedron{
+  static const std::map<unsigned, Eigen::VectorXi> face_indices_hexahedron{
       {0, (Eigen::Matrix<int, 8, 1>() << 0, 1, 5, 4,  8, 12, 16, 10).finished()},
       {1, (Eigen::Matrix<int, 8, 1>() << 5, 1, 2, 6, 12, 11, 14, 18).finished()},
       {2, (Eigen::Matrix<int, 8, 1>() << 7, 6, 2, 3, 19, 14, 13, 15).finished()},
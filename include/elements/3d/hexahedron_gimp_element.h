@@ -1,6 +1,7 @@
 #ifndef MPM_GIMP_HEX_ELEMENT_H_
 #define MPM_GIMP_HEX_ELEMENT_H_
 
+#include "gimp_basis.h"
 #include "hexahedron_element.h"
 
 namespace mpm {
@@ -98,9 +99,12 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
   //! Return number of shape functions
   unsigned nfunctions() const override { return Tnfunctions; }
 
- private:
   //! Return natural nodal coordinates
-  Eigen::MatrixXd natural_nodal_coordinates() const;
+  const Eigen::MatrixXd& natural_nodal_coordinates() const override;
+
+ private:
+  //! Return the axis indices (0-3) of the nodes along each dimension
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& node_axes() const;
 
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
@@ -1,9 +1,9 @@
 // Return natural nodal coordinates
 template <unsigned Tdim, unsigned Tnfunctions>
-inline Eigen::MatrixXd mpm::HexahedronGIMPElement<
+inline const Eigen::MatrixXd& mpm::HexahedronGIMPElement<
     Tdim, Tnfunctions>::natural_nodal_coordinates() const {
   //! Natural coordinates of nodes
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
+  static const Eigen::MatrixXd local_nodes =
       (Eigen::Matrix<double, Tnfunctions, Tdim>() << -1., 1., -1, 1., 1., -1,
        1., 1., 1, -1., 1., 1, -1., -1., -1, 1., -1., -1, 1., -1., 1, -1., -1.,
        1, -3., 3, -3, -1., 3, -3, 1., 3, -3, 3., 3, -3, -3., 3, -1, -1., 3, -1,
@@ -20,6 +20,16 @@ inline Eigen::MatrixXd mpm::HexahedronGIMPElement<
   return local_nodes;
 }
 
+// Return the axis indices of the nodes
+template <unsigned Tdim, unsigned Tnfunctions>
+inline const std::array<std::array<unsigned, Tdim>, Tnfunctions>&
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::node_axes() const {
+  static const std::array<std::array<unsigned, Tdim>, Tnfunctions> axes =
+      mpm::gimp::axis_indices<Tdim, Tnfunctions>(
+          this->natural_nodal_coordinates());
+  return axes;
+}
+
 //! Return shape functions of a 64-node Hexahedron GIMP Element at a given
 //! local coordinate
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -28,54 +38,26 @@ inline Eigen::VectorXd mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn(
     const Eigen::Matrix<double, Tdim, 1>& particle_size,
     const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
+  //! Axis indices of the nodes
+  const auto& axes = this->node_axes();
   //! To store shape functions
   Eigen::Matrix<double, Tnfunctions, 1> shapefn;
 
   try {
-    //! loop to iterate over nodes
-    for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement see: Bardenhagen 2004
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= element_length + lp) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP shapefn: Point location outside area of influence");
-        }
-      }
-      shapefn(n) =
-          sni(0) * sni(1) * sni(2);  // See: Pruijn, N.S., 2016. Eq(4.30)
-    }
+    //! 1D shape functions and gradients of the four nodes along each axis
+    std::array<std::array<double, mpm::gimp::nnodes_axis>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::gimp::axis_weights(xi(i), particle_size(i), &sn[i], &dn[i]))
+        throw std::runtime_error(
+            "GIMP shapefn: Point location outside area of influence");
+
+    //! Tensor product of the 1D shape functions
+    // See: Pruijn, N.S., 2016. Eq(4.30)
+    for (unsigned n = 0; n < Tnfunctions; ++n)
+      shapefn(n) = sn[0][axes[n][0]] * sn[1][axes[n][1]] * sn[2][axes[n][2]];
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    shapefn.setZero();
     return shapefn;
   }
   return shapefn;
@@ -90,66 +72,31 @@ inline Eigen::MatrixXd
         const Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, 1>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
+  //! Axis indices of the nodes
+  const auto& axes = this->node_axes();
   //! To store grad shape functions
   Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
   try {
-    //! loop to iterate over nodes
-    for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! local grad shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> dni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement
-        // see: Pruijn, N.S., 2016. Eq(4.30)
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
+    //! 1D shape functions and gradients of the four nodes along each axis
+    std::array<std::array<double, mpm::gimp::nnodes_axis>, Tdim> sn, dn;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (!mpm::gimp::axis_weights(xi(i), particle_size(i), &sn[i], &dn[i]))
+        throw std::runtime_error(
+            "GIMP grad shapefn: Point location outside area of influence");
 
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-          dni(i) = (element_length + lp + npni) / (2. * element_length * lp);
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-          dni(i) = 1. / element_length;
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-          dni(i) = -(npni / (element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-          dni(i) = -(1. / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= (element_length + lp)) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-          dni(i) = -((element_length + lp - npni) / (2. * element_length * lp));
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP grad shapefn: Point location outside area of influence");
-        }
-      }
-      // see: Pruijn, N.S., 2016. Eq(4.32)
-      grad_shapefn(n, 0) = dni(0) * sni(1) * sni(2);
-      grad_shapefn(n, 1) = sni(0) * dni(1) * sni(2);
-      grad_shapefn(n, 2) = sni(0) * sni(1) * dni(2);
+    //! Tensor product of the 1D shape functions and gradients
+    // see: Pruijn, N.S., 2016. Eq(4.32)
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      const unsigned ax = axes[n][0];
+      const unsigned ay = axes[n][1];
+      const unsigned az = axes[n][2];
+      grad_shapefn(n, 0) = dn[0][ax] * sn[1][ay] * sn[2][az];
+      grad_shapefn(n, 1) = sn[0][ax] * dn[1][ay] * sn[2][az];
+      grad_shapefn(n, 2) = sn[0][ax] * sn[1][ay] * dn[2][az];
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    grad_shapefn.setZero();
     return grad_shapefn;
   }
   return grad_shapefn;
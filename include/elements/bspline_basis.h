@@ -0,0 +1,80 @@
+#ifndef MPM_BSPLINE_BASIS_H_
+#define MPM_BSPLINE_BASIS_H_
+
+#include <array>
+#include <cmath>
+
+namespace mpm {
+namespace bspline {
+
+//! Number of nodes influencing a point along each axis
+const unsigned nnodes_axis = 4;
+
+//! Evaluate a uniform B-spline and its derivative centred at a node
+//! \details Quadratic (support 3 cells) and cubic (support 4 cells) B-splines,
+//! see: Steffen, M. et al., 2008. Int. J. Numer. Meth. Eng. 76, 922-948
+//! \tparam Tpolynomial Polynomial order (2 or 3)
+//! \param[in] r Distance from the node in number of cells
+//! \param[out] sni Shape function
+//! \param[out] dni Derivative of the shape function with respect to r
+template <unsigned Tpolynomial>
+inline void weight(double r, double* sni, double* dni);
+
+//! Quadratic B-spline
+template <>
+inline void weight<2>(double r, double* sni, double* dni) {
+  const double distance = std::fabs(r);
+  const double sign = (r < 0.) ? -1. : 1.;
+  if (distance <= 0.5) {
+    *sni = 0.75 - r * r;
+    *dni = -2. * r;
+  } else if (distance <= 1.5) {
+    const double remainder = 1.5 - distance;
+    *sni = 0.5 * remainder * remainder;
+    *dni = -sign * remainder;
+  } else {
+    *sni = 0.;
+    *dni = 0.;
+  }
+}
+
+//! Cubic B-spline
+template <>
+inline void weight<3>(double r, double* sni, double* dni) {
+  const double distance = std::fabs(r);
+  if (distance <= 1.) {
+    *sni = 2. / 3. - r * r + 0.5 * distance * distance * distance;
+    *dni = -2. * r + 1.5 * r * distance;
+  } else if (distance <= 2.) {
+    const double remainder = 2. - distance;
+    *sni = remainder * remainder * remainder / 6.;
+    *dni = ((r < 0.) ? 0.5 : -0.5) * remainder * remainder;
+  } else {
+    *sni = 0.;
+    *dni = 0.;
+  }
+}
+
+//! Evaluate the 1D B-spline shape functions and gradients of the four nodes
+//! along an axis, located at natural coordinates -3, -1, 1 and 3
+//! \tparam Tpolynomial Polynomial order (2 or 3)
+//! \param[in] xi Local coordinate of the point along the axis
+//! \param[out] sn Shape functions of the four nodes
+//! \param[out] dn Gradients of the shape functions with respect to xi
+//! \retval status False if the local coordinate is not a number
+template <unsigned Tpolynomial>
+inline bool axis_weights(double xi, std::array<double, nnodes_axis>* sn,
+                         std::array<double, nnodes_axis>* dn) {
+  if (std::isnan(xi)) return false;
+  // Cells are 2 units long in natural coordinates
+  for (unsigned a = 0; a < nnodes_axis; ++a) {
+    weight<Tpolynomial>(0.5 * (xi - (2. * a - 3.)), &(*sn)[a], &(*dn)[a]);
+    (*dn)[a] *= 0.5;
+  }
+  return true;
+}
+
+}  // namespace bspline
+}  // namespace mpm
+
+#endif  // MPM_BSPLINE_BASIS_H_
@@ -0,0 +1,156 @@
+#ifndef MPM_CPDI_BASIS_H_
+#define MPM_CPDI_BASIS_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "Eigen/Dense"
+
+namespace mpm {
+namespace cpdi {
+
+//! Number of nodes influencing a particle domain along each axis
+const unsigned nnodes_axis = 4;
+
+//! Maximum half length of a particle domain in natural coordinates, which
+//! keeps the corners of the domain of a particle in the cell within the
+//! support of the four nodes along an axis
+const double max_half_length = 2.;
+
+//! Evaluate the linear shape function of a node
+//! \param[in] distance Distance from the node in natural coordinates
+inline double linear(double distance) {
+  return std::max(0., 1. - 0.5 * std::fabs(distance));
+}
+
+//! Evaluate the 1D CPDI shape functions and gradients of the four nodes along
+//! an axis, located at natural coordinates -3, -1, 1 and 3
+//! \details Shape functions are the average of the linear shape functions at
+//! the two ends of the particle domain, and gradients their difference over
+//! the domain length. For a rectangular domain aligned with the axes, their
+//! tensor product is the CPDI1 shape function
+//! \param[in] xi Local coordinate of the particle along the axis
+//! \param[in] domain_size Size of the particle domain in local coordinates
+//! \param[out] sn Shape functions of the four nodes
+//! \param[out] dn Gradients of the shape functions of the four nodes
+//! \retval status False if the local coordinate or domain is not a number
+inline bool axis_weights(double xi, double domain_size,
+                         std::array<double, nnodes_axis>* sn,
+                         std::array<double, nnodes_axis>* dn) {
+  if (std::isnan(xi) || std::isnan(domain_size)) return false;
+
+  const double lp =
+      std::min(0.5 * std::fabs(domain_size), cpdi::max_half_length);
+  if (lp > 0.) {
+    for (unsigned a = 0; a < nnodes_axis; ++a) {
+      const double node = 2. * a - 3.;
+      const double lower = linear(xi - lp - node);
+      const double upper = linear(xi + lp - node);
+      (*sn)[a] = 0.5 * (lower + upper);
+      (*dn)[a] = (upper - lower) / (2. * lp);
+    }
+  } else {
+    // A point particle has the linear shape functions of the cell
+    for (unsigned a = 0; a < nnodes_axis; ++a)
+      (*sn)[a] = linear(xi - (2. * a - 3.));
+    (*dn) = {0., -0.5, 0.5, 0.};
+  }
+  return true;
+}
+
+//! Shrink the half vectors spanning a particle domain along the axes on
+//! which the domain exceeds the maximum half length
+//! \param[in,out] domain Half vectors of the domain as columns, in natural
+//! coordinates
+//! \retval clamped True if the domain is shrunk
+template <unsigned Tdim>
+inline bool clamp_domain(Eigen::Matrix<double, Tdim, Tdim>* domain) {
+  bool clamped = false;
+  for (unsigned i = 0; i < Tdim; ++i) {
+    // Half extent of the domain along the axis
+    const double extent = domain->row(i).cwiseAbs().sum();
+    if (extent > cpdi::max_half_length) {
+      domain->row(i) *= cpdi::max_half_length / extent;
+      clamped = true;
+    }
+  }
+  return clamped;
+}
+
+//! Evaluate the CPDI1 shape functions and gradients of the nodes of an element
+//! \details The particle domain is the parallelogram, or parallelepiped in
+//! 3D, spanned by its half vectors around the particle, which are the
+//! undeformed half lengths of the particle mapped by its deformation
+//! gradient. Shape functions are the average of the linear shape functions of
+//! a node at the corners of the domain. Gradients are the mean over the
+//! domain of the gradient of their multilinear interpolation between the
+//! corners (Sadeghirad, A. et al., 2011. Int. J. Numer. Meth. Eng. 86,
+//! 1435-1456). A particle with a degenerate domain has the linear shape
+//! functions of the cell
+//! \param[in] xi Local coordinates of the particle
+//! \param[in] domain Half vectors of the domain as columns, in natural
+//! coordinates, within the maximum half length along each axis
+//! \param[in] axes Axis indices (0-3) of the nodes along each dimension
+//! \param[out] shapefn Shape functions of the nodes
+//! \param[out] grad_shapefn Gradients of the shape functions of the nodes
+//! \retval status False if the local coordinates or domain are not a number
+template <unsigned Tdim, unsigned Tnfunctions>
+inline bool domain_weights(
+    const Eigen::Matrix<double, Tdim, 1>& xi,
+    const Eigen::Matrix<double, Tdim, Tdim>& domain,
+    const std::array<std::array<unsigned, Tdim>, Tnfunctions>& axes,
+    Eigen::Matrix<double, Tnfunctions, 1>* shapefn,
+    Eigen::Matrix<double, Tnfunctions, Tdim>* grad_shapefn) {
+  if (xi.hasNaN() || domain.hasNaN()) return false;
+
+  //! 1D shape functions and gradients of the four nodes along each axis
+  std::array<std::array<double, nnodes_axis>, Tdim> sn, dn;
+  const double volume = domain.determinant();
+  if (std::fabs(volume) <= std::numeric_limits<double>::epsilon() *
+                               std::pow(domain.norm(), Tdim)) {
+    // Tensor product of the linear shape functions and gradients at xi
+    for (unsigned i = 0; i < Tdim; ++i) axis_weights(xi(i), 0., &sn[i], &dn[i]);
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      (*shapefn)(n) = 1.;
+      for (unsigned i = 0; i < Tdim; ++i) {
+        (*shapefn)(n) *= sn[i][axes[n][i]];
+        (*grad_shapefn)(n, i) = dn[i][axes[n][i]];
+        for (unsigned j = 0; j < Tdim; ++j)
+          if (j != i) (*grad_shapefn)(n, i) *= sn[j][axes[n][j]];
+      }
+    }
+    return true;
+  }
+
+  // Average of the shape functions at the corners, and of their products
+  // with the signs of the half vectors to the corners
+  constexpr unsigned ncorners = 1u << Tdim;
+  const double weight = 1. / ncorners;
+  shapefn->setZero();
+  grad_shapefn->setZero();
+  for (unsigned c = 0; c < ncorners; ++c) {
+    Eigen::Matrix<double, Tdim, 1> sign;
+    for (unsigned i = 0; i < Tdim; ++i) sign(i) = ((c >> i) & 1u) ? 1. : -1.;
+    const Eigen::Matrix<double, Tdim, 1> corner = xi + domain * sign;
+    for (unsigned i = 0; i < Tdim; ++i)
+      for (unsigned a = 0; a < nnodes_axis; ++a)
+        sn[i][a] = linear(corner(i) - (2. * a - 3.));
+    for (unsigned n = 0; n < Tnfunctions; ++n) {
+      double corner_shapefn = weight;
+      for (unsigned i = 0; i < Tdim; ++i) corner_shapefn *= sn[i][axes[n][i]];
+      (*shapefn)(n) += corner_shapefn;
+      grad_shapefn->row(n) += corner_shapefn * sign.transpose();
+    }
+  }
+  // Gradients with respect to the local coordinates
+  const Eigen::Matrix<double, Tdim, Tdim> inverse = domain.inverse();
+  *grad_shapefn = (*grad_shapefn * inverse).eval();
+  return true;
+}
+
+}  // namespace cpdi
+}  // namespace mpm
+
+#endif  // MPM_CPDI_BASIS_H_
@@ -17,7 +17,7 @@ namespace mpm {
 enum ElementDegree { Linear = 1, Quadratic = 2 };
 
 // Element Shapefn
-enum ShapefnType { NORMAL_MPM = 1, GIMP = 2, CPDI = 3 };
+enum ShapefnType { NORMAL_MPM = 1, GIMP = 2, CPDI = 3, BSPLINE = 4 };
 
 //! Base class of shape functions
 //! \brief Base class that stores the information about shape functions
@@ -62,6 +62,41 @@ class Element {
       const VectorDim& xi, const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const = 0;
 
+  //! Evaluate shape functions and their gradient in place
+  //! \details Elements that evaluate both together without allocating
+  //! override this; storage is resized when needed
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  virtual void shapefn_grad_shapefn(const VectorDim& xi,
+                                    const VectorDim& particle_size,
+                                    const VectorDim& deformation_gradient,
+                                    Eigen::VectorXd* shapefn,
+                                    Eigen::MatrixXd* grad_shapefn) const {
+    *shapefn = this->shapefn(xi, particle_size, deformation_gradient);
+    *grad_shapefn =
+        this->grad_shapefn(xi, particle_size, deformation_gradient);
+  }
+
+  //! Evaluate shape functions and their gradient of a particle domain in
+  //! place
+  //! \details Elements with shape functions of a deformed particle domain
+  //! override this; others take the domain as its extent along the axes
+  //! \param[in] xi given local coordinates
+  //! \param[in] domain Half vectors spanning the particle domain as columns,
+  //! in natural coordinates
+  //! \param[out] shapefn Shape functions
+  //! \param[out] grad_shapefn Gradient of shape functions
+  virtual void domain_shapefn_grad_shapefn(
+      const VectorDim& xi, const Eigen::Matrix<double, Tdim, Tdim>& domain,
+      Eigen::VectorXd* shapefn, Eigen::MatrixXd* grad_shapefn) const {
+    const VectorDim particle_size = 2. * domain.cwiseAbs().rowwise().sum();
+    this->shapefn_grad_shapefn(xi, particle_size, VectorDim::Zero(), shapefn,
+                               grad_shapefn);
+  }
+
   //! Compute Jacobian
   //! \param[in] xi given local coordinates
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
@@ -126,25 +161,32 @@ class Element {
   virtual mpm::ShapefnType shapefn_type() const = 0;
 
   //! Return nodal coordinates of a unit cell
-  virtual Eigen::MatrixXd unit_cell_coordinates() const = 0;
+  virtual const Eigen::MatrixXd& unit_cell_coordinates() const = 0;
+
+  //! Return natural coordinates of the nodes of the element
+  //! \details Includes the nodes beyond the unit cell for elements such as
+  //! GIMP and B-splines, whose corner nodes come first
+  virtual const Eigen::MatrixXd& natural_nodal_coordinates() const {
+    return this->unit_cell_coordinates();
+  }
 
   //! Return the side indices of a cell to calculate the cell length
   //! \retval indices Outer-indices that form the sides of the cell
-  virtual Eigen::MatrixXi sides_indices() const = 0;
+  virtual const Eigen::MatrixXi& sides_indices() const = 0;
 
   //! Return the corner indices of a cell to calculate the cell volume
   //! \retval indices Outer-indices that form the cell
-  virtual Eigen::VectorXi corner_indices() const = 0;
+  virtual const Eigen::VectorXi& corner_indices() const = 0;
 
   //! Return indices of a sub-tetrahedrons in a volume
   //! to check if a point is inside /outside of a hedron
   //! \retval indices Indices that form sub-tetrahedrons
-  virtual Eigen::MatrixXi inhedron_indices() const = 0;
+  virtual const Eigen::MatrixXi& inhedron_indices() const = 0;
 
   //! Return indices of a face of an element
   //! \param[in] face_id given id of the face
   //! \retval indices Indices that make the face
-  virtual Eigen::VectorXi face_indices(unsigned face_id) const = 0;
+  virtual const Eigen::VectorXi& face_indices(unsigned face_id) const = 0;
 
   //! Return number of faces
   virtual unsigned nfaces() const = 0;
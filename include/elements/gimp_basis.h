@@ -0,0 +1,96 @@
+#ifndef MPM_GIMP_BASIS_H_
+#define MPM_GIMP_BASIS_H_
+
+#include <array>
+#include <cmath>
+
+#include "Eigen/Dense"
+
+namespace mpm {
+namespace gimp {
+
+//! Number of nodes influencing a particle along each axis
+const unsigned nnodes_axis = 4;
+
+//! Return the axis index (0-3) of a node with natural coordinate -3, -1, 1, 3
+//! \param[in] natural_coordinate Natural coordinate of the node along an axis
+inline unsigned axis_index(double natural_coordinate) {
+  return static_cast<unsigned>((natural_coordinate + 3.) * 0.5);
+}
+
+//! Return the axis indices (0-3) of each node of a GIMP element
+//! \param[in] natural_nodal_coordinates Natural coordinates of the nodes
+//! \retval axes Axis indices of each node along each dimension
+template <unsigned Tdim, unsigned Tnfunctions>
+inline std::array<std::array<unsigned, Tdim>, Tnfunctions> axis_indices(
+    const Eigen::MatrixXd& natural_nodal_coordinates) {
+  std::array<std::array<unsigned, Tdim>, Tnfunctions> axes;
+  for (unsigned n = 0; n < Tnfunctions; ++n)
+    for (unsigned i = 0; i < Tdim; ++i)
+      axes[n][i] = axis_index(natural_nodal_coordinates(n, i));
+  return axes;
+}
+
+//! Evaluate the 1D GIMP shape function and its gradient of a node
+//! \details Conditional shape function, see: Bardenhagen 2004 and Pruijn,
+//! N.S., 2016. Eq(4.30)
+//! \param[in] npni Local particle coordinate minus local node coordinate
+//! \param[in] lp Half of the particle size in local coordinates
+//! \param[out] sni Shape function
+//! \param[out] dni Gradient of the shape function
+//! \retval status False if the point is outside the area of influence
+inline bool weight(double npni, double lp, double* sni, double* dni) {
+  //! length of element in local coordinate
+  const double element_length = 2.;
+
+  if (npni <= (-element_length - lp)) {
+    *sni = 0.;
+    *dni = 0.;
+  } else if (npni <= (-element_length + lp)) {
+    const double distance = element_length + lp + npni;
+    *sni = distance * distance / (4. * (element_length * lp));
+    *dni = distance / (2. * element_length * lp);
+  } else if (npni <= -lp) {
+    *sni = 1. + (npni / element_length);
+    *dni = 1. / element_length;
+  } else if (npni <= lp) {
+    *sni = 1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
+    *dni = -(npni / (element_length * lp));
+  } else if (npni <= (element_length - lp)) {
+    *sni = 1. - (npni / element_length);
+    *dni = -(1. / element_length);
+  } else if (npni <= (element_length + lp)) {
+    const double distance = element_length + lp - npni;
+    *sni = distance * distance / (4. * element_length * lp);
+    *dni = -(distance / (2. * element_length * lp));
+  } else if ((element_length + lp) < npni) {
+    *sni = 0.;
+    *dni = 0.;
+  } else {
+    // NaN coordinate
+    return false;
+  }
+  return true;
+}
+
+//! Evaluate the 1D GIMP shape functions and gradients of the four nodes along
+//! an axis, located at natural coordinates -3, -1, 1 and 3
+//! \param[in] xi Local coordinate of the particle along the axis
+//! \param[in] particle_size Particle size along the axis in local coordinates
+//! \param[out] sn Shape functions of the four nodes
+//! \param[out] dn Gradients of the shape functions of the four nodes
+//! \retval status False if the point is outside the area of influence
+inline bool axis_weights(double xi, double particle_size,
+                         std::array<double, nnodes_axis>* sn,
+                         std::array<double, nnodes_axis>* dn) {
+  const double lp = particle_size * 0.5;
+  bool status = true;
+  for (unsigned a = 0; a < nnodes_axis; ++a)
+    status &= weight(xi - (2. * a - 3.), lp, &(*sn)[a], &(*dn)[a]);
+  return status;
+}
+
+}  // namespace gimp
+}  // namespace mpm
+
+#endif  // MPM_GIMP_BASIS_H_
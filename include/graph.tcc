@@ -62,7 +62,7 @@ void mpm::Graph<Tdim>::construct_graph(int mpi_size, int mpi_rank) {
       this->xadj_.emplace_back(offset);
 
       //! get the neighbours
-      auto neighbours = (*citr)->neighbours();
+      const auto& neighbours = (*citr)->neighbours();
 
       //! get the id of neighbours
       for (const auto& neighbour : neighbours) {
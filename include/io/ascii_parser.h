@@ -0,0 +1,253 @@
+#ifndef MPM_ASCII_PARSER_H_
+#define MPM_ASCII_PARSER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace mpm {
+namespace ascii {
+
+//! Return if a character is a white space in the C locale
+inline bool is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+         c == '\r';
+}
+
+//! Return if a character is a decimal digit
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+//! Find the next data line, skipping blank and comment lines
+//! \details As in IOMeshAscii, a line with a '#' or '!' anywhere is a comment
+//! \param[in, out] first Start of the search, set past the line found
+//! \param[in] last End of the buffer
+//! \param[out] begin First non-blank character of the data line
+//! \param[out] end Past the last non-blank character of the data line
+//! \retval status True if a data line is found before the end of the buffer
+inline bool next_data_line(const char** first, const char* last,
+                           const char** begin, const char** end) {
+  while (*first < last) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(*first, '\n', last - *first));
+    if (line_end == nullptr) line_end = last;
+    const char* b = *first;
+    const char* e = line_end;
+    *first = (line_end < last) ? line_end + 1 : last;
+
+    // Trim white spaces
+    while (b < e && is_space(*b)) ++b;
+    while (e > b && is_space(*(e - 1))) --e;
+    if (b == e || std::memchr(b, '#', e - b) != nullptr ||
+        std::memchr(b, '!', e - b) != nullptr)
+      continue;
+
+    *begin = b;
+    *end = e;
+    return true;
+  }
+  return false;
+}
+
+//! Parse an unsigned integer after optional white spaces
+//! \param[in, out] first Start of the number, set past the number
+//! \param[in] last End of the buffer
+//! \param[out] value Parsed value
+//! \retval status False if there is no number
+inline bool parse(const char** first, const char* last,
+                  unsigned long long* value) {
+  const char* p = *first;
+  while (p < last && is_space(*p)) ++p;
+  if (p < last && *p == '+') ++p;
+  if (p == last || !is_digit(*p)) return false;
+
+  unsigned long long result = 0;
+  for (; p < last && is_digit(*p); ++p) result = result * 10 + (*p - '0');
+  *value = result;
+  *first = p;
+  return true;
+}
+
+//! Parse a floating point number after optional white spaces
+//! \details Numbers with up to 15 significant digits and small exponents,
+//! as written by mesh generators, are converted exactly from the integer
+//! mantissa and a power of ten. Longer numbers fall back to std::strtod in
+//! the default C locale
+//! \param[in, out] first Start of the number, set past the number
+//! \param[in] last End of the buffer
+//! \param[out] value Parsed value
+//! \retval status False if there is no number
+inline bool parse(const char** first, const char* last, double* value) {
+  // Powers of ten that are exact in double precision
+  static const double powers[] = {1E0,  1E1,  1E2,  1E3,  1E4,  1E5,
+                                  1E6,  1E7,  1E8,  1E9,  1E10, 1E11,
+                                  1E12, 1E13, 1E14, 1E15, 1E16, 1E17,
+                                  1E18, 1E19, 1E20, 1E21, 1E22};
+
+  const char* p = *first;
+  while (p < last && is_space(*p)) ++p;
+  const char* start = p;
+
+  bool negative = false;
+  if (p < last && (*p == '+' || *p == '-')) negative = (*p++ == '-');
+
+  // Significant digits in an integer mantissa and the decimal exponent
+  std::uint64_t mantissa = 0;
+  int ndigits = 0;
+  int exponent = 0;
+  bool digits = false;
+  for (; p < last && is_digit(*p); ++p) {
+    digits = true;
+    if (mantissa == 0 && *p == '0') continue;
+    if (ndigits < 19) {
+      mantissa = mantissa * 10 + (*p - '0');
+      ++ndigits;
+    } else {
+      ++exponent;
+      ++ndigits;
+    }
+  }
+  if (p < last && *p == '.') {
+    for (++p; p < last && is_digit(*p); ++p) {
+      digits = true;
+      if (mantissa == 0 && *p == '0') {
+        --exponent;
+        continue;
+      }
+      if (ndigits < 19) {
+        mantissa = mantissa * 10 + (*p - '0');
+        --exponent;
+      }
+      ++ndigits;
+    }
+  }
+  if (!digits) return false;
+
+  // Exponent
+  if (p < last && (*p == 'e' || *p == 'E')) {
+    const char* e = p + 1;
+    bool negative_exponent = false;
+    if (e < last && (*e == '+' || *e == '-'))
+      negative_exponent = (*e++ == '-');
+    if (e == last || !is_digit(*e)) return false;
+    int power = 0;
+    for (; e < last && is_digit(*e); ++e)
+      if (power < 100000) power = power * 10 + (*e - '0');
+    exponent += negative_exponent ? -power : power;
+    p = e;
+  }
+
+  if (ndigits <= 15 && exponent >= -22 && exponent <= 22) {
+    // Both operands are exact, so the result is correctly rounded
+    double result = static_cast<double>(mantissa);
+    result = (exponent < 0) ? result / powers[-exponent]
+                            : result * powers[exponent];
+    *value = negative ? -result : result;
+  } else {
+    const std::string number(start, p);
+    *value = std::strtod(number.c_str(), nullptr);
+  }
+  *first = p;
+  return true;
+}
+
+//! Parse the unsigned integers of the first data line of a buffer
+//! \param[in] data First character of the buffer
+//! \param[in] size Size of the buffer
+//! \retval values Integers of the first data line, empty if there is none
+inline std::vector<unsigned long long> first_line_integers(const char* data,
+                                                           std::size_t size) {
+  std::vector<unsigned long long> values;
+  const char *first = data, *begin, *end;
+  if (next_data_line(&first, data + size, &begin, &end)) {
+    unsigned long long value;
+    while (parse(&begin, end, &value)) values.emplace_back(value);
+  }
+  return values;
+}
+
+//! Line-aligned part of a buffer
+struct Chunk {
+  //! First character
+  const char* begin;
+  //! Past the last character
+  const char* end;
+  //! Index of the first data line of the chunk in the buffer
+  std::size_t first_line;
+};
+
+//! Split a buffer into line-aligned chunks and count their data lines
+//! \param[in] data First character of the buffer
+//! \param[in] size Size of the buffer
+//! \param[out] nlines Number of data lines in the buffer
+//! \retval chunks Chunks of the buffer
+inline std::vector<Chunk> split_lines(const char* data, std::size_t size,
+                                      std::size_t* nlines) {
+  // Chunks of at least 64 kB, a few per thread to balance the load
+  std::size_t nchunks = size / 65536 + 1;
+#ifdef _OPENMP
+  nchunks = std::min<std::size_t>(nchunks, 4 * omp_get_max_threads());
+#else
+  nchunks = 1;
+#endif
+
+  const char* last = data + size;
+  std::vector<Chunk> chunks(nchunks, Chunk{last, last, 0});
+  chunks.front().begin = data;
+  for (std::size_t i = 1; i < nchunks; ++i) {
+    // Chunks start after a new line
+    const char* begin =
+        std::max(data + i * size / nchunks, chunks[i - 1].begin);
+    const char* newline =
+        static_cast<const char*>(std::memchr(begin, '\n', last - begin));
+    chunks[i].begin = (newline == nullptr) ? last : newline + 1;
+    chunks[i - 1].end = chunks[i].begin;
+  }
+
+  // Count data lines of each chunk
+  std::vector<std::size_t> counts(nchunks, 0);
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < nchunks; ++i) {
+    const char* first = chunks[i].begin;
+    const char *begin, *end;
+    while (next_data_line(&first, chunks[i].end, &begin, &end)) ++counts[i];
+  }
+
+  *nlines = 0;
+  for (std::size_t i = 0; i < nchunks; ++i) {
+    chunks[i].first_line = *nlines;
+    *nlines += counts[i];
+  }
+  return chunks;
+}
+
+//! Call a function on every data line of the chunks in parallel
+//! \param[in] chunks Chunks of a buffer
+//! \param[in] function Function of the index, first and past the last
+//! character of a data line, that returns false if the line is invalid
+//! \retval status False if any line is invalid
+//! \tparam Tfunction Function type
+template <typename Tfunction>
+bool for_each_data_line(const std::vector<Chunk>& chunks, Tfunction function) {
+  bool status = true;
+#pragma omp parallel for schedule(dynamic) reduction(&& : status)
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    const char* first = chunks[i].begin;
+    const char *begin, *end;
+    std::size_t line = chunks[i].first_line;
+    while (next_data_line(&first, chunks[i].end, &begin, &end))
+      status = function(line++, begin, end) && status;
+  }
+  return status;
+}
+
+}  // namespace ascii
+}  // namespace mpm
+
+#endif  // MPM_ASCII_PARSER_H_
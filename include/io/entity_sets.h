@@ -0,0 +1,50 @@
+#ifndef MPM_ENTITY_SETS_H_
+#define MPM_ENTITY_SETS_H_
+
+#include <map>
+#include <string>
+
+#include "tsl/robin_map.h"
+
+#include "range_set.h"
+
+namespace mpm {
+
+//! Entity sets of nodes, particles and cells
+//! \details A JSON file has arrays "node_sets", "particle_sets" and
+//! "cell_sets" of sets with an "id", and ids of the entities in a "set"
+//! array or in a "ranges" array of [first id, number of ids] pairs. It is
+//! read as a stream, without holding the JSON document in memory.
+//! A binary file starts with a binary Header of type EntitySets, with the
+//! number of sets as the number of records, followed by arrays of uint64 in
+//! little-endian byte order: types of sets (0 node, 1 particle and 2 cell
+//! sets, nsets), set ids (nsets), offsets of the ranges of each set
+//! (nsets + 1), and the first ids and numbers of ids of the ranges, which
+//! run-length encode consecutive ids (offsets[nsets] each).
+namespace entity_sets {
+
+//! Sets of a type, with their ranges of ids by set id
+using Sets = tsl::robin_map<mpm::Index, mpm::RangeSet>;
+
+//! Read sets of a type from a JSON or a binary file
+//! \param[in] filename Name of the file
+//! \param[in] sets_type Type of sets, node_sets, particle_sets or cell_sets
+//! \retval sets Sets of the type
+Sets read(const std::string& filename, const std::string& sets_type);
+
+//! Write sets of all types to a binary file
+//! \param[in] filename Name of the file
+//! \param[in] sets Sets by type of sets
+void write_binary(const std::string& filename,
+                  const std::map<std::string, Sets>& sets);
+
+//! Convert a JSON entity sets file to a binary file
+//! \param[in] json_file Name of the JSON file
+//! \param[in] binary_file Name of the binary file
+void convert_json(const std::string& json_file,
+                  const std::string& binary_file);
+
+}  // namespace entity_sets
+}  // namespace mpm
+
+#endif  // MPM_ENTITY_SETS_H_
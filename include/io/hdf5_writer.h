@@ -0,0 +1,77 @@
+#ifndef MPM_HDF5_WRITER_H_
+#define MPM_HDF5_WRITER_H_
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "hdf5_particle.h"
+
+namespace mpm {
+namespace hdf5 {
+
+//! Layout of particles in a HDF5 file
+//! Table: a compound dataset "table" with a record for each particle
+//! Columns: a dataset for each field, named as the field
+enum class Layout { Table, Columns };
+
+//! Return the layout of particles from its name, table or columns
+//! \param[in] name Name of the layout
+Layout layout(const std::string& name);
+
+//! Write particles to a HDF5 file
+//! \details In a shared file, the particles of each MPI rank follow those of
+//! the ranks before it, at the exclusive scan of the numbers of particles of
+//! the ranks, which is saved in an "offsets" dataset. With parallel HDF5,
+//! ranks write their hyperslab of the datasets collectively with MPI-IO, else
+//! rank 0 gathers the particles and writes the file
+//! \param[in] filename Name of the file
+//! \param[in] particles Particles of the rank
+//! \param[in] layout Layout of the particles
+//! \param[in] shared Write the particles of all MPI ranks to one file
+void write_particles(const std::string& filename,
+                     const std::vector<mpm::HDF5Particle>& particles,
+                     Layout layout, bool shared);
+
+//! Read particles from a HDF5 file of either layout
+//! \details A rank reads its own particles from a shared file written by as
+//! many ranks, and all particles otherwise
+//! \param[in] filename Name of the file
+//! \retval particles Particles read
+std::vector<mpm::HDF5Particle> read_particles(const std::string& filename);
+
+//! Write a checkpoint of particles of a rank to a HDF5 file
+//! \details Particles are written as columns, with their reference locations
+//! in their cells in xi_x, xi_y and xi_z datasets, which restore particles in
+//! their cells without locating them, and the deformation gradients of their
+//! domains in F_xx to F_zz datasets. Datasets are byte shuffled and deflated
+//! losslessly with a compression level from 1 to 9, and are not compressed
+//! with a compression level of 0
+//! \param[in] filename Name of the file
+//! \param[in] particles Particles of the rank
+//! \param[in] xi Reference locations of particles, zero padded to 3D
+//! \param[in] deformation_gradients Deformation gradients of particles,
+//! padded to 3D with the identity
+//! \param[in] compression Compression level
+void write_checkpoint(
+    const std::string& filename,
+    const std::vector<mpm::HDF5Particle>& particles,
+    const std::vector<Eigen::Matrix<double, 3, 1>>& xi,
+    const std::vector<Eigen::Matrix<double, 3, 3>>& deformation_gradients,
+    unsigned compression);
+
+//! Read a checkpoint of particles from a HDF5 file
+//! \param[in] filename Name of the file
+//! \param[out] xi Reference locations of particles
+//! \param[out] deformation_gradients Deformation gradients of particles, the
+//! identity if the checkpoint has none
+//! \retval particles Particles read
+std::vector<mpm::HDF5Particle> read_checkpoint(
+    const std::string& filename, std::vector<Eigen::Matrix<double, 3, 1>>* xi,
+    std::vector<Eigen::Matrix<double, 3, 3>>* deformation_gradients);
+
+}  // namespace hdf5
+}  // namespace mpm
+
+#endif  // MPM_HDF5_WRITER_H_
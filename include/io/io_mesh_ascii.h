@@ -5,7 +5,9 @@
 
 #include "Eigen/Dense"
 
+#include "ascii_parser.h"
 #include "io_mesh.h"
+#include "mapped_file.h"
 
 //! MPM namespace
 namespace mpm {
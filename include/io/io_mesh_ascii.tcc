@@ -4,61 +4,36 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::IOMeshAscii<Tdim>::read_mesh_nodes(const std::string& mesh) {
   // Nodal coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      unsigned nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              coordinates.reserve(nnodes);
-              read_first_line = true;
-              break;
-            }
-            // Read until nodal information is present
-            if (nlines <= nnodes) {
-              // Read to coordinates
-              for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-              coordinates.emplace_back(coords);
-              break;
-
-            } else {
-              // Ignore stream
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-        }
-      }
-    }
-    file.close();
+    // Memory-mapped file split into line-aligned chunks
+    const mpm::MappedFile file(mesh);
+    std::size_t nlines = 0;
+    const auto chunks =
+        mpm::ascii::split_lines(file.data(), file.size(), &nlines);
+
+    // Number of nodes and cells in the first line
+    const auto counts =
+        mpm::ascii::first_line_integers(file.data(), file.size());
+    if (nlines > 0 && counts.size() < 2)
+      throw std::runtime_error("Invalid number of nodes and cells");
+
+    // Nodal coordinates are on the lines after the first
+    const std::size_t nnodes =
+        (nlines > 0) ? std::min<std::size_t>(counts[0], nlines - 1) : 0;
+    coordinates.resize(nnodes);
+    const bool status = mpm::ascii::for_each_data_line(
+        chunks, [&](std::size_t line, const char* begin, const char* end) {
+          if (line == 0 || line > nnodes) return true;
+          for (unsigned i = 0; i < Tdim; ++i)
+            if (!mpm::ascii::parse(&begin, end, &coordinates[line - 1](i)))
+              return false;
+          return true;
+        });
+    if (!status) throw std::runtime_error("Invalid nodal coordinates");
   } catch (std::exception& exception) {
     console_->error("Read mesh nodes: {}", exception.what());
-    file.close();
+    coordinates.clear();
   }
 
   return coordinates;
@@ -70,65 +45,35 @@ std::vector<std::vector<mpm::Index>> mpm::IOMeshAscii<Tdim>::read_mesh_cells(
     const std::string& mesh) {
   // Indices of nodes
   std::vector<std::vector<mpm::Index>> cells;
-  cells.clear();
-
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      mpm::Index nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // Vector of node ids for a cell
-        std::vector<mpm::Index> nodes;
-        nodes.clear();
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              cells.reserve(ncells);
-              read_first_line = true;
-              break;
-            }
-            // Ignore nodal coordinates
-            if (nlines > nnodes) {
-              // Read node ids of each cell
-              mpm::Index nid;
-              istream >> nid;
-              nodes.emplace_back(nid);
-            } else {
-              // Ignore stream not related to node ids of cells
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-          // Check if nodes is not empty, before adding to cell
-          if (!nodes.empty()) {
-            cells.emplace_back(nodes);
-          }
-        }
-      }
-    }
-    file.close();
+    // Memory-mapped file split into line-aligned chunks
+    const mpm::MappedFile file(mesh);
+    std::size_t nlines = 0;
+    const auto chunks =
+        mpm::ascii::split_lines(file.data(), file.size(), &nlines);
+
+    // Number of nodes and cells in the first line
+    const auto counts =
+        mpm::ascii::first_line_integers(file.data(), file.size());
+    if (nlines > 0 && counts.size() < 2)
+      throw std::runtime_error("Invalid number of nodes and cells");
+
+    // Node ids of cells are on the lines after the nodal coordinates
+    const std::size_t first_cell = (nlines > 0) ? counts[0] + 1 : 0;
+    if (nlines > first_cell) cells.resize(nlines - first_cell);
+    const bool status = mpm::ascii::for_each_data_line(
+        chunks, [&](std::size_t line, const char* begin, const char* end) {
+          if (line < first_cell) return true;
+          auto& nodes = cells[line - first_cell];
+          mpm::Index nid;
+          while (mpm::ascii::parse(&begin, end, &nid)) nodes.emplace_back(nid);
+          return begin == end;
+        });
+    if (!status) throw std::runtime_error("Invalid node ids of cells");
   } catch (std::exception& exception) {
     console_->error("Read mesh cells: {}", exception.what());
-    file.close();
+    cells.clear();
   }
 
   return cells;
@@ -139,52 +84,30 @@ template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::IOMeshAscii<Tdim>::read_particles(const std::string& particles_file) {
 
-  // Nodal coordinates
+  // Particle coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              coordinates.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Coordinates
-            Eigen::Matrix<double, Tdim, 1> coords;
-            // Read to coordinates
-            for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-            coordinates.emplace_back(coords);
-            break;
-          }
-        }
-      }
-    }
-    file.close();
+    // Memory-mapped file split into line-aligned chunks
+    const mpm::MappedFile file(particles_file);
+    std::size_t nlines = 0;
+    const auto chunks =
+        mpm::ascii::split_lines(file.data(), file.size(), &nlines);
+
+    // Coordinates are on the lines after the number of particles
+    if (nlines > 0) coordinates.resize(nlines - 1);
+    const bool status = mpm::ascii::for_each_data_line(
+        chunks, [&](std::size_t line, const char* begin, const char* end) {
+          if (line == 0) return true;
+          for (unsigned i = 0; i < Tdim; ++i)
+            if (!mpm::ascii::parse(&begin, end, &coordinates[line - 1](i)))
+              return false;
+          return true;
+        });
+    if (!status) throw std::runtime_error("Invalid particle coordinates");
   } catch (std::exception& exception) {
     console_->error("Read particle coordinates: {}", exception.what());
-    file.close();
+    coordinates.clear();
   }
 
   return coordinates;
@@ -196,52 +119,30 @@ std::vector<Eigen::Matrix<double, 6, 1>>
     mpm::IOMeshAscii<Tdim>::read_particles_stresses(
         const std::string& particles_stresses) {
 
-  // Nodal stresses
+  // Particle stresses
   std::vector<Eigen::Matrix<double, 6, 1>> stresses;
-  stresses.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_stresses.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              stresses.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Stresses
-            Eigen::Matrix<double, 6, 1> stress;
-            // Read to stress
-            for (unsigned i = 0; i < stress.size(); ++i) istream >> stress[i];
-            stresses.emplace_back(stress);
-            break;
-          }
-        }
-      }
-    }
-    file.close();
+    // Memory-mapped file split into line-aligned chunks
+    const mpm::MappedFile file(particles_stresses);
+    std::size_t nlines = 0;
+    const auto chunks =
+        mpm::ascii::split_lines(file.data(), file.size(), &nlines);
+
+    // Stresses are on the lines after the number of particles
+    if (nlines > 0) stresses.resize(nlines - 1);
+    const bool status = mpm::ascii::for_each_data_line(
+        chunks, [&](std::size_t line, const char* begin, const char* end) {
+          if (line == 0) return true;
+          for (unsigned i = 0; i < 6; ++i)
+            if (!mpm::ascii::parse(&begin, end, &stresses[line - 1](i)))
+              return false;
+          return true;
+        });
+    if (!status) throw std::runtime_error("Invalid particle stresses");
   } catch (std::exception& exception) {
     console_->error("Read particle stresses: {}", exception.what());
-    file.close();
+    stresses.clear();
   }
   return stresses;
 }
@@ -0,0 +1,302 @@
+#ifndef MPM_IO_MESH_BINARY_H_
+#define MPM_IO_MESH_BINARY_H_
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "entity_sets.h"
+#include "io_mesh.h"
+#include "io_mesh_ascii.h"
+#include "mapped_file.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! Binary mesh and particle files
+//! \details A file starts with a Header followed by the arrays of its type,
+//! each stored contiguously in little-endian byte order:
+//! Mesh: nodal coordinates (double, nnodes x Tdim), cell offsets (uint64,
+//! ncells + 1) and node ids of cells (uint64, offsets[ncells]).
+//! Particles: coordinates (double, n x Tdim).
+//! ParticlesStresses: stresses (double, n x 6).
+//! EulerAngles: node ids (uint64, n) and angles (double, n x Tdim).
+//! ParticlesVolumes: particle ids (uint64, n) and volumes (double, n).
+//! ParticlesCells: particle and cell ids (uint64, n x 2).
+//! VelocityConstraints and Forces: ids (uint64, n), directions (uint64, n)
+//! and values (double, n).
+//! FrictionConstraints: ids (uint64, n), directions (uint64, n), signs
+//! (int64, n) and frictions (double, n).
+//! EntitySets: ranges of ids of node, particle and cell sets, see
+//! entity_sets.h.
+namespace binary {
+
+//! Magic bytes at the start of a binary file
+const char magic[8] = {'M', 'P', 'M', 'B', 'I', 'N', '\0', '\0'};
+
+//! Version of the binary layout
+const std::uint32_t version = 1;
+
+//! Type of data in a binary file
+enum class FileType : std::uint32_t {
+  Mesh = 1,
+  Particles = 2,
+  ParticlesStresses = 3,
+  EulerAngles = 4,
+  ParticlesVolumes = 5,
+  ParticlesCells = 6,
+  VelocityConstraints = 7,
+  FrictionConstraints = 8,
+  Forces = 9,
+  EntitySets = 10
+};
+
+//! Header of a binary file
+struct Header {
+  //! Magic bytes
+  char magic[8];
+  //! Version of the layout
+  std::uint32_t version;
+  //! Type of data
+  std::uint32_t type;
+  //! Dimension
+  std::uint32_t dimension;
+  //! Reserved, zero
+  std::uint32_t reserved;
+  //! Number of records (nodes of a mesh)
+  std::uint64_t nrecords;
+  //! Number of cells of a mesh, zero otherwise
+  std::uint64_t ncells;
+};
+static_assert(sizeof(Header) == 40, "Unexpected padding in binary header");
+
+//! Return if the host stores integers in little-endian byte order
+inline bool little_endian() {
+  const std::uint16_t one = 1;
+  char byte;
+  std::memcpy(&byte, &one, 1);
+  return byte == 1;
+}
+
+//! Return the file type of a name used by the converter
+//! \param[in] name Name of the file type, e.g., "mesh" or "particles"
+//! \retval type File type
+inline FileType file_type(const std::string& name) {
+  const std::map<std::string, FileType> types = {
+      {"mesh", FileType::Mesh},
+      {"particles", FileType::Particles},
+      {"particles_stresses", FileType::ParticlesStresses},
+      {"euler_angles", FileType::EulerAngles},
+      {"particles_volumes", FileType::ParticlesVolumes},
+      {"particles_cells", FileType::ParticlesCells},
+      {"velocity_constraints", FileType::VelocityConstraints},
+      {"friction_constraints", FileType::FrictionConstraints},
+      {"forces", FileType::Forces},
+      {"entity_sets", FileType::EntitySets}};
+  const auto itr = types.find(name);
+  if (itr == types.end())
+    throw std::runtime_error("Invalid binary file type: " + name);
+  return itr->second;
+}
+
+}  // namespace binary
+
+//! IOMeshBinary class
+//! \brief Derived class that returns mesh and particles locations from
+//! memory-mapped binary files
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class IOMeshBinary : public IOMesh<Tdim> {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  IOMeshBinary() : mpm::IOMesh<Tdim>() {
+    //! Logger
+    console_ = spdlog::get("IOMeshBinary");
+  }
+
+  //! Destructor
+  ~IOMeshBinary() override = default;
+
+  //! Read mesh nodes file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval coordinates Vector of nodal coordinates
+  std::vector<VectorDim> read_mesh_nodes(const std::string& mesh) override;
+
+  //! Read mesh cells file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval cells Vector of nodal indices of cells
+  std::vector<std::vector<mpm::Index>> read_mesh_cells(
+      const std::string& mesh) override;
+
+  //! Read particles file
+  //! \param[in] particles_files file name with particle coordinates
+  //! \retval coordinates Vector of particle coordinates
+  std::vector<VectorDim> read_particles(
+      const std::string& particles_file) override;
+
+  //! Read particle stresses
+  //! \param[in] particles_stresses file name with particle stresses
+  //! \retval stresses Vector of particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> read_particles_stresses(
+      const std::string& particles_stresses) override;
+
+  //! Read nodal euler angles file
+  //! \param[in] nodal_euler_angles_file file name with nodal id and respective
+  //! euler angles
+  std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>> read_euler_angles(
+      const std::string& nodal_euler_angles_file) override;
+
+  //! Read volume file
+  //! \param[in] volume_files file name with particle volumes
+  std::vector<std::tuple<mpm::Index, double>> read_particles_volumes(
+      const std::string& volume_file) override;
+
+  //! Read particles cells file
+  //! \param[in] particles_cells_file file name with particle cell ids
+  std::vector<std::array<mpm::Index, 2>> read_particles_cells(
+      const std::string& particles_cells_file) override;
+
+  //! Write particles cells file
+  //! \param[in] particle_cells List of particles and cells
+  //! \param[in] particles_cells_file file name with particle cell ids
+  void write_particles_cells(
+      const std::string& particles_cells_file,
+      const std::vector<std::array<mpm::Index, 2>>& particles_cells) override;
+
+  //! Read constraints file
+  //! \param[in] velocity_constraints_files file name with constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>>
+      read_velocity_constraints(
+          const std::string& velocity_constraints_file) override;
+
+  //! Read friction constraints file
+  //! \param[in] friction_constraints_files file name with frictions
+  std::vector<std::tuple<mpm::Index, unsigned, int, double>>
+      read_friction_constraints(
+          const std::string& friction_constraints_file) override;
+
+  //! Read traction file
+  //! \param[in] forces_files file name with nodal concentrated force
+  std::vector<std::tuple<mpm::Index, unsigned, double>> read_forces(
+      const std::string& forces_file) override;
+
+  //! Write mesh file
+  //! \param[in] mesh file name
+  //! \param[in] coordinates Vector of nodal coordinates
+  //! \param[in] cells Vector of nodal indices of cells
+  //! \retval status Status of writing the file
+  bool write_mesh(const std::string& mesh,
+                  const std::vector<VectorDim>& coordinates,
+                  const std::vector<std::vector<mpm::Index>>& cells);
+
+  //! Write particles file
+  //! \param[in] particles_file file name
+  //! \param[in] coordinates Vector of particle coordinates
+  //! \retval status Status of writing the file
+  bool write_particles(const std::string& particles_file,
+                       const std::vector<VectorDim>& coordinates);
+
+  //! Write particle stresses file
+  //! \param[in] particles_stresses file name
+  //! \param[in] stresses Vector of particle stresses
+  //! \retval status Status of writing the file
+  bool write_particles_stresses(
+      const std::string& particles_stresses,
+      const std::vector<Eigen::Matrix<double, 6, 1>>& stresses);
+
+  //! Write nodal euler angles file
+  //! \param[in] nodal_euler_angles_file file name
+  //! \param[in] euler_angles Map of node ids and euler angles
+  //! \retval status Status of writing the file
+  bool write_euler_angles(
+      const std::string& nodal_euler_angles_file,
+      const std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>&
+          euler_angles);
+
+  //! Write particles volume file
+  //! \param[in] volume_file file name
+  //! \param[in] volumes Particle ids and volumes
+  //! \retval status Status of writing the file
+  bool write_particles_volumes(
+      const std::string& volume_file,
+      const std::vector<std::tuple<mpm::Index, double>>& volumes);
+
+  //! Write velocity constraints file
+  //! \param[in] velocity_constraints_file file name
+  //! \param[in] constraints Ids, directions and velocities
+  //! \retval status Status of writing the file
+  bool write_velocity_constraints(
+      const std::string& velocity_constraints_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>&
+          constraints);
+
+  //! Write friction constraints file
+  //! \param[in] friction_constraints_file file name
+  //! \param[in] constraints Ids, directions, signs and frictions
+  //! \retval status Status of writing the file
+  bool write_friction_constraints(
+      const std::string& friction_constraints_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, int, double>>&
+          constraints);
+
+  //! Write forces file
+  //! \param[in] forces_file file name
+  //! \param[in] forces Ids, directions and forces
+  //! \retval status Status of writing the file
+  bool write_forces(
+      const std::string& forces_file,
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>& forces);
+
+  //! Convert an ascii file to a binary file
+  //! \param[in] type Type of data in the file
+  //! \param[in] ascii_file Name of the ascii file
+  //! \param[in] binary_file Name of the binary file
+  //! \retval status Status of the conversion
+  bool convert_ascii(mpm::binary::FileType type, const std::string& ascii_file,
+                     const std::string& binary_file);
+
+ private:
+  //! Map a file and check its header
+  //! \param[in] file Mapped file
+  //! \param[in] type Expected type of data
+  //! \retval header Header of the file
+  mpm::binary::Header read_header(const mpm::MappedFile& file,
+                                  mpm::binary::FileType type) const;
+
+  //! Return a pointer to an array in a mapped file and advance the offset
+  //! \param[in] file Mapped file
+  //! \param[in] size Number of entries in the array
+  //! \param[in, out] offset Offset of the array in bytes
+  //! \param[in] ncomponents Number of values of each entry
+  //! \tparam T Type of a value
+  template <typename T>
+  const T* read_array(const mpm::MappedFile& file, std::size_t size,
+                      std::size_t* offset, std::size_t ncomponents = 1) const;
+
+  //! Write a header and arrays to a file
+  //! \param[in] filename Name of the file
+  //! \param[in] type Type of data
+  //! \param[in] nrecords Number of records
+  //! \param[in] ncells Number of cells of a mesh
+  //! \param[in] arrays Pointers and sizes in bytes of the arrays
+  //! \retval status Status of writing the file
+  bool write_file(
+      const std::string& filename, mpm::binary::FileType type,
+      std::uint64_t nrecords, std::uint64_t ncells,
+      const std::vector<std::pair<const void*, std::size_t>>& arrays);
+
+  //! Logger
+  std::shared_ptr<spdlog::logger> console_;
+};  // IOMeshBinary class
+}  // namespace mpm
+
+#include "io_mesh_binary.tcc"
+
+#endif  // MPM_IO_MESH_BINARY_H_
@@ -0,0 +1,602 @@
+//! Map a file and check its header
+template <unsigned Tdim>
+mpm::binary::Header mpm::IOMeshBinary<Tdim>::read_header(
+    const mpm::MappedFile& file, mpm::binary::FileType type) const {
+  if (!mpm::binary::little_endian())
+    throw std::runtime_error("Binary files require a little-endian host");
+
+  mpm::binary::Header header;
+  if (file.size() < sizeof(header))
+    throw std::runtime_error("Binary file is shorter than its header");
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  if (std::memcmp(header.magic, mpm::binary::magic, sizeof(header.magic)) != 0)
+    throw std::runtime_error("Not an MPM binary file");
+  if (header.version != mpm::binary::version)
+    throw std::runtime_error("Unsupported binary file version " +
+                             std::to_string(header.version));
+  if (header.type != static_cast<std::uint32_t>(type))
+    throw std::runtime_error("Unexpected type of binary file");
+  // Every record and cell takes at least a byte
+  if (header.nrecords > file.size() || header.ncells > file.size())
+    throw std::runtime_error("Binary file is truncated");
+
+  // Coordinates and angles depend on the dimension
+  if ((type == mpm::binary::FileType::Mesh ||
+       type == mpm::binary::FileType::Particles ||
+       type == mpm::binary::FileType::EulerAngles) &&
+      header.dimension != Tdim)
+    throw std::runtime_error("Binary file has a different dimension");
+  return header;
+}
+
+//! Return a pointer to an array in a mapped file
+template <unsigned Tdim>
+template <typename T>
+const T* mpm::IOMeshBinary<Tdim>::read_array(const mpm::MappedFile& file,
+                                             std::size_t size,
+                                             std::size_t* offset,
+                                             std::size_t ncomponents) const {
+  // Sizes come from the file, check them before multiplying
+  if (*offset > file.size() || ncomponents == 0 ||
+      size > (file.size() - *offset) / sizeof(T) / ncomponents)
+    throw std::runtime_error("Binary file is truncated");
+  const std::size_t nbytes = size * ncomponents * sizeof(T);
+  const T* array = reinterpret_cast<const T*>(file.data() + *offset);
+  *offset += nbytes;
+  return array;
+}
+
+//! Write a header and arrays to a file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_file(
+    const std::string& filename, mpm::binary::FileType type,
+    std::uint64_t nrecords, std::uint64_t ncells,
+    const std::vector<std::pair<const void*, std::size_t>>& arrays) {
+  bool status = true;
+  try {
+    if (!mpm::binary::little_endian())
+      throw std::runtime_error("Binary files require a little-endian host");
+
+    mpm::binary::Header header;
+    std::memcpy(header.magic, mpm::binary::magic, sizeof(header.magic));
+    header.version = mpm::binary::version;
+    header.type = static_cast<std::uint32_t>(type);
+    header.dimension = Tdim;
+    header.reserved = 0;
+    header.nrecords = nrecords;
+    header.ncells = ncells;
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    if (!file.is_open())
+      throw std::runtime_error("Unable to open binary file: " + filename);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& array : arrays)
+      file.write(static_cast<const char*>(array.first), array.second);
+    if (!file.good())
+      throw std::runtime_error("Unable to write binary file: " + filename);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Return coordinates of nodes in a mesh from input file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_mesh_nodes(const std::string& mesh) {
+  // Nodal coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    const mpm::MappedFile file(mesh);
+    const auto header = this->read_header(file, mpm::binary::FileType::Mesh);
+    std::size_t offset = sizeof(header);
+    const double* coords =
+        this->read_array<double>(file, header.nrecords, &offset, Tdim);
+
+    coordinates.resize(header.nrecords);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < coordinates.size(); ++i)
+      coordinates[i] = Eigen::Map<const VectorDim>(coords + i * Tdim);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh nodes: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return indices of nodes of cells in a mesh from input file
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>> mpm::IOMeshBinary<Tdim>::read_mesh_cells(
+    const std::string& mesh) {
+  // Indices of nodes
+  std::vector<std::vector<mpm::Index>> cells;
+  try {
+    const mpm::MappedFile file(mesh);
+    const auto header = this->read_header(file, mpm::binary::FileType::Mesh);
+    std::size_t offset = sizeof(header);
+    // Skip nodal coordinates
+    this->read_array<double>(file, header.nrecords, &offset, Tdim);
+    const std::uint64_t* offsets =
+        this->read_array<std::uint64_t>(file, header.ncells + 1, &offset);
+    const std::uint64_t* nodes =
+        this->read_array<std::uint64_t>(file, offsets[header.ncells], &offset);
+
+    // Offsets must not decrease
+    for (std::size_t i = 0; i < header.ncells; ++i)
+      if (offsets[i] > offsets[i + 1])
+        throw std::runtime_error("Invalid offsets of cells");
+
+    cells.resize(header.ncells);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      cells[i].assign(nodes + offsets[i], nodes + offsets[i + 1]);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh cells: {}", exception.what());
+    cells.clear();
+  }
+  return cells;
+}
+
+//! Return coordinates of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_particles(const std::string& particles_file) {
+  // Particle coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    const mpm::MappedFile file(particles_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::Particles);
+    std::size_t offset = sizeof(header);
+    const double* coords =
+        this->read_array<double>(file, header.nrecords, &offset, Tdim);
+
+    coordinates.resize(header.nrecords);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < coordinates.size(); ++i)
+      coordinates[i] = Eigen::Map<const VectorDim>(coords + i * Tdim);
+  } catch (std::exception& exception) {
+    console_->error("Read particle coordinates: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return stresses of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, 6, 1>>
+    mpm::IOMeshBinary<Tdim>::read_particles_stresses(
+        const std::string& particles_stresses) {
+  // Particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+  try {
+    const mpm::MappedFile file(particles_stresses);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::ParticlesStresses);
+    std::size_t offset = sizeof(header);
+    const double* values =
+        this->read_array<double>(file, header.nrecords, &offset, 6);
+
+    stresses.resize(header.nrecords);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < stresses.size(); ++i)
+      stresses[i] =
+          Eigen::Map<const Eigen::Matrix<double, 6, 1>>(values + i * 6);
+  } catch (std::exception& exception) {
+    console_->error("Read particle stresses: {}", exception.what());
+    stresses.clear();
+  }
+  return stresses;
+}
+
+//! Return euler angles of nodes
+template <unsigned Tdim>
+std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshBinary<Tdim>::read_euler_angles(
+        const std::string& nodal_euler_angles_file) {
+  // Nodal euler angles
+  std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>> euler_angles;
+  try {
+    const mpm::MappedFile file(nodal_euler_angles_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::EulerAngles);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const double* angles =
+        this->read_array<double>(file, header.nrecords, &offset, Tdim);
+
+    for (std::size_t i = 0; i < header.nrecords; ++i)
+      euler_angles.emplace_hint(
+          euler_angles.end(), ids[i],
+          Eigen::Map<const Eigen::Matrix<double, Tdim, 1>>(angles + i * Tdim));
+  } catch (std::exception& exception) {
+    console_->error("Read euler angles: {}", exception.what());
+    euler_angles.clear();
+  }
+  return euler_angles;
+}
+
+//! Return particles volume
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, double>>
+    mpm::IOMeshBinary<Tdim>::read_particles_volumes(
+        const std::string& volume_file) {
+  // Particle volumes
+  std::vector<std::tuple<mpm::Index, double>> volumes;
+  try {
+    const mpm::MappedFile file(volume_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::ParticlesVolumes);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const double* values =
+        this->read_array<double>(file, header.nrecords, &offset);
+
+    volumes.resize(header.nrecords);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < volumes.size(); ++i)
+      volumes[i] = std::make_tuple(ids[i], values[i]);
+  } catch (std::exception& exception) {
+    console_->error("Read volume : {}", exception.what());
+    volumes.clear();
+  }
+  return volumes;
+}
+
+//! Return particles and their cells
+template <unsigned Tdim>
+std::vector<std::array<mpm::Index, 2>>
+    mpm::IOMeshBinary<Tdim>::read_particles_cells(
+        const std::string& particles_cells_file) {
+  // Particle cells
+  std::vector<std::array<mpm::Index, 2>> particles_cells;
+  try {
+    const mpm::MappedFile file(particles_cells_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::ParticlesCells);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset, 2);
+
+    particles_cells.resize(header.nrecords);
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < particles_cells.size(); ++i)
+      particles_cells[i] = {ids[2 * i], ids[2 * i + 1]};
+  } catch (std::exception& exception) {
+    console_->error("Read particles cells: {}", exception.what());
+    particles_cells.clear();
+  }
+  return particles_cells;
+}
+
+//! Write particles and their cells
+template <unsigned Tdim>
+void mpm::IOMeshBinary<Tdim>::write_particles_cells(
+    const std::string& particles_cells_file,
+    const std::vector<std::array<mpm::Index, 2>>& particles_cells) {
+  // Particle and cell ids
+  std::vector<std::uint64_t> ids;
+  ids.reserve(particles_cells.size() * 2);
+  for (const auto& particle_cell : particles_cells) {
+    ids.emplace_back(particle_cell[0]);
+    ids.emplace_back(particle_cell[1]);
+  }
+  this->write_file(particles_cells_file,
+                   mpm::binary::FileType::ParticlesCells,
+                   particles_cells.size(), 0,
+                   {{ids.data(), ids.size() * sizeof(std::uint64_t)}});
+}
+
+//! Return velocity constraints of nodes or particles
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshBinary<Tdim>::read_velocity_constraints(
+        const std::string& velocity_constraints_file) {
+  // Nodal or particle velocity constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>> constraints;
+  try {
+    const mpm::MappedFile file(velocity_constraints_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::VelocityConstraints);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const std::uint64_t* dirs =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const double* velocities =
+        this->read_array<double>(file, header.nrecords, &offset);
+
+    constraints.reserve(header.nrecords);
+    for (std::size_t i = 0; i < header.nrecords; ++i)
+      constraints.emplace_back(std::make_tuple(
+          ids[i], static_cast<unsigned>(dirs[i]), velocities[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read velocity constraints: {}", exception.what());
+    constraints.clear();
+  }
+  return constraints;
+}
+
+//! Return friction constraints of particles
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, int, double>>
+    mpm::IOMeshBinary<Tdim>::read_friction_constraints(
+        const std::string& friction_constraints_file) {
+  // Nodal friction constraints
+  std::vector<std::tuple<mpm::Index, unsigned, int, double>> constraints;
+  try {
+    const mpm::MappedFile file(friction_constraints_file);
+    const auto header =
+        this->read_header(file, mpm::binary::FileType::FrictionConstraints);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const std::uint64_t* dirs =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const std::int64_t* signs =
+        this->read_array<std::int64_t>(file, header.nrecords, &offset);
+    const double* frictions =
+        this->read_array<double>(file, header.nrecords, &offset);
+
+    constraints.reserve(header.nrecords);
+    for (std::size_t i = 0; i < header.nrecords; ++i)
+      constraints.emplace_back(
+          std::make_tuple(ids[i], static_cast<unsigned>(dirs[i]),
+                          static_cast<int>(signs[i]), frictions[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read friction constraints: {}", exception.what());
+    constraints.clear();
+  }
+  return constraints;
+}
+
+//! Return particles force
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::IOMeshBinary<Tdim>::read_forces(const std::string& forces_file) {
+  // Particle or nodal forces
+  std::vector<std::tuple<mpm::Index, unsigned, double>> forces;
+  try {
+    const mpm::MappedFile file(forces_file);
+    const auto header = this->read_header(file, mpm::binary::FileType::Forces);
+    std::size_t offset = sizeof(header);
+    const std::uint64_t* ids =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const std::uint64_t* dirs =
+        this->read_array<std::uint64_t>(file, header.nrecords, &offset);
+    const double* values =
+        this->read_array<double>(file, header.nrecords, &offset);
+
+    forces.reserve(header.nrecords);
+    for (std::size_t i = 0; i < header.nrecords; ++i)
+      forces.emplace_back(
+          std::make_tuple(ids[i], static_cast<unsigned>(dirs[i]), values[i]));
+  } catch (std::exception& exception) {
+    console_->error("Read force : {}", exception.what());
+    forces.clear();
+  }
+  return forces;
+}
+
+//! Write mesh file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_mesh(
+    const std::string& mesh, const std::vector<VectorDim>& coordinates,
+    const std::vector<std::vector<mpm::Index>>& cells) {
+  // Nodal coordinates
+  std::vector<double> coords;
+  coords.reserve(coordinates.size() * Tdim);
+  for (const auto& coordinate : coordinates)
+    coords.insert(coords.end(), coordinate.data(), coordinate.data() + Tdim);
+
+  // Node ids of cells in compressed row format
+  std::vector<std::uint64_t> offsets(1, 0);
+  std::vector<std::uint64_t> nodes;
+  offsets.reserve(cells.size() + 1);
+  for (const auto& cell : cells) {
+    nodes.insert(nodes.end(), cell.begin(), cell.end());
+    offsets.emplace_back(nodes.size());
+  }
+
+  return this->write_file(
+      mesh, mpm::binary::FileType::Mesh, coordinates.size(), cells.size(),
+      {{coords.data(), coords.size() * sizeof(double)},
+       {offsets.data(), offsets.size() * sizeof(std::uint64_t)},
+       {nodes.data(), nodes.size() * sizeof(std::uint64_t)}});
+}
+
+//! Write particles file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles(
+    const std::string& particles_file,
+    const std::vector<VectorDim>& coordinates) {
+  std::vector<double> coords;
+  coords.reserve(coordinates.size() * Tdim);
+  for (const auto& coordinate : coordinates)
+    coords.insert(coords.end(), coordinate.data(), coordinate.data() + Tdim);
+
+  return this->write_file(particles_file, mpm::binary::FileType::Particles,
+                          coordinates.size(), 0,
+                          {{coords.data(), coords.size() * sizeof(double)}});
+}
+
+//! Write particle stresses file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles_stresses(
+    const std::string& particles_stresses,
+    const std::vector<Eigen::Matrix<double, 6, 1>>& stresses) {
+  std::vector<double> values;
+  values.reserve(stresses.size() * 6);
+  for (const auto& stress : stresses)
+    values.insert(values.end(), stress.data(), stress.data() + 6);
+
+  return this->write_file(particles_stresses,
+                          mpm::binary::FileType::ParticlesStresses,
+                          stresses.size(), 0,
+                          {{values.data(), values.size() * sizeof(double)}});
+}
+
+//! Write nodal euler angles file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_euler_angles(
+    const std::string& nodal_euler_angles_file,
+    const std::map<mpm::Index, Eigen::Matrix<double, Tdim, 1>>& euler_angles) {
+  std::vector<std::uint64_t> ids;
+  std::vector<double> angles;
+  ids.reserve(euler_angles.size());
+  angles.reserve(euler_angles.size() * Tdim);
+  for (const auto& euler_angle : euler_angles) {
+    ids.emplace_back(euler_angle.first);
+    angles.insert(angles.end(), euler_angle.second.data(),
+                  euler_angle.second.data() + Tdim);
+  }
+
+  return this->write_file(nodal_euler_angles_file,
+                          mpm::binary::FileType::EulerAngles, ids.size(), 0,
+                          {{ids.data(), ids.size() * sizeof(std::uint64_t)},
+                           {angles.data(), angles.size() * sizeof(double)}});
+}
+
+//! Write particles volume file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_particles_volumes(
+    const std::string& volume_file,
+    const std::vector<std::tuple<mpm::Index, double>>& volumes) {
+  std::vector<std::uint64_t> ids;
+  std::vector<double> values;
+  ids.reserve(volumes.size());
+  values.reserve(volumes.size());
+  for (const auto& volume : volumes) {
+    ids.emplace_back(std::get<0>(volume));
+    values.emplace_back(std::get<1>(volume));
+  }
+
+  return this->write_file(volume_file, mpm::binary::FileType::ParticlesVolumes,
+                          ids.size(), 0,
+                          {{ids.data(), ids.size() * sizeof(std::uint64_t)},
+                           {values.data(), values.size() * sizeof(double)}});
+}
+
+//! Write velocity constraints file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_velocity_constraints(
+    const std::string& velocity_constraints_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>&
+        constraints) {
+  std::vector<std::uint64_t> ids, dirs;
+  std::vector<double> velocities;
+  for (const auto& constraint : constraints) {
+    ids.emplace_back(std::get<0>(constraint));
+    dirs.emplace_back(std::get<1>(constraint));
+    velocities.emplace_back(std::get<2>(constraint));
+  }
+
+  return this->write_file(
+      velocity_constraints_file, mpm::binary::FileType::VelocityConstraints,
+      ids.size(), 0,
+      {{ids.data(), ids.size() * sizeof(std::uint64_t)},
+       {dirs.data(), dirs.size() * sizeof(std::uint64_t)},
+       {velocities.data(), velocities.size() * sizeof(double)}});
+}
+
+//! Write friction constraints file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_friction_constraints(
+    const std::string& friction_constraints_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, int, double>>&
+        constraints) {
+  std::vector<std::uint64_t> ids, dirs;
+  std::vector<std::int64_t> signs;
+  std::vector<double> frictions;
+  for (const auto& constraint : constraints) {
+    ids.emplace_back(std::get<0>(constraint));
+    dirs.emplace_back(std::get<1>(constraint));
+    signs.emplace_back(std::get<2>(constraint));
+    frictions.emplace_back(std::get<3>(constraint));
+  }
+
+  return this->write_file(
+      friction_constraints_file, mpm::binary::FileType::FrictionConstraints,
+      ids.size(), 0,
+      {{ids.data(), ids.size() * sizeof(std::uint64_t)},
+       {dirs.data(), dirs.size() * sizeof(std::uint64_t)},
+       {signs.data(), signs.size() * sizeof(std::int64_t)},
+       {frictions.data(), frictions.size() * sizeof(double)}});
+}
+
+//! Write forces file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::write_forces(
+    const std::string& forces_file,
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>& forces) {
+  std::vector<std::uint64_t> ids, dirs;
+  std::vector<double> values;
+  for (const auto& force : forces) {
+    ids.emplace_back(std::get<0>(force));
+    dirs.emplace_back(std::get<1>(force));
+    values.emplace_back(std::get<2>(force));
+  }
+
+  return this->write_file(forces_file, mpm::binary::FileType::Forces,
+                          ids.size(), 0,
+                          {{ids.data(), ids.size() * sizeof(std::uint64_t)},
+                           {dirs.data(), dirs.size() * sizeof(std::uint64_t)},
+                           {values.data(), values.size() * sizeof(double)}});
+}
+
+//! Convert an ascii file to a binary file
+template <unsigned Tdim>
+bool mpm::IOMeshBinary<Tdim>::convert_ascii(mpm::binary::FileType type,
+                                           const std::string& ascii_file,
+                                           const std::string& binary_file) {
+  // Ascii readers return empty data for a missing file
+  if (!std::ifstream(ascii_file).good()) {
+    console_->error("{} #{}: Unable to open ascii file: {}\n", __FILE__,
+                    __LINE__, ascii_file);
+    return false;
+  }
+
+  auto ascii = std::make_unique<mpm::IOMeshAscii<Tdim>>();
+  switch (type) {
+    case mpm::binary::FileType::Mesh:
+      return this->write_mesh(binary_file, ascii->read_mesh_nodes(ascii_file),
+                              ascii->read_mesh_cells(ascii_file));
+    case mpm::binary::FileType::Particles:
+      return this->write_particles(binary_file,
+                                   ascii->read_particles(ascii_file));
+    case mpm::binary::FileType::ParticlesStresses:
+      return this->write_particles_stresses(
+          binary_file, ascii->read_particles_stresses(ascii_file));
+    case mpm::binary::FileType::EulerAngles:
+      return this->write_euler_angles(binary_file,
+                                      ascii->read_euler_angles(ascii_file));
+    case mpm::binary::FileType::ParticlesVolumes:
+      return this->write_particles_volumes(
+          binary_file, ascii->read_particles_volumes(ascii_file));
+    case mpm::binary::FileType::ParticlesCells:
+      this->write_particles_cells(binary_file,
+                                  ascii->read_particles_cells(ascii_file));
+      return true;
+    case mpm::binary::FileType::VelocityConstraints:
+      return this->write_velocity_constraints(
+          binary_file, ascii->read_velocity_constraints(ascii_file));
+    case mpm::binary::FileType::FrictionConstraints:
+      return this->write_friction_constraints(
+          binary_file, ascii->read_friction_constraints(ascii_file));
+    case mpm::binary::FileType::Forces:
+      return this->write_forces(binary_file, ascii->read_forces(ascii_file));
+    case mpm::binary::FileType::EntitySets:
+      try {
+        mpm::entity_sets::convert_json(ascii_file, binary_file);
+        return true;
+      } catch (std::exception& exception) {
+        console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+        return false;
+      }
+  }
+  return false;
+}
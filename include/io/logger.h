@@ -24,6 +24,9 @@ struct Logger {
   // Create a logger for reading ascii mesh
   static const std::shared_ptr<spdlog::logger> io_mesh_ascii_logger;
 
+  // Create a logger for reading binary mesh
+  static const std::shared_ptr<spdlog::logger> io_mesh_binary_logger;
+
   // Create a logger for point generator
   static const std::shared_ptr<spdlog::logger> point_generator_logger;
 
@@ -41,6 +44,9 @@ struct Logger {
 
   // Create a logger for MPM Explicit USL
   static const std::shared_ptr<spdlog::logger> mpm_explicit_usl_logger;
+
+  // Create a logger for output pipeline, which logs from its writer thread
+  static const std::shared_ptr<spdlog::logger> output_pipeline_logger;
 };
 
 }  // namespace mpm
@@ -0,0 +1,73 @@
+#ifndef MPM_MAPPED_FILE_H_
+#define MPM_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mpm {
+
+//! MappedFile class
+//! \brief Read-only memory map of a file, unmapped on destruction
+class MappedFile {
+ public:
+  //! Constructor maps the whole file
+  //! \param[in] filename Name of the file
+  explicit MappedFile(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error("Unable to open file: " + filename);
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Unable to stat file: " + filename);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+
+    // An empty file can not be mapped
+    if (size_ > 0) {
+      void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("Unable to map file: " + filename);
+      }
+      data_ = static_cast<const char*>(data);
+      // Files are read front to back
+      ::madvise(data, size_, MADV_SEQUENTIAL);
+    }
+    // The mapping stays valid after the file is closed
+    ::close(fd);
+  }
+
+  //! Destructor
+  ~MappedFile() {
+    if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+  }
+
+  //! Delete copy constructor
+  MappedFile(const MappedFile&) = delete;
+
+  //! Delete assignement operator
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  //! Return the first byte of the file
+  const char* data() const { return data_; }
+
+  //! Return the size of the file in bytes
+  std::size_t size() const { return size_; }
+
+ private:
+  //! First byte of the mapped file
+  const char* data_{nullptr};
+  //! Size of the file in bytes
+  std::size_t size_{0};
+};  // MappedFile class
+}  // namespace mpm
+
+#endif  // MPM_MAPPED_FILE_H_
@@ -0,0 +1,84 @@
+#ifndef MPM_OUTPUT_PIPELINE_H_
+#define MPM_OUTPUT_PIPELINE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "logger.h"
+
+namespace mpm {
+
+//! OutputPipeline class
+//! \brief Writes output snapshots on a background thread
+//! \details A writer stages a snapshot of the data it writes on the solver
+//! thread and returns a task that writes the snapshot to disk, which runs on
+//! the writer thread while the solver continues. At most nbuffers snapshots
+//! are held at a time: staging waits for a buffer to be freed when the writer
+//! thread falls behind. With no buffers, tasks are written on staging.
+class OutputPipeline {
+ public:
+  //! Task writing a snapshot
+  using Task = std::function<void()>;
+
+  //! Constructor
+  //! \param[in] nbuffers Maximum number of snapshots held
+  explicit OutputPipeline(unsigned nbuffers = 2);
+
+  //! Destructor writes queued snapshots
+  ~OutputPipeline();
+
+  //! Delete copy constructor
+  OutputPipeline(const OutputPipeline&) = delete;
+
+  //! Delete assignment operator
+  OutputPipeline& operator=(const OutputPipeline&) = delete;
+
+  //! Stage a snapshot on a free buffer and queue its write
+  //! \param[in] stage Takes a snapshot and returns the task writing it
+  void submit(const std::function<Task()>& stage);
+
+  //! Wait for all queued snapshots to be written
+  void flush();
+
+  //! Number of snapshots held at most
+  unsigned nbuffers() const { return nbuffers_; }
+
+  //! Number of times staging waited for the writer thread
+  std::size_t nstalls() const;
+
+ private:
+  //! Write queued tasks until stopped
+  void run();
+
+  //! Run a task and log its errors
+  void write(const Task& task) const;
+
+  //! Maximum number of snapshots held
+  unsigned nbuffers_{2};
+  //! Number of snapshots staged and not yet written
+  unsigned nstaged_{0};
+  //! Tasks to be written
+  std::deque<Task> tasks_;
+  //! Stop writer thread once the queue is empty
+  bool stop_{false};
+  //! Number of times staging waited for a buffer
+  std::size_t nstalls_{0};
+  //! Mutex of the queue
+  mutable std::mutex mutex_;
+  //! Signal a queued task to the writer thread
+  std::condition_variable task_queued_;
+  //! Signal a freed buffer to the solver thread
+  std::condition_variable task_written_;
+  //! Writer thread
+  std::thread thread_;
+  //! Logger
+  std::shared_ptr<spdlog::logger> console_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_OUTPUT_PIPELINE_H_
@@ -19,9 +19,15 @@
 #include <vtkVertexGlyphFilter.h>
 #include <vtkXMLPolyDataWriter.h>
 #include <vtkZLibDataCompressor.h>
+#if VTK_MAJOR_VERSION > 8 || (VTK_MAJOR_VERSION == 8 && VTK_MINOR_VERSION >= 2)
+#include <vtkLZ4DataCompressor.h>
+#endif
 
 #include <fstream>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "data_types.h"
@@ -60,6 +66,22 @@ class VtkWriter {
       const std::vector<Eigen::Matrix<double, 6, 1>>& data,
       const std::string& data_fields);
 
+  //! Write all point data to a file, appended as raw binary
+  //! \param[in] filename Output file to write geometry and data
+  //! \param[in] scalars Field names and scalar data
+  //! \param[in] vectors Field names and vector data
+  //! \param[in] tensors Field names and tensor data
+  //! \param[in] compressor Compressor of data ("none", "zlib", "lz4")
+  void write_point_data(
+      const std::string& filename,
+      const std::vector<std::pair<std::string, std::vector<double>>>& scalars,
+      const std::vector<std::pair<std::string, std::vector<Eigen::Vector3d>>>&
+          vectors,
+      const std::vector<
+          std::pair<std::string, std::vector<Eigen::Matrix<double, 6, 1>>>>&
+          tensors,
+      const std::string& compressor = "zlib");
+
   //! Write mesh
   //! \param[in] filename Mesh VTP file
   //! \param[in] coordinates Nodal coordinates
@@ -80,6 +102,18 @@ class VtkWriter {
                           unsigned step, unsigned max_steps,
                           unsigned ncomponents = 3);
 
+  //! Write Parallel VTK file of many data fields
+  //! \param[in] filename Mesh PVTP file name
+  //! \param[in] attribute Name of VTP files of the ranks
+  //! \param[in] fields Names and number of components of data fields
+  //! \param[in] mpi_size Number of MPI tasks
+  //! \param[in] step Current time step
+  //! \param[in] max_steps Maximum number of steps in the simulation
+  void write_parallel_vtk(
+      const std::string& filename, const std::string& attribute,
+      const std::vector<std::pair<std::string, unsigned>>& fields,
+      int mpi_size, unsigned step, unsigned max_steps);
+
  private:
   //! Vector of nodal coordinates
   vtkSmartPointer<vtkPoints> points_;
@@ -39,7 +39,8 @@ bool mpm::Constraints<Tdim>::assign_nodal_velocity_constraints(
       // Velocity
       double velocity = std::get<2>(velocity_constraint);
 
-      // Apply constraint
+      // Apply constraint to nodes of the rank
+      if (mesh_->is_nonlocal_node(nid)) continue;
       if (!mesh_->node(nid)->assign_velocity_constraint(dir, velocity))
         throw std::runtime_error(
             "Nodal velocity constraints assignment failed");
@@ -94,7 +95,8 @@ bool mpm::Constraints<Tdim>::assign_nodal_friction_constraints(
       // Friction
       double friction = std::get<3>(friction_constraint);
 
-      // Apply constraint
+      // Apply constraint to nodes of the rank
+      if (mesh_->is_nonlocal_node(nid)) continue;
       if (!mesh_->node(nid)->assign_friction_constraint(dir, sign, friction))
         throw std::runtime_error(
             "Nodal friction constraints assignment failed");
@@ -14,6 +14,12 @@ mpm::Bingham<Tdim>::Bingham(unsigned id, const Json& material_properties)
         material_properties["critical_shear_rate"].template get<double>();
     // Calculate bulk modulus
     bulk_modulus_ = youngs_modulus_ / (3.0 * (1. - 2. * poisson_ratio_));
+    // Set threshold for minimum critical shear rate
+    const double shear_rate_threshold = 1.0E-15;
+    if (critical_shear_rate_ < shear_rate_threshold)
+      critical_shear_rate_ = shear_rate_threshold;
+    critical_shear_rate2_ = critical_shear_rate_ * critical_shear_rate_;
+    tau02_ = tau0_ * tau0_;
 
     // Special material properties
     if (material_properties.contains("incompressible")) {
@@ -56,74 +62,71 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::Bingham<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  return this->compute_fluid_stress(ptr->strain_rate(),
+                                    ptr->dvolumetric_strain(),
+                                    &(*state_vars).at("pressure"));
+}
 
-  // Get strain rate
-  auto strain_rate = ptr->strain_rate();
-
-  // Convert strain rate to rate of deformation tensor
-  strain_rate.tail(3) *= 0.5;
-
-  // Set threshold for minimum critical shear rate
-  const double shear_rate_threshold = 1.0E-15;
-  if (critical_shear_rate_ < shear_rate_threshold)
-    critical_shear_rate_ = shear_rate_threshold;
+//! Compute stresses of a batch of particles from their kinematics
+template <unsigned Tdim>
+void mpm::Bingham<Tdim>::compute_stresses(StressPoint* points,
+                                          std::size_t npoints) {
+  for (std::size_t i = 0; i < npoints; ++i) {
+    StressPoint& point = points[i];
+    *point.stress = this->compute_fluid_stress(
+        *point.strain_rate, point.dvolumetric_strain,
+        &pressure_(point.state_vars));
+  }
+}
 
+//! Compute stress from the kinematics of the fluid
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::Bingham<Tdim>::compute_fluid_stress(
+    const Vector6d& strain_rate, double dvolumetric_strain,
+    double* pressure) const {
+  // Rate of deformation tensor D = strain rate with halved shear components
   // Rate of shear = sqrt(2 * D_ij * D_ij)
   // Since D (D_ij) is in Voigt notation (D_i), and the definition above is in
   // matrix, the last 3 components have to be doubled D_ij * D_ij = D_0^2 +
-  // D_1^2 + D_2^2 + 2*D_3^2 + 2*D_4^2 + 2*D_5^2 Yielding is defined: rate of
-  // shear > critical_shear_rate_^2 Checking yielding from strain rate vs
-  // critical yielding shear rate
-  double shear_rate =
-      std::sqrt(2. * (strain_rate.dot(strain_rate) +
-                      strain_rate.tail(3).dot(strain_rate.tail(3))));
-
-  // Apparent_viscosity maps shear rate to shear stress
-  // Check if shear rate is 0
-  double apparent_viscosity = 0.;
-  if (shear_rate * shear_rate > critical_shear_rate_ * critical_shear_rate_)
-    apparent_viscosity = 2. * ((tau0_ / shear_rate) + mu_);
+  // D_1^2 + D_2^2 + 2*D_3^2 + 2*D_4^2 + 2*D_5^2, which in terms of the strain
+  // rate is 2 * D_ij * D_ij = 2 * (e_0^2 + e_1^2 + e_2^2) + e_3^2 + e_4^2 +
+  // e_5^2
+  const double shear_rate2 =
+      2. * strain_rate.template head<3>().squaredNorm() +
+      strain_rate.template tail<3>().squaredNorm();
 
-  // Compute shear change to volumetric
   // tau deviatoric part of cauchy stress tensor
-  Eigen::Matrix<double, 6, 1> tau = apparent_viscosity * strain_rate;
+  Vector6d updated_stress = Vector6d::Zero();
 
-  // von Mises criterion
-  // trace of second invariant J2 of deviatoric stress in matrix form
-  // Since tau is in Voigt notation, only the first three numbers matter
-  // yield condition trace of the invariant > tau0^2
-  const double trace_invariant2 = 0.5 * (tau.head(3)).dot(tau.head(3));
-  if (trace_invariant2 < (tau0_ * tau0_)) tau.setZero();
+  // Apparent_viscosity maps shear rate to shear stress
+  // Yielding is defined: rate of shear > critical_shear_rate_^2
+  if (shear_rate2 > critical_shear_rate2_) {
+    const double apparent_viscosity =
+        2. * ((tau0_ / std::sqrt(shear_rate2)) + mu_);
+    updated_stress.template head<3>() =
+        apparent_viscosity * strain_rate.template head<3>();
+    updated_stress.template tail<3>() =
+        (0.5 * apparent_viscosity) * strain_rate.template tail<3>();
+
+    // von Mises criterion
+    // trace of second invariant J2 of deviatoric stress in matrix form
+    // Since tau is in Voigt notation, only the first three numbers matter
+    // yield condition trace of the invariant > tau0^2
+    if (0.5 * updated_stress.template head<3>().squaredNorm() < tau02_)
+      updated_stress.setZero();
+  }
 
   // Update pressure
-  (*state_vars).at("pressure") +=
-      (compressibility_multiplier_ *
-       this->thermodynamic_pressure(ptr->dvolumetric_strain()));
+  (*pressure) += compressibility_multiplier_ *
+                 this->thermodynamic_pressure(dvolumetric_strain);
 
   // Update volumetric and deviatoric stress
   // thermodynamic pressure is from material point
   // stress = -thermodynamic_pressure I + tau, where I is identity matrix or
-  // direc_delta in Voigt notation
-  const Eigen::Matrix<double, 6, 1> updated_stress =
-      -(*state_vars).at("pressure") * this->dirac_delta() *
-          compressibility_multiplier_ +
-      tau;
+  // direc_delta in Voigt notation, which is non-zero in the first Tdim
+  // components
+  updated_stress.template head<Tdim>().array() -=
+      (*pressure) * compressibility_multiplier_;
 
   return updated_stress;
 }
-
-//! Dirac delta 2D
-template <>
-inline Eigen::Matrix<double, 6, 1> mpm::Bingham<2>::dirac_delta() const {
-
-  return (Eigen::Matrix<double, 6, 1>() << 1.f, 1.f, 0.f, 0.f, 0.f, 0.f)
-      .finished();
-}
-
-//! Dirac delta 3D
-template <>
-inline Eigen::Matrix<double, 6, 1> mpm::Bingham<3>::dirac_delta() const {
-
-  return (Eigen::Matrix<double, 6, 1>() << 1.f, 1.f, 1.f, 0.f, 0.f, 0.f)
-      .finished();
-}
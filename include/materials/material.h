@@ -1,6 +1,8 @@
 #ifndef MPM_MATERIAL_MATERIAL_H_
 #define MPM_MATERIAL_MATERIAL_H_
 
+#include <atomic>
+#include <cassert>
 #include <limits>
 
 #include "Eigen/Dense"
@@ -22,6 +24,10 @@ namespace mpm {
 template <unsigned Tdim>
 class ParticleBase;
 
+// Forward declaration of StressPoint
+template <unsigned Tdim>
+struct StressPoint;
+
 //! Material base class
 //! \brief Base class that stores the information about materials
 //! \details Material class stresses and strains
@@ -78,13 +84,74 @@ class Material {
                                   const ParticleBase<Tdim>* ptr,
                                   mpm::dense_map* state_vars) = 0;
 
+  //! Stress update of a particle
+  using StressPoint = mpm::StressPoint<Tdim>;
+
+  //! Compute stresses of a batch of particles of the material
+  //! \details Stresses are updated one at a time with compute_stress, unless
+  //! a model updates them from the stress points directly
+  //! \param[in] points Stress updates of particles
+  //! \param[in] npoints Number of particles
+  virtual void compute_stresses(StressPoint* points, std::size_t npoints);
+
+  //! Number of stress updates with local (plastic) iterations
+  unsigned long long nupdates() const { return nupdates_.load(); }
+
+  //! Number of local iterations spent in stress integration
+  unsigned long long niterations() const { return niterations_.load(); }
+
+  //! Number of stress updates that did not converge
+  unsigned long long nnonconverged() const { return nnonconverged_.load(); }
+
+  //! Write iteration statistics to the log and reset the counters
+  void log_iteration_statistics();
+
  protected:
+  //! State variable of particles, found with the hash of its name, which is
+  //! computed once per material
+  class StateVariable {
+   public:
+    //! Constructor
+    //! \param[in] name Name of the state variable
+    explicit StateVariable(const std::string& name)
+        : name_{name}, hash_{mpm::dense_map::hasher()(name)} {}
+
+    //! Return the value of the state variable of a particle
+    //! \param[in] state_vars State variables of the particle, with this one
+    double& operator()(mpm::dense_map* state_vars) const {
+      auto itr = state_vars->find(name_, hash_);
+      assert(itr != state_vars->end());
+      return itr.value();
+    }
+
+   private:
+    //! Name
+    std::string name_;
+    //! Hash of the name
+    std::size_t hash_;
+  };
+
+  //! Record iterations of a stress update
+  //! \param[in] niterations Number of local iterations
+  //! \param[in] converged Status of convergence
+  void record_iterations(unsigned niterations, bool converged) {
+    nupdates_.fetch_add(1, std::memory_order_relaxed);
+    niterations_.fetch_add(niterations, std::memory_order_relaxed);
+    if (!converged) nnonconverged_.fetch_add(1, std::memory_order_relaxed);
+  }
+
   //! material id
   unsigned id_{std::numeric_limits<unsigned>::max()};
   //! Material properties
   Json properties_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
+  //! Number of stress updates with local iterations
+  std::atomic<unsigned long long> nupdates_{0};
+  //! Number of local iterations
+  std::atomic<unsigned long long> niterations_{0};
+  //! Number of non-converged stress updates
+  std::atomic<unsigned long long> nnonconverged_{0};
 };  // Material class
 }  // namespace mpm
 
@@ -11,3 +11,29 @@ Ttype mpm::Material<Tdim>::property(const std::string& key) {
         "Property call to material parameter not found or invalid type");
   }
 }
+
+//! Compute stresses of a batch of particles of the material
+template <unsigned Tdim>
+void mpm::Material<Tdim>::compute_stresses(StressPoint* points,
+                                           std::size_t npoints) {
+  for (std::size_t i = 0; i < npoints; ++i) {
+    StressPoint& point = points[i];
+    *point.stress = this->compute_stress(*point.stress, *point.dstrain,
+                                         point.particle, point.state_vars);
+  }
+}
+
+//! Write iteration statistics to the log and reset the counters
+template <unsigned Tdim>
+void mpm::Material<Tdim>::log_iteration_statistics() {
+  const unsigned long long nupdates = nupdates_.exchange(0);
+  const unsigned long long niterations = niterations_.exchange(0);
+  const unsigned long long nnonconverged = nnonconverged_.exchange(0);
+  if (nupdates == 0) return;
+  console_->info(
+      "Stress integration: {} updates, {} iterations ({:.2f} per update), {} "
+      "not converged",
+      nupdates, niterations,
+      static_cast<double>(niterations) / static_cast<double>(nupdates),
+      nnonconverged);
+}
@@ -42,6 +42,13 @@ inline double lode_angle(
     const Eigen::Matrix<double, 6, 1>& stress,
     double tolerance = std::numeric_limits<double>::epsilon());
 
+//! Compute Lode angle theta (cosine convention) from known invariants
+//! \param[in] j2 J2 invariant
+//! \param[in] j3 J3 invariant
+//! \param[in] tolerance Default tolerance value specified by user
+//! \retval theta Lode angle theta (cosine convention)
+inline double lode_angle(double j2, double j3, double tolerance);
+
 //! Compute derivative of p in terms of stress sigma
 //! \param[in] stress Stress in Voigt notation where positive is tension
 //! \retval dp_dsigma Derivative of p in terms of stress sigma
@@ -54,6 +61,13 @@ inline const Eigen::Matrix<double, 6, 1> dp_dsigma(
 inline const Eigen::Matrix<double, 6, 1> dq_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress);
 
+//! Compute derivative of q in terms of stress sigma from known invariants
+//! \param[in] deviatoric_stress Deviatoric stress in Voigt notation
+//! \param[in] q Deviatoric q
+//! \retval dq_dsigma Derivative of q in terms of stress sigma
+inline const Eigen::Matrix<double, 6, 1> dq_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double q);
+
 //! Compute derivative of J2 in terms of stress sigma
 //! \param[in] stress Stress in Voigt notation where positive is tension
 //! \retval dj2_dsigma Derivative of J2 in terms of stress sigma
@@ -66,6 +80,13 @@ inline const Eigen::Matrix<double, 6, 1> dj2_dsigma(
 inline const Eigen::Matrix<double, 6, 1> dj3_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress);
 
+//! Compute derivative of J3 in terms of stress sigma from known invariants
+//! \param[in] deviatoric_stress Deviatoric stress in Voigt notation
+//! \param[in] j2 J2 invariant
+//! \retval dj3_dsigma Derivative of J3 in terms of stress sigma
+inline const Eigen::Matrix<double, 6, 1> dj3_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double j2);
+
 //! Compute derivative of Lode angle theta in terms of stress sigma
 //! \param[in] stress Stress in Voigt notation where positive is tension
 //! \param[in] tolerance Default tolerance value specified by user
@@ -75,6 +96,18 @@ inline const Eigen::Matrix<double, 6, 1> dtheta_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress,
     double tolerance = std::numeric_limits<double>::epsilon());
 
+//! Compute derivative of Lode angle theta in terms of stress sigma from known
+//! invariants
+//! \param[in] deviatoric_stress Deviatoric stress in Voigt notation
+//! \param[in] j2 J2 invariant
+//! \param[in] j3 J3 invariant
+//! \param[in] tolerance Default tolerance value specified by user
+//! \retval dtheta_dsigma Derivative of Lode angle theta in terms of stress
+//! sigma
+inline const Eigen::Matrix<double, 6, 1> dtheta_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double j2, double j3,
+    double tolerance);
+
 //! Compute plastic deviatoric strain
 //! \param[in] plastic_strain Plastic strain in Voigt notation where positive is
 //! tension
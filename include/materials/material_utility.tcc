@@ -63,11 +63,13 @@ inline double mpm::materials::q(const Eigen::Matrix<double, 6, 1>& stress) {
 //! Compute Lode angle
 inline double mpm::materials::lode_angle(
     const Eigen::Matrix<double, 6, 1>& stress, const double tolerance) {
+  return mpm::materials::lode_angle(mpm::materials::j2(stress),
+                                    mpm::materials::j3(stress), tolerance);
+}
 
-  // Compute j2 and j3
-  const double j2 = mpm::materials::j2(stress);
-  const double j3 = mpm::materials::j3(stress);
-
+//! Compute Lode angle from known invariants
+inline double mpm::materials::lode_angle(double j2, double j3,
+                                         double tolerance) {
   // Compute Lode angle value
   double lode_angle_val = 0.0;
   if (std::abs(j2) > tolerance) {
@@ -95,12 +97,13 @@ inline const Eigen::Matrix<double, 6, 1> mpm::materials::dp_dsigma(
 //! Compute derivative of q in terms of stress sigma
 inline const Eigen::Matrix<double, 6, 1> mpm::materials::dq_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress) {
+  return mpm::materials::dq_dsigma(mpm::materials::deviatoric_stress(stress),
+                                   mpm::materials::q(stress));
+}
 
-  // Compute q
-  const double q = mpm::materials::q(stress);
-
-  // Compute deviatoric stress
-  const auto deviatoric_stress = mpm::materials::deviatoric_stress(stress);
+//! Compute derivative of q in terms of stress sigma from known invariants
+inline const Eigen::Matrix<double, 6, 1> mpm::materials::dq_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double q) {
 
   // Compute dq / dsigma
   Eigen::Matrix<double, 6, 1> dq_dsigma = Eigen::Matrix<double, 6, 1>::Zero();
@@ -132,12 +135,13 @@ inline const Eigen::Matrix<double, 6, 1> mpm::materials::dj2_dsigma(
 //! Compute derivative of J3 in terms of stress sigma
 inline const Eigen::Matrix<double, 6, 1> mpm::materials::dj3_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress) {
+  return mpm::materials::dj3_dsigma(mpm::materials::deviatoric_stress(stress),
+                                    mpm::materials::j2(stress));
+}
 
-  // Compute J2
-  const double j2 = mpm::materials::j2(stress);
-
-  // Compute deviatoric stress
-  const auto deviatoric_stress = mpm::materials::deviatoric_stress(stress);
+//! Compute derivative of J3 in terms of stress sigma from known invariants
+inline const Eigen::Matrix<double, 6, 1> mpm::materials::dj3_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double j2) {
 
   // Compute dj3 / dsigma
   Eigen::Matrix<double, 3, 1> dev1;
@@ -167,18 +171,25 @@ inline const Eigen::Matrix<double, 6, 1> mpm::materials::dj3_dsigma(
 //! Compute derivative of Lode angle theta in terms of stress sigma
 inline const Eigen::Matrix<double, 6, 1> mpm::materials::dtheta_dsigma(
     const Eigen::Matrix<double, 6, 1>& stress, const double tolerance) {
+  return mpm::materials::dtheta_dsigma(
+      mpm::materials::deviatoric_stress(stress), mpm::materials::j2(stress),
+      mpm::materials::j3(stress), tolerance);
+}
 
-  // Compute J2
-  const double j2 = mpm::materials::j2(stress);
-
-  // Compute J3
-  const double j3 = mpm::materials::j3(stress);
+//! Compute derivative of Lode angle theta in terms of stress sigma from known
+//! invariants
+inline const Eigen::Matrix<double, 6, 1> mpm::materials::dtheta_dsigma(
+    const Eigen::Matrix<double, 6, 1>& deviatoric_stress, double j2, double j3,
+    double tolerance) {
 
   // Compute dj2_dsigma
-  const auto dj2_dsigma = mpm::materials::dj2_dsigma(stress);
+  Eigen::Matrix<double, 6, 1> dj2_dsigma = deviatoric_stress;
+  dj2_dsigma(3) *= 2.0;
+  dj2_dsigma(4) *= 2.0;
+  dj2_dsigma(5) *= 2.0;
 
   // Compute dj3_dsigma
-  const auto dj3_dsigma = mpm::materials::dj3_dsigma(stress);
+  const auto dj3_dsigma = mpm::materials::dj3_dsigma(deviatoric_stress, j2);
 
   // Define derivatives of R in terms of J2 and J3
   double dr_dj2 = -9.0 / 4.0 * sqrt(3.0) * j3;
@@ -1,7 +1,10 @@
 #ifndef MPM_MATERIAL_MODIFIED_CAM_CLAY_H_
 #define MPM_MATERIAL_MODIFIED_CAM_CLAY_H_
 
+#include <algorithm>
+#include <array>
 #include <limits>
+#include <string>
 
 #include <cmath>
 
@@ -46,6 +49,8 @@ class ModifiedCamClay : public Material<Tdim> {
   std::vector<std::string> state_variables() const override;
 
   //! Compute stress
+  //! \details Plastic increments are split into substeps whose size follows
+  //! the local error, the difference between one step and two half steps
   //! \param[in] stress Stress
   //! \param[in] dstrain Strain
   //! \param[in] particle Constant point to particle base
@@ -90,6 +95,18 @@ class ModifiedCamClay : public Material<Tdim> {
   //! \param[in] df_dmul dF / ddelta_phi
   void compute_df_dmul(const mpm::dense_map* state_vars, double* df_dmul);
 
+  //! Compute Jacobian of the return mapping residuals (F, G) with respect to
+  //! the consistency parameter and the preconsolidation pressure
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[in] pc_n Preconsolidation pressure of last step
+  //! \param[in] p_trial Volumetric trial stress
+  //! \param[in] q_trial Deviatoric trial stress
+  //! \param[in] m_theta M_theta of the trial stress
+  //! \retval jacobian d(F, G) / d(delta_phi, pc)
+  Eigen::Matrix2d compute_jacobian(const mpm::dense_map* state_vars,
+                                   const double pc_n, const double p_trial,
+                                   const double q_trial, const double m_theta);
+
   //! Compute dF/dSigma
   //! \param[in] state_vars History-dependent state variables
   //! \param[in] stress Stress
@@ -119,12 +136,28 @@ class ModifiedCamClay : public Material<Tdim> {
                               mpm::dense_map* state_vars);
 
  protected:
+  //! Integrate stress over a strain increment with a closest-point return
+  //! mapping (Newton iteration on delta_phi and pc)
+  //! \param[in] stress Stress
+  //! \param[in] dstrain Strain increment
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[out] updated_stress Updated value of stress
+  //! \param[out] niterations Number of Newton iterations
+  //! \retval status Convergence of the return mapping
+  bool integrate_stress(const Vector6d& stress, const Vector6d& dstrain,
+                        mpm::dense_map* state_vars, Vector6d* updated_stress,
+                        unsigned* niterations);
+
   //! material id
   using Material<Tdim>::id_;
   //! Material properties
   using Material<Tdim>::properties_;
   //! Logger
   using Material<Tdim>::console_;
+  //! Record iterations of a stress update
+  using Material<Tdim>::record_iterations;
+  //! State variable of particles
+  using StateVariable = typename Material<Tdim>::StateVariable;
 
  private:
   //! Elastic stiffness matrix
@@ -179,6 +212,23 @@ class ModifiedCamClay : public Material<Tdim> {
   double m_shear_ = {std::numeric_limits<double>::epsilon()};
   //! Hydrate saturation
   double s_h_{std::numeric_limits<double>::epsilon()};
+  //! Return mapping parameters
+  //! Relative tolerance of the yield and preconsolidation functions
+  double tolerance_{1.E-12};
+  //! Maximum number of Newton iterations
+  unsigned max_iterations_{25};
+  //! Maximum number of substeps of the strain increment
+  unsigned max_substeps_{16};
+  //! Relative tolerance of the local error of a substep, estimated from one
+  //! step and two half steps
+  double substep_tolerance_{1.E-4};
+  //! History variables restored when a substep is rejected
+  const std::array<StateVariable, 10> history_vars_{
+      {StateVariable{"bulk_modulus"}, StateVariable{"shear_modulus"},
+       StateVariable{"pc"}, StateVariable{"void_ratio"},
+       StateVariable{"pvstrain"}, StateVariable{"pdstrain"},
+       StateVariable{"dpvstrain"}, StateVariable{"dpdstrain"},
+       StateVariable{"chi"}, StateVariable{"subloading_r"}}};
 };  // ModifiedCamClay class
 }  // namespace mpm
 
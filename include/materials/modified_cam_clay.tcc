@@ -62,6 +62,23 @@ mpm::ModifiedCamClay<Tdim>::ModifiedCamClay(unsigned id,
       // Increment in shear modulus
       m_shear_ = material_properties.at("m_shear").template get<double>();
     }
+    // Return mapping tolerance
+    if (material_properties.find("tolerance") != material_properties.end())
+      tolerance_ = material_properties.at("tolerance").template get<double>();
+    // Maximum number of Newton iterations
+    if (material_properties.find("max_iterations") != material_properties.end())
+      max_iterations_ =
+          material_properties.at("max_iterations").template get<unsigned>();
+    // Maximum number of substeps
+    if (material_properties.find("max_substeps") != material_properties.end())
+      max_substeps_ =
+          material_properties.at("max_substeps").template get<unsigned>();
+    if (max_substeps_ < 1) max_substeps_ = 1;
+    // Tolerance of the local error of substeps
+    if (material_properties.find("substep_tolerance") !=
+        material_properties.end())
+      substep_tolerance_ =
+          material_properties.at("substep_tolerance").template get<double>();
 
     // Properties
     properties_ = material_properties;
@@ -447,6 +464,57 @@ void mpm::ModifiedCamClay<Tdim>::compute_df_dmul(
   }
 }
 
+//! Compute Jacobian of the return mapping residuals
+template <unsigned Tdim>
+Eigen::Matrix2d mpm::ModifiedCamClay<Tdim>::compute_jacobian(
+    const mpm::dense_map* state_vars, const double pc_n, const double p_trial,
+    const double q_trial, const double m_theta) {
+  // Stress invariants
+  const double p = (*state_vars).at("p");
+  const double q = (*state_vars).at("q");
+  // Preconsolidation pressure
+  const double pc = (*state_vars).at("pc");
+  // Get bonding parameters
+  const double pcd = (*state_vars).at("pcd");
+  const double pcc = (*state_vars).at("pcc");
+  // Subloading surface ratio
+  const double subloading_r = (*state_vars).at("subloading_r");
+  // Get elastic modulus
+  const double e_b = (*state_vars).at("bulk_modulus");
+  const double e_s = (*state_vars).at("shear_modulus");
+  // Get consistency parameter
+  const double mul = (*state_vars).at("delta_phi");
+  // Upsilon
+  const double upsilon =
+      (1 + (*state_vars).at("void_ratio")) / (lambda_ - kappa_);
+  // Denominators of p and q updates
+  const double a_den = 1 + 2 * e_b * mul;
+  const double b_den = 1 + 6 * e_s * mul / (m_theta * m_theta);
+  // Compute dp / dmul and dp / dpc
+  const double dp_dmul = e_b * (pc - 2 * p) / a_den;
+  const double dp_dpc = e_b * mul / a_den;
+  // Compute dq / dmul
+  const double dq_dmul = -q * 6 * e_s / (m_theta * m_theta) / b_den;
+  // Compute dF / dp, dF / dq and dF / dpc
+  const double df_dp = 2 * p + pcc - subloading_r * (pc + pcd + pcc);
+  const double df_dq = 2 * q / (m_theta * m_theta);
+  const double df_dpc = -subloading_r * (p + pcc);
+  // Exponential of preconsolidation function
+  const double g_exp =
+      pc_n * exp(upsilon * mul * (2 * p_trial - pc - pcd) / a_den);
+
+  Eigen::Matrix2d jacobian;
+  // dF / dmul
+  jacobian(0, 0) = df_dp * dp_dmul + df_dq * dq_dmul;
+  // dF / dpc
+  jacobian(0, 1) = df_dp * dp_dpc + df_dpc;
+  // dG / dmul
+  jacobian(1, 0) = g_exp * upsilon * (2 * p_trial - pc - pcd) / (a_den * a_den);
+  // dG / dpc
+  jacobian(1, 1) = -g_exp * upsilon * mul / a_den - 1;
+  return jacobian;
+}
+
 //! Compute dg/dpc
 template <unsigned Tdim>
 void mpm::ModifiedCamClay<Tdim>::compute_dg_dpc(
@@ -518,14 +586,106 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
-  // Tolerance for yield function
-  const double Ftolerance = 1.E-5;
-  // Tolerance for preconsolidation function
-  const double Gtolerance = 1.E-5;
-  // Maximum iteration step number
-  const int itrstep = 100;
-  // Maximum subiteration step number
-  const int substep = 100;
+  // History variables at the start of a substep
+  std::array<double, 10> history;
+  auto save_history = [&]() {
+    for (unsigned i = 0; i < history_vars_.size(); ++i)
+      history[i] = history_vars_[i](state_vars);
+  };
+  auto restore_history = [&]() {
+    for (unsigned i = 0; i < history_vars_.size(); ++i)
+      history_vars_[i](state_vars) = history[i];
+  };
+  // Preconsolidation pressure
+  const StateVariable& pc = history_vars_[2];
+
+  // Fraction of the strain increment integrated and size of the substep
+  double time = 0.;
+  double dtime = 1.;
+  const double min_dtime = 1. / max_substeps_;
+  // Total number of Newton iterations
+  unsigned niterations = 0;
+  // Convergence status
+  bool converged = true;
+  // Updated stress
+  Vector6d updated_stress = stress;
+  // Substeps sized by the difference between one step and two half steps
+  while (1. - time > std::numeric_limits<double>::epsilon()) {
+    dtime = std::min(dtime, 1. - time);
+    save_history();
+
+    // One step over the substep
+    Vector6d full_stress;
+    unsigned full_iterations = 0;
+    const bool full_converged =
+        this->integrate_stress(updated_stress, dstrain * dtime, state_vars,
+                               &full_stress, &full_iterations);
+    niterations += full_iterations;
+    // Elastic substeps need no error estimate
+    if (full_converged && full_iterations == 0) {
+      updated_stress = full_stress;
+      time += dtime;
+      continue;
+    }
+    const double full_pc = pc(state_vars);
+
+    // Two steps over the halves of the substep
+    restore_history();
+    const Vector6d half_dstrain = 0.5 * dtime * dstrain;
+    Vector6d half_stress = updated_stress;
+    bool half_converged = true;
+    for (unsigned i = 0; i < 2; ++i) {
+      Vector6d substep_stress;
+      unsigned substep_iterations = 0;
+      half_converged = this->integrate_stress(half_stress, half_dstrain,
+                                              state_vars, &substep_stress,
+                                              &substep_iterations) &&
+                       half_converged;
+      half_stress = substep_stress;
+      niterations += substep_iterations;
+    }
+
+    // Relative local error of the stress and preconsolidation pressure
+    const double error = std::max(
+        (half_stress - full_stress).norm() / std::max(half_stress.norm(), 1.),
+        std::fabs(pc(state_vars) - full_pc) /
+            std::max(std::fabs(pc(state_vars)), 1.));
+    const bool substep_converged = full_converged && half_converged;
+    // Ratio of the next substep size to the current one
+    const double ratio =
+        (error > 0.) ? 0.9 * std::sqrt(substep_tolerance_ / error) : 2.;
+
+    if ((substep_converged && error <= substep_tolerance_) ||
+        dtime <= min_dtime) {
+      // Accept the more accurate solution of the two half steps
+      converged = converged && substep_converged;
+      updated_stress = half_stress;
+      time += dtime;
+      dtime = std::max(std::min(ratio, 2.) * dtime, min_dtime);
+    } else {
+      // Reject the substep and retry a smaller one
+      restore_history();
+      const double shrink =
+          substep_converged ? std::min(std::max(ratio, 0.25), 0.5) : 0.5;
+      dtime = std::max(shrink * dtime, min_dtime);
+    }
+  }
+  // Record iterations of plastic updates
+  if (niterations > 0 || !converged)
+    this->record_iterations(niterations, converged);
+
+  return updated_stress;
+}
+
+//! Integrate stress with a closest-point return mapping
+template <unsigned Tdim>
+bool mpm::ModifiedCamClay<Tdim>::integrate_stress(const Vector6d& stress,
+                                                  const Vector6d& dstrain,
+                                                  mpm::dense_map* state_vars,
+                                                  Vector6d* updated_stress,
+                                                  unsigned* niterations) {
+  // Initialise number of iterations
+  (*niterations) = 0;
   // Compute current mean pressure
   (*state_vars).at("p") = -(stress(0) + stress(1) + stress(2)) / 3.;
   // Set elastic tensor
@@ -556,12 +716,12 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   // Check yield status
   auto yield_type = this->compute_yield_state(state_vars);
   // Return the updated stress in elastic state
-  if (yield_type == FailureState::Elastic) return trial_stress;
+  if (yield_type == FailureState::Elastic) {
+    (*updated_stress) = trial_stress;
+    return true;
+  }
   //-------------------------------------------------------------------------
   // Plastic step
-  // Counters for interations
-  int counter_f = 0;
-  int counter_g = 0;
   // Initialise consistency parameter
   (*state_vars).at("delta_phi") = 0.;
   // Volumetric trial stress
@@ -572,32 +732,57 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
   const double m_theta_trial = (*state_vars).at("m_theta");
   // Preconsolidation pressure of last step
   const double pc_n = (*state_vars).at("pc");
-  // Initialise dF / dmul
-  double df_dmul = 0;
-  // Initialise updated stress
-  Vector6d updated_stress = trial_stress;
-  // Iteration for consistency parameter
-  while (std::fabs((*state_vars).at("f_function")) > Ftolerance &&
-         counter_f < itrstep) {
+  // Scale of yield and preconsolidation functions
+  const double pc_scale =
+      std::max(pc_n + (*state_vars).at("pcd") + (*state_vars).at("pcc"), 1.);
+  const double f_tolerance = tolerance_ * pc_scale * pc_scale;
+  const double g_tolerance = tolerance_ * pc_scale;
+  // Initialise G and dG / dpc
+  double g_function = 0.;
+  double dg_dpc = 0.;
+  // Convergence status
+  bool converged = false;
+  // Newton iteration for consistency parameter and preconsolidation pressure
+  while (true) {
+    // Check residuals of yield and preconsolidation functions
+    converged = (std::fabs((*state_vars).at("f_function")) <= f_tolerance &&
+                 std::fabs(g_function) <= g_tolerance);
+    if (converged || (*niterations) >= max_iterations_) break;
     // Get back the m_theta of trial_stress
     (*state_vars).at("m_theta") = m_theta_trial;
-    // Compute dF / dmul
-    this->compute_df_dmul(state_vars, &df_dmul);
-    // Update consistency parameter
-    (*state_vars).at("delta_phi") -= ((*state_vars).at("f_function") / df_dmul);
-    // Initialise G and dG / dpc
-    double g_function = 0;
-    double dg_dpc = 0;
-    // Compute G and dG / dpc
-    this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
-    // Subiteraction for preconsolidation pressure
-    while (std::fabs(g_function) > Gtolerance && counter_g < substep) {
+    if (!subloading_) {
+      // Compute Jacobian of the residuals
+      const Eigen::Matrix2d jacobian = this->compute_jacobian(
+          state_vars, pc_n, p_trial, q_trial, m_theta_trial);
+      if (std::fabs(jacobian.determinant()) <
+          std::numeric_limits<double>::min())
+        break;
+      // Newton increment of (delta_phi, pc)
+      const Eigen::Vector2d residual((*state_vars).at("f_function"),
+                                     g_function);
+      const Eigen::Vector2d increment = -jacobian.inverse() * residual;
+      // Keep the consistency parameter non-negative
+      const double delta_phi = (*state_vars).at("delta_phi");
+      if (delta_phi + increment(0) < 0.)
+        (*state_vars).at("delta_phi") = 0.5 * delta_phi;
+      else
+        (*state_vars).at("delta_phi") += increment(0);
       // Update preconsolidation pressure
-      (*state_vars).at("pc") -= g_function / dg_dpc;
-      // Update G and dG / dpc
+      (*state_vars).at("pc") += increment(1);
+    } else {
+      // The subloading ratio is re-initialised and clipped within the
+      // iteration, so delta_phi and pc are updated in a staggered way
+      double df_dmul = 0.;
+      this->compute_df_dmul(state_vars, &df_dmul);
+      // Update consistency parameter
+      (*state_vars).at("delta_phi") -= ((*state_vars).at("f_function") / df_dmul);
+      // Subiteration for preconsolidation pressure
       this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
-      // Counter subiteration step
-      ++counter_g;
+      for (unsigned i = 0;
+           std::fabs(g_function) > g_tolerance && i < max_iterations_; ++i) {
+        (*state_vars).at("pc") -= g_function / dg_dpc;
+        this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
+      }
     }
     // Update mean pressure p
     (*state_vars).at("p") =
@@ -630,10 +815,10 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     if (three_invariants_) {
       // Update stress
       // Type-1 Equation(3.16)
-      updated_stress = (*state_vars).at("q") * n_trial;
-      for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars).at("p");
+      (*updated_stress) = (*state_vars).at("q") * n_trial;
+      for (int i = 0; i < 3; ++i) (*updated_stress)(i) -= (*state_vars).at("p");
       // Compute stress invariants
-      this->compute_stress_invariants(updated_stress, state_vars);
+      this->compute_stress_invariants((*updated_stress), state_vars);
       // Compute deviatoric stress tensor
       n_trial =
           this->compute_deviatoric_stress_tensor(trial_stress, state_vars);
@@ -644,18 +829,20 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
     }
     // Update yield function
     yield_type = this->compute_yield_state(state_vars);
+    // Update G and dG / dpc
+    this->compute_dg_dpc(state_vars, pc_n, p_trial, &g_function, &dg_dpc);
     // Counter iteration step
-    ++counter_f;
+    ++(*niterations);
   }
   // Update plastic strain
   (*state_vars).at("pvstrain") += (*state_vars).at("dpvstrain");
   (*state_vars).at("pdstrain") += (*state_vars).at("dpdstrain");
   // Update stress
-  updated_stress = (*state_vars).at("q") * n_trial;
-  for (int i = 0; i < 3; ++i) updated_stress(i) -= (*state_vars).at("p");
+  (*updated_stress) = (*state_vars).at("q") * n_trial;
+  for (int i = 0; i < 3; ++i) (*updated_stress)(i) -= (*state_vars).at("p");
   // Update void_ratio
   (*state_vars).at("void_ratio") +=
       ((dstrain(0) + dstrain(1) + dstrain(2)) * (1 + e0_));
 
-  return updated_stress;
+  return converged;
 }
@@ -28,6 +28,28 @@ class MohrCoulomb : public Material<Tdim> {
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
 
+  //! Friction and dilation dependent terms of yield and potential functions
+  struct FrictionTerms {
+    //! Friction angle phi
+    double phi{0.};
+    //! Dilation angle psi
+    double psi{0.};
+    //! sin(phi)
+    double sin_phi{0.};
+    //! cos(phi)
+    double cos_phi{1.};
+    //! tan(phi)
+    double tan_phi{0.};
+    //! tan(psi)
+    double tan_psi{0.};
+    //! N_phi = (1 + sin(phi)) / (1 - sin(phi))
+    double n_phi{1.};
+    //! sqrt(N_phi)
+    double sqrt_n_phi{1.};
+    //! Shear-tension edge parameter alpha_p
+    double alpha_p{0.};
+  };
+
   //! Constructor with id and material properties
   //! \param[in] material_properties Material properties
   MohrCoulomb(unsigned id, const Json& material_properties);
@@ -97,6 +119,34 @@ class MohrCoulomb : public Material<Tdim> {
   //! Compute elastic tensor
   bool compute_elastic_tensor();
 
+  //! Compute friction and dilation dependent terms
+  //! \param[in] phi Friction angle
+  //! \param[in] psi Dilation angle
+  //! \retval terms Friction and dilation dependent terms
+  FrictionTerms compute_friction_terms(double phi, double psi) const;
+
+  //! Friction and dilation dependent terms of the current state
+  //! \details Peak and residual terms are cached, softening states in between
+  //! are evaluated on demand
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval terms Friction and dilation dependent terms
+  FrictionTerms friction_terms(const mpm::dense_map& state_vars) const;
+
+  //! Compute yield function and yield state with precomputed terms
+  //! \param[in] yield_function Yield functions (tension & shear)
+  //! \param[in] state_vars History-dependent state variables
+  //! \param[in] terms Friction and dilation dependent terms
+  //! \retval yield_type Yield type (elastic, shear or tensile)
+  mpm::mohrcoulomb::FailureState compute_yield_state(
+      Eigen::Matrix<double, 2, 1>* yield_function,
+      const mpm::dense_map& state_vars, const FrictionTerms& terms);
+
+  //! Compute dF/dSigma and dP/dSigma with precomputed terms
+  void compute_df_dp(mpm::mohrcoulomb::FailureState yield_type,
+                     const mpm::dense_map* state_vars, const Vector6d& stress,
+                     const FrictionTerms& terms, Vector6d* df_dsigma,
+                     Vector6d* dp_dsigma, double* dp_dq, double* softening);
+
   //! Elastic stiffness matrix
   Matrix6x6 de_;
   //! Density
@@ -129,6 +179,10 @@ class MohrCoulomb : public Material<Tdim> {
   double tension_cutoff_{std::numeric_limits<double>::max()};
   //! softening
   bool softening_{false};
+  //! Friction and dilation dependent terms at peak
+  FrictionTerms peak_terms_;
+  //! Friction and dilation dependent terms at residual
+  FrictionTerms residual_terms_;
 };  // MohrCoulomb class
 }  // namespace mpm
 
@@ -47,6 +47,10 @@ mpm::MohrCoulomb<Tdim>::MohrCoulomb(unsigned id,
     shear_modulus_ = youngs_modulus_ / (2.0 * (1 + poisson_ratio_));
     // Set elastic tensor
     this->compute_elastic_tensor();
+    // Friction and dilation dependent terms at peak and residual
+    peak_terms_ = this->compute_friction_terms(phi_peak_, psi_peak_);
+    residual_terms_ =
+        this->compute_friction_terms(phi_residual_, psi_residual_);
   } catch (std::exception& except) {
     console_->error("Material parameter not set: {}\n", except.what());
   }
@@ -102,6 +106,40 @@ bool mpm::MohrCoulomb<Tdim>::compute_elastic_tensor() {
   return true;
 }
 
+//! Compute friction and dilation dependent terms
+template <unsigned Tdim>
+typename mpm::MohrCoulomb<Tdim>::FrictionTerms
+    mpm::MohrCoulomb<Tdim>::compute_friction_terms(double phi,
+                                                   double psi) const {
+  FrictionTerms terms;
+  terms.phi = phi;
+  terms.psi = psi;
+  terms.sin_phi = sin(phi);
+  terms.cos_phi = cos(phi);
+  terms.tan_phi = tan(phi);
+  terms.tan_psi = tan(psi);
+  // Tension and shear edge parameters
+  terms.n_phi = (1. + terms.sin_phi) / (1. - terms.sin_phi);
+  terms.sqrt_n_phi = std::sqrt(terms.n_phi);
+  terms.alpha_p = std::sqrt(1. + terms.n_phi * terms.n_phi) + terms.n_phi;
+  return terms;
+}
+
+//! Friction and dilation dependent terms of the current state
+template <unsigned Tdim>
+typename mpm::MohrCoulomb<Tdim>::FrictionTerms
+    mpm::MohrCoulomb<Tdim>::friction_terms(
+        const mpm::dense_map& state_vars) const {
+  const double phi = state_vars.at("phi");
+  const double psi = state_vars.at("psi");
+  // Cached terms at peak and residual
+  if (phi == peak_terms_.phi && psi == peak_terms_.psi) return peak_terms_;
+  if (phi == residual_terms_.phi && psi == residual_terms_.psi)
+    return residual_terms_;
+  // Softening state in between
+  return this->compute_friction_terms(phi, psi);
+}
+
 //! Compute stress invariants
 template <unsigned Tdim>
 bool mpm::MohrCoulomb<Tdim>::compute_stress_invariants(
@@ -122,39 +160,56 @@ typename mpm::mohrcoulomb::FailureState
     mpm::MohrCoulomb<Tdim>::compute_yield_state(
         Eigen::Matrix<double, 2, 1>* yield_function,
         const mpm::dense_map& state_vars) {
+  return this->compute_yield_state(yield_function, state_vars,
+                                   this->friction_terms(state_vars));
+}
+
+//! Compute yield function and yield state with precomputed terms
+template <unsigned Tdim>
+typename mpm::mohrcoulomb::FailureState
+    mpm::MohrCoulomb<Tdim>::compute_yield_state(
+        Eigen::Matrix<double, 2, 1>* yield_function,
+        const mpm::dense_map& state_vars, const FrictionTerms& terms) {
   // Tolerance for yield function
   const double Tolerance = -1E-1;
+  // Constants
+  const double sqrt3 = std::sqrt(3.);
+  const double sqrt2_3 = std::sqrt(2. / 3.);
   // Get stress invariants
   const double epsilon = state_vars.at("epsilon");
   const double rho = state_vars.at("rho");
   const double theta = state_vars.at("theta");
   // Get MC parameters
-  const double phi = state_vars.at("phi");
   const double cohesion = state_vars.at("cohesion");
+  // Lode angle terms: sin(theta + pi/3) and cos(theta + pi/3)
+  const double sin_theta = sin(theta);
+  const double cos_theta = cos(theta);
+  const double sin_theta_pi3 = 0.5 * sin_theta + 0.5 * sqrt3 * cos_theta;
+  const double cos_theta_pi3 = 0.5 * cos_theta - 0.5 * sqrt3 * sin_theta;
   // Compute yield functions (tension & shear)
   // Tension
-  (*yield_function)(0) = std::sqrt(2. / 3.) * cos(theta) * rho +
-                         epsilon / std::sqrt(3.) - tension_cutoff_;
+  (*yield_function)(0) =
+      sqrt2_3 * cos_theta * rho + epsilon / sqrt3 - tension_cutoff_;
   // Shear
   (*yield_function)(1) =
       std::sqrt(1.5) * rho *
-          ((sin(theta + M_PI / 3.) / (std::sqrt(3.) * cos(phi))) +
-           (cos(theta + M_PI / 3.) * tan(phi) / 3.)) +
-      (epsilon / std::sqrt(3.)) * tan(phi) - cohesion;
+          ((sin_theta_pi3 / (sqrt3 * terms.cos_phi)) +
+           (cos_theta_pi3 * terms.tan_phi / 3.)) +
+      (epsilon / sqrt3) * terms.tan_phi - cohesion;
   // Initialise yield status (0: elastic, 1: tension failure, 2: shear failure)
   auto yield_type = mpm::mohrcoulomb::FailureState::Elastic;
   // Check for tension and shear
   if ((*yield_function)(0) > Tolerance && (*yield_function)(1) > Tolerance) {
     // Compute tension and shear edge parameters
-    const double n_phi = (1. + sin(phi)) / (1. - sin(phi));
     const double sigma_p =
-        tension_cutoff_ * n_phi - 2. * cohesion * std::sqrt(n_phi);
-    const double alpha_p = std::sqrt(1. + n_phi * n_phi) + n_phi;
+        tension_cutoff_ * terms.n_phi - 2. * cohesion * terms.sqrt_n_phi;
+    // cos(theta - 4 pi/3)
+    const double cos_theta_4pi3 = -0.5 * cos_theta - 0.5 * sqrt3 * sin_theta;
     // Compute the shear-tension edge
     const double h =
         (*yield_function)(0) +
-        alpha_p * (std::sqrt(2. / 3.) * cos(theta - 4. * M_PI / 3.) * rho +
-                   epsilon / std::sqrt(3.) - sigma_p);
+        terms.alpha_p *
+            (sqrt2_3 * cos_theta_4pi3 * rho + epsilon / sqrt3 - sigma_p);
     // Tension
     if (h > std::numeric_limits<double>::epsilon())
       yield_type = mpm::mohrcoulomb::FailureState::Tensile;
@@ -178,34 +233,48 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
     mpm::mohrcoulomb::FailureState yield_type, const mpm::dense_map* state_vars,
     const Vector6d& stress, Vector6d* df_dsigma, Vector6d* dp_dsigma,
     double* dp_dq, double* softening) {
+  this->compute_df_dp(yield_type, state_vars, stress,
+                      this->friction_terms(*state_vars), df_dsigma, dp_dsigma,
+                      dp_dq, softening);
+}
+
+//! Compute dF/dSigma and dP/dSigma with precomputed terms
+template <unsigned Tdim>
+void mpm::MohrCoulomb<Tdim>::compute_df_dp(
+    mpm::mohrcoulomb::FailureState yield_type, const mpm::dense_map* state_vars,
+    const Vector6d& stress, const FrictionTerms& terms, Vector6d* df_dsigma,
+    Vector6d* dp_dsigma, double* dp_dq, double* softening) {
+  // Constants
+  const double sqrt3 = std::sqrt(3.);
   // Get stress invariants
   const double rho = (*state_vars).at("rho");
   const double theta = (*state_vars).at("theta");
-  // Get MC parameters
-  const double phi = (*state_vars).at("phi");
-  const double psi = (*state_vars).at("psi");
+  // Lode angle terms: sin(theta + pi/3) and cos(theta + pi/3)
+  const double sin_theta = sin(theta);
+  const double cos_theta = cos(theta);
+  const double sin_theta_pi3 = 0.5 * sin_theta + 0.5 * sqrt3 * cos_theta;
+  const double cos_theta_pi3 = 0.5 * cos_theta - 0.5 * sqrt3 * sin_theta;
   // Get equivalent plastic deviatoric strain
   const double pdstrain = (*state_vars).at("pdstrain");
   // Compute dF / dEpsilon,  dF / dRho, dF / dTheta
   double df_depsilon, df_drho, df_dtheta;
   // Values in tension yield
   if (yield_type == mpm::mohrcoulomb::FailureState::Tensile) {
-    df_depsilon = 1. / std::sqrt(3.);
-    df_drho = std::sqrt(2. / 3.) * cos(theta);
-    df_dtheta = -std::sqrt(2. / 3.) * rho * sin(theta);
+    df_depsilon = 1. / sqrt3;
+    df_drho = std::sqrt(2. / 3.) * cos_theta;
+    df_dtheta = -std::sqrt(2. / 3.) * rho * sin_theta;
   }
   // Values in shear yield / elastic
   else {
-    df_depsilon = tan(phi) / std::sqrt(3.);
-    df_drho = std::sqrt(1.5) *
-              ((sin(theta + M_PI / 3.) / (std::sqrt(3.) * cos(phi))) +
-               (cos(theta + M_PI / 3.) * tan(phi) / 3.));
+    df_depsilon = terms.tan_phi / sqrt3;
+    df_drho = std::sqrt(1.5) * ((sin_theta_pi3 / (sqrt3 * terms.cos_phi)) +
+                                (cos_theta_pi3 * terms.tan_phi / 3.));
     df_dtheta = std::sqrt(1.5) * rho *
-                ((cos(theta + M_PI / 3.) / (std::sqrt(3.) * cos(phi))) -
-                 (sin(theta + M_PI / 3.) * tan(phi) / 3.));
+                ((cos_theta_pi3 / (sqrt3 * terms.cos_phi)) -
+                 (sin_theta_pi3 * terms.tan_phi / 3.));
   }
   // Compute dEpsilon / dSigma
-  Vector6d depsilon_dsigma = mpm::materials::dp_dsigma(stress) * std::sqrt(3.);
+  Vector6d depsilon_dsigma = mpm::materials::dp_dsigma(stress) * sqrt3;
   // Initialise dRho / dSigma
   Vector6d drho_dsigma = mpm::materials::dq_dsigma(stress) * std::sqrt(2. / 3.);
   // Compute dtheta / dsigma
@@ -221,13 +290,13 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
     // Define meridional eccentricity
     const double xit = 0.1;
     // Compute Rt
-    double sqpart = 4. * (1 - et_value * et_value) * cos(theta) * cos(theta) +
+    double sqpart = 4. * (1 - et_value * et_value) * cos_theta * cos_theta +
                     5. * et_value * et_value - 4. * et_value;
     if (sqpart < std::numeric_limits<double>::epsilon()) sqpart = 1.E-5;
-    double rt_den = 2. * (1 - et_value * et_value) * cos(theta) +
+    double rt_den = 2. * (1 - et_value * et_value) * cos_theta +
                     (2. * et_value - 1) * std::sqrt(sqpart);
     const double rt_num =
-        4. * (1 - et_value * et_value) * cos(theta) * cos(theta) +
+        4. * (1 - et_value * et_value) * cos_theta * cos_theta +
         (2. * et_value - 1) * (2. * et_value - 1);
     if (fabs(rt_den) < std::numeric_limits<double>::epsilon()) rt_den = 1.E-5;
     const double rt = rt_num / (3. * rt_den);
@@ -242,16 +311,16 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
         std::sqrt(xit * xit * tension_cutoff_ * tension_cutoff_ +
                   1.5 * rt * rt * rho * rho);
     // Compute dP/dEpsilon
-    const double dp_depsilon = 1. / std::sqrt(3.);
+    const double dp_depsilon = 1. / sqrt3;
     // Compute dRt/dThera
     const double drtden_dtheta =
-        -2. * (1 - et_value * et_value) * sin(theta) -
-        (2. * et_value - 1) * 4. * (1 - et_value * et_value) * cos(theta) *
-            sin(theta) /
-            std::sqrt(4. * (1 - et_value * et_value) * cos(theta) * cos(theta) +
+        -2. * (1 - et_value * et_value) * sin_theta -
+        (2. * et_value - 1) * 4. * (1 - et_value * et_value) * cos_theta *
+            sin_theta /
+            std::sqrt(4. * (1 - et_value * et_value) * cos_theta * cos_theta +
                       5. * et_value * et_value - 4. * et_value);
     const double drtnum_dtheta =
-        -8. * (1 - et_value * et_value) * cos(theta) * sin(theta);
+        -8. * (1 - et_value * et_value) * cos_theta * sin_theta;
     const double drt_dtheta =
         (drtnum_dtheta * rt_den - drtden_dtheta * rt_num) /
         (3. * rt_den * rt_den);
@@ -264,33 +333,33 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
   // Compute dp/dsigma and dp/dj in shear yield
   else {
     // Compute Rmc
-    const double r_mc = (3. - sin(phi)) / (6 * cos(phi));
+    const double r_mc = (3. - terms.sin_phi) / (6 * terms.cos_phi);
     // Compute deviatoric eccentricity
-    double e_val = (3. - sin(phi)) / (3. + sin(phi));
+    double e_val = (3. - terms.sin_phi) / (3. + terms.sin_phi);
     if (e_val <= 0.5) e_val = 0.5 + 1.E-10;
     if (e_val > 1.) e_val = 1.;
     // Compute Rmw
-    double sqpart = (4. * (1 - e_val * e_val) * std::pow(cos(theta), 2)) +
+    double sqpart = (4. * (1 - e_val * e_val) * cos_theta * cos_theta) +
                     (5 * e_val * e_val) - (4. * e_val);
     if (sqpart < std::numeric_limits<double>::epsilon()) sqpart = 1.E-5;
-    double m = (2. * (1 - e_val * e_val) * cos(theta)) +
+    double m = (2. * (1 - e_val * e_val) * cos_theta) +
                ((2. * e_val - 1) * std::sqrt(sqpart));
     if (fabs(m) < std::numeric_limits<double>::epsilon()) m = 1.E-5;
-    const double l = (4. * (1. - e_val * e_val) * std::pow(cos(theta), 2)) +
+    const double l = (4. * (1. - e_val * e_val) * cos_theta * cos_theta) +
                      std::pow((2. * e_val - 1.), 2);
     const double r_mw = (l / m) * r_mc;
     // Initialise meridional eccentricity
     const double xi = 0.1;
-    double omega = std::pow((xi * cohesion_peak_ * tan(psi)), 2) +
+    double omega = std::pow((xi * cohesion_peak_ * terms.tan_psi), 2) +
                    std::pow((r_mw * std::sqrt(1.5) * rho), 2);
     if (omega < std::numeric_limits<double>::epsilon()) omega = 1.E-5;
     const double dl_dtheta =
-        -8. * (1. - e_val * e_val) * cos(theta) * sin(theta);
+        -8. * (1. - e_val * e_val) * cos_theta * sin_theta;
     const double dm_dtheta =
-        (-2. * (1. - e_val * e_val) * sin(theta)) +
+        (-2. * (1. - e_val * e_val) * sin_theta) +
         (0.5 * (2. * e_val - 1.) * dl_dtheta) / std::sqrt(sqpart);
     const double drmw_dtheta = ((m * dl_dtheta) - (l * dm_dtheta)) / (m * m);
-    const double dp_depsilon = tan(psi) / std::sqrt(3.);
+    const double dp_depsilon = terms.tan_psi / sqrt3;
     const double dp_drho = 3. * rho * r_mw * r_mw / (2. * std::sqrt(omega));
     const double dp_dtheta =
         (3. * rho * rho * r_mw * r_mc * drmw_dtheta) / (2. * std::sqrt(omega));
@@ -312,12 +381,12 @@ void mpm::MohrCoulomb<Tdim>::compute_df_dp(
     dc_dpstrain = (cohesion_residual_ - cohesion_peak_) /
                   (pdstrain_residual_ - pdstrain_peak_);
     // Compute dF/dPstrain
+    const double cos2_phi = terms.cos_phi * terms.cos_phi;
     double df_dphi =
         std::sqrt(1.5) * rho *
-            ((sin(phi) * sin(theta + M_PI / 3.) /
-              (std::sqrt(3.) * cos(phi) * cos(phi))) +
-             (cos(theta + M_PI / 3.) / (3. * cos(phi) * cos(phi)))) +
-        (mpm::materials::p(stress) / (cos(phi) * cos(phi)));
+            ((terms.sin_phi * sin_theta_pi3 / (sqrt3 * cos2_phi)) +
+             (cos_theta_pi3 / (3. * cos2_phi))) +
+        (mpm::materials::p(stress) / cos2_phi);
     double df_dc = -1.;
     (*softening) =
         (-1.) * ((df_dphi * dphi_dpstrain) + (df_dc * dc_dpstrain)) * (*dp_dq);
@@ -352,6 +421,8 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
       (*state_vars).at("cohesion") = cohesion_residual_;
     }
   }
+  // Friction and dilation dependent terms of the current state
+  const FrictionTerms terms = this->friction_terms(*state_vars);
   //-------------------------------------------------------------------------
   // Elastic-predictor stage: compute the trial stress
   Vector6d trial_stress = stress + (this->de_ * dstrain);
@@ -360,7 +431,7 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
   // Compute yield function based on the trial stress
   Eigen::Matrix<double, 2, 1> yield_function_trial;
   auto yield_type_trial =
-      this->compute_yield_state(&yield_function_trial, (*state_vars));
+      this->compute_yield_state(&yield_function_trial, (*state_vars), terms);
   // Return the updated stress in elastic state
   if (yield_type_trial == mpm::mohrcoulomb::FailureState::Elastic)
     return trial_stress;
@@ -373,7 +444,7 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
   double dp_dq_trial = 0.;
   Vector6d df_dsigma_trial = Vector6d::Zero();
   Vector6d dp_dsigma_trial = Vector6d::Zero();
-  this->compute_df_dp(yield_type_trial, state_vars, trial_stress,
+  this->compute_df_dp(yield_type_trial, state_vars, trial_stress, terms,
                       &df_dsigma_trial, &dp_dsigma_trial, &dp_dq_trial,
                       &softening_trial);
   double yield_trial = 0.;
@@ -389,7 +460,8 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
   this->compute_stress_invariants(stress, state_vars);
   // Compute yield function based on stress input
   Eigen::Matrix<double, 2, 1> yield_function;
-  auto yield_type = this->compute_yield_state(&yield_function, (*state_vars));
+  auto yield_type =
+      this->compute_yield_state(&yield_function, (*state_vars), terms);
   // Initialise value of yield function based on stress
   double yield{std::numeric_limits<double>::max()};
   if (yield_type == mpm::mohrcoulomb::FailureState::Tensile)
@@ -401,8 +473,8 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
   double dp_dq = 0.;
   Vector6d df_dsigma = Vector6d::Zero();
   Vector6d dp_dsigma = Vector6d::Zero();
-  this->compute_df_dp(yield_type, state_vars, stress, &df_dsigma, &dp_dsigma,
-                      &dp_dq, &softening);
+  this->compute_df_dp(yield_type, state_vars, stress, terms, &df_dsigma,
+                      &dp_dsigma, &dp_dq, &softening);
   const double lambda =
       ((df_dsigma.transpose() * this->de_).dot(dstrain)) /
       (((df_dsigma.transpose() * this->de_).dot(dp_dsigma)) + softening);
@@ -431,15 +503,15 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
     // Compute stress invariants based on updated stress
     this->compute_stress_invariants(updated_stress, state_vars);
     // Compute yield function based on updated stress
-    yield_type_trial =
-        this->compute_yield_state(&yield_function_trial, (*state_vars));
+    yield_type_trial = this->compute_yield_state(&yield_function_trial,
+                                                 (*state_vars), terms);
     // Check yield function
     if (yield_function_trial(0) < Tolerance &&
         yield_function_trial(1) < Tolerance) {
       break;
     }
     // Compute plastic multiplier based on updated stress
-    this->compute_df_dp(yield_type_trial, state_vars, updated_stress,
+    this->compute_df_dp(yield_type_trial, state_vars, updated_stress, terms,
                         &df_dsigma_trial, &dp_dsigma_trial, &dp_dq_trial,
                         &softening_trial);
     if (yield_type_trial == mpm::mohrcoulomb::FailureState::Tensile)
@@ -20,6 +20,8 @@ class Newtonian : public Material<Tdim> {
   using Vector6d = Eigen::Matrix<double, 6, 1>;
   //! Define a Matrix of 6 x 6
   using Matrix6x6 = Eigen::Matrix<double, 6, 6>;
+  //! Stress update of a particle
+  using StressPoint = typename Material<Tdim>::StressPoint;
 
   //! Constructor with id and material properties
   //! \param[in] id Material ID
@@ -52,6 +54,21 @@ class Newtonian : public Material<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stresses of a batch of particles from their kinematics
+  //! \param[in] points Stress updates of particles
+  //! \param[in] npoints Number of particles
+  void compute_stresses(StressPoint* points, std::size_t npoints) override;
+
+  //! Compute stress from the kinematics of the fluid
+  //! \details Particle-independent kernel used by compute_stress
+  //! \param[in] strain_rate Strain rate
+  //! \param[in] dvolumetric_strain Volumetric strain increment
+  //! \param[in|out] pressure Thermodynamic pressure
+  //! \retval updated_stress Updated value of stress
+  Vector6d compute_fluid_stress(const Vector6d& strain_rate,
+                                double dvolumetric_strain,
+                                double* pressure) const;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
@@ -59,6 +76,8 @@ class Newtonian : public Material<Tdim> {
   using Material<Tdim>::properties_;
   //! Logger
   using Material<Tdim>::console_;
+  //! State variable of particles
+  using StateVariable = typename Material<Tdim>::StateVariable;
 
  private:
   //! Thermodynamic pressure
@@ -74,6 +93,8 @@ class Newtonian : public Material<Tdim> {
   double dynamic_viscosity_{std::numeric_limits<double>::max()};
   //! Compressibility multiplier
   double compressibility_multiplier_{1.0};
+  //! Thermodynamic pressure of particles
+  StateVariable pressure_{"pressure"};
 
 };  // Newtonian class
 }  // namespace mpm
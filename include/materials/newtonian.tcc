@@ -45,69 +45,54 @@ double mpm::Newtonian<Tdim>::thermodynamic_pressure(
   return (-bulk_modulus_ * volumetric_strain);
 }
 
-//! Compute stress in 2D
-template <>
-Eigen::Matrix<double, 6, 1> mpm::Newtonian<2>::compute_stress(
-    const Vector6d& stress, const Vector6d& dstrain, const ParticleBase<2>* ptr,
-    mpm::dense_map* state_vars) {
-
-  // Get strain rate
-  const auto& strain_rate = ptr->strain_rate();
-  const double volumetric_strain_rate = strain_rate(0) + strain_rate(1);
-
-  // Update pressure
-  (*state_vars).at("pressure") +=
-      (compressibility_multiplier_ *
-       this->thermodynamic_pressure(ptr->dvolumetric_strain()));
-
-  // Volumetric stress component
-  const double volumetric_component =
-      compressibility_multiplier_ *
-      (-(*state_vars).at("pressure") -
-       (2. * dynamic_viscosity_ * volumetric_strain_rate / 3.));
-
-  // Update stress component
-  Eigen::Matrix<double, 6, 1> pstress;
-  pstress(0) = volumetric_component + 2. * dynamic_viscosity_ * strain_rate(0);
-  pstress(1) = volumetric_component + 2. * dynamic_viscosity_ * strain_rate(1);
-  pstress(2) = volumetric_component;
-  pstress(3) = dynamic_viscosity_ * strain_rate(3);
-  pstress(4) = 0.;
-  pstress(5) = 0.;
+//! Compute stress
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::Newtonian<Tdim>::compute_stress(
+    const Vector6d& stress, const Vector6d& dstrain,
+    const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
+  return this->compute_fluid_stress(ptr->strain_rate(),
+                                    ptr->dvolumetric_strain(),
+                                    &(*state_vars).at("pressure"));
+}
 
-  return pstress;
+//! Compute stresses of a batch of particles from their kinematics
+template <unsigned Tdim>
+void mpm::Newtonian<Tdim>::compute_stresses(StressPoint* points,
+                                            std::size_t npoints) {
+  for (std::size_t i = 0; i < npoints; ++i) {
+    StressPoint& point = points[i];
+    *point.stress = this->compute_fluid_stress(
+        *point.strain_rate, point.dvolumetric_strain,
+        &pressure_(point.state_vars));
+  }
 }
 
-//! Compute stress in 3D
-template <>
-Eigen::Matrix<double, 6, 1> mpm::Newtonian<3>::compute_stress(
-    const Vector6d& stress, const Vector6d& dstrain, const ParticleBase<3>* ptr,
-    mpm::dense_map* state_vars) {
+//! Compute stress from the kinematics of the fluid
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::Newtonian<Tdim>::compute_fluid_stress(
+    const Vector6d& strain_rate, double dvolumetric_strain,
+    double* pressure) const {
+  // Number of shear components: 1 in 2D and 3 in 3D
+  constexpr unsigned Nshear = Tdim * (Tdim - 1) / 2;
 
-  // Get strain rate
-  const auto& strain_rate = ptr->strain_rate();
-  const double volumetric_strain_rate =
-      strain_rate(0) + strain_rate(1) + strain_rate(2);
+  const double volumetric_strain_rate = strain_rate.template head<Tdim>().sum();
 
   // Update pressure
-  (*state_vars).at("pressure") +=
-      (compressibility_multiplier_ *
-       this->thermodynamic_pressure(ptr->dvolumetric_strain()));
+  (*pressure) += compressibility_multiplier_ *
+                 this->thermodynamic_pressure(dvolumetric_strain);
 
   // Volumetric stress component
   const double volumetric_component =
       compressibility_multiplier_ *
-      (-(*state_vars).at("pressure") -
-       (2. * dynamic_viscosity_ * volumetric_strain_rate / 3.));
+      (-(*pressure) - (2. * dynamic_viscosity_ * volumetric_strain_rate / 3.));
 
   // Update stress component
-  Eigen::Matrix<double, 6, 1> pstress;
-  pstress(0) = volumetric_component + 2. * dynamic_viscosity_ * strain_rate(0);
-  pstress(1) = volumetric_component + 2. * dynamic_viscosity_ * strain_rate(1);
-  pstress(2) = volumetric_component + 2. * dynamic_viscosity_ * strain_rate(2);
-  pstress(3) = dynamic_viscosity_ * strain_rate(3);
-  pstress(4) = dynamic_viscosity_ * strain_rate(4);
-  pstress(5) = dynamic_viscosity_ * strain_rate(5);
+  Vector6d pstress = Vector6d::Zero();
+  pstress.template head<3>().setConstant(volumetric_component);
+  pstress.template head<Tdim>() +=
+      (2. * dynamic_viscosity_) * strain_rate.template head<Tdim>();
+  pstress.template segment<Nshear>(3) =
+      dynamic_viscosity_ * strain_rate.template segment<Nshear>(3);
 
   return pstress;
 }
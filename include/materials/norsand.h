@@ -1,7 +1,9 @@
 #ifndef MPM_MATERIAL_NORSAND_H_
 #define MPM_MATERIAL_NORSAND_H_
 
+#include <array>
 #include <cmath>
+#include <string>
 
 #include "Eigen/Dense"
 
@@ -65,51 +67,85 @@ class NorSand : public Material<Tdim> {
   using Material<Tdim>::console_;
 
  private:
+  //! Stress invariants of a stress state (compression positive)
+  struct Invariants {
+    //! Deviatoric stress in tension positive convention
+    Vector6d deviatoric_stress;
+    //! J2 invariant
+    double j2{0.};
+    //! J3 invariant
+    double j3{0.};
+    //! Mean stress p
+    double p{0.};
+    //! Deviatoric stress q
+    double q{0.};
+    //! Lode angle
+    double lode_angle{0.};
+    //! Critical state M at the Lode angle
+    double M_theta{0.};
+  };
+
+  //! History-dependent state variables, looked up once per stress update
+  struct StateVariables {
+    //! Critical state M at the current stress
+    double& M_theta;
+    //! Current void ratio
+    double& void_ratio;
+    //! Void ratio image
+    double& e_image;
+    //! Image pressure
+    double& p_image;
+    //! Cohesion pressure
+    double& p_cohesion;
+    //! Dilation pressure
+    double& p_dilation;
+    //! Equivalent plastic deviatoric strain
+    double& pdstrain;
+  };
+
   //! Compute elastic tensor
   bool compute_elastic_tensor();
 
   //! Compute plastic tensor
-  void compute_plastic_tensor(const Vector6d& stress,
-                              mpm::dense_map* state_vars);
+  //! \param[in] invariants Invariants of the current stress
+  //! \param[in] state History-dependent state variables
+  void compute_plastic_tensor(const Invariants& invariants,
+                              const StateVariables& state);
 
   //! Compute stress invariants (p, q, lode_angle and M_theta)
-  //! \param[in] stress Stress
-  //! \param[in|out] p Mean stress
-  //! \param[in|out] q Deviatoric stress
-  //! \param[in|out] lode_angle Lode angle
-  //! \param[in|out] M_theta Critical state M lode angle
-  void compute_stress_invariants(const Vector6d& stress, double* p, double* q,
-                                 double* lode_angle, double* M_theta);
+  //! \param[in] stress Stress (compression positive)
+  //! \retval invariants Stress invariants
+  Invariants compute_stress_invariants(const Vector6d& stress) const;
 
   //! Compute state variables (void ratio, p_image, e_image, etc)
-  //! \param[in] stress Stress
-  //! \param[in] state_vars History-dependent state variables
+  //! \param[in] invariants Invariants of the updated stress
+  //! \param[in] dstrain Strain increment (compression positive)
+  //! \param[in|out] state History-dependent state variables
   //! \param[in] yield_type Yild type (elastic or yield)
-  //! \retval status of computation of stress invariants
-  void compute_state_variables(const Vector6d& stress, const Vector6d& dstrain,
-                               mpm::dense_map* state_vars,
+  void compute_state_variables(const Invariants& invariants,
+                               const Vector6d& dstrain, StateVariables* state,
                                mpm::norsand::FailureState yield_type);
 
   //! Compute yield function and yield state
-  //! \param[in] state_vars History-dependent state variables
-  //! \param[in] stress Stress
+  //! \param[in|out] yield_function Yield function
+  //! \param[in] invariants Stress invariants
+  //! \param[in] state History-dependent state variables
   //! \retval yield_type Yield type (elastic or yield)
-  mpm::norsand::FailureState compute_yield_state(double* yield_function,
-                                                 const Vector6d& stress,
-                                                 mpm::dense_map* state_vars);
+  mpm::norsand::FailureState compute_yield_state(
+      double* yield_function, const Invariants& invariants,
+      const StateVariables& state) const;
 
   //! Compute p_cohesion and p_dilation
-  //! \param[in] state_vars History-dependent state variables
-  //! \retval status of computation of stress invariants
-  void compute_p_bond(mpm::dense_map* state_vars);
+  //! \param[in|out] state History-dependent state variables
+  void compute_p_bond(StateVariables* state);
 
   //! Inline ternary function to check negative or zero numbers
-  inline double check_low(double val) {
+  inline double check_low(double val) const {
     return (val > 1.0e-15 ? val : 1.0e-15);
   }
 
   //! Inline ternary function to check number not greater than one
-  inline double check_one(double val) { return (val < 1.0 ? val : 1.0); }
+  inline double check_one(double val) const { return (val < 1.0 ? val : 1.0); }
 
   //! Elastic stiffness matrix
   Matrix6x6 de_;
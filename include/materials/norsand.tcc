@@ -134,126 +134,112 @@ bool mpm::NorSand<Tdim>::compute_elastic_tensor() {
 
 //! Compute stress invariants
 template <unsigned Tdim>
-void mpm::NorSand<Tdim>::compute_stress_invariants(const Vector6d& stress,
-                                                   double* p, double* q,
-                                                   double* lode_angle,
-                                                   double* M_theta) {
-  // Note that in this subroutine, stress is compression positive
+typename mpm::NorSand<Tdim>::Invariants
+    mpm::NorSand<Tdim>::compute_stress_invariants(
+        const Vector6d& stress) const {
+  // Note that in this subroutine, stress is compression positive, whereas the
+  // deviatoric stress, J2 and J3 are computed in tension positive
+  Invariants invariants;
+  invariants.deviatoric_stress = mpm::materials::deviatoric_stress(-stress);
+  invariants.j2 = mpm::materials::j2(-stress);
+  invariants.j3 = mpm::materials::j3(-stress);
 
   // Compute mean stress p
-  *p = check_low(-1. * mpm::materials::p(-stress));
+  invariants.p = check_low(-1. * mpm::materials::p(-stress));
 
   // Compute q
-  *q = check_low(mpm::materials::q(-stress));
+  invariants.q = check_low(std::sqrt(3. * invariants.j2));
 
   // Compute Lode angle (cos convetion)
-  *lode_angle = mpm::materials::lode_angle(-stress, tolerance_);
+  invariants.lode_angle =
+      mpm::materials::lode_angle(invariants.j2, invariants.j3, tolerance_);
 
   // Compute M_theta (Jefferies and Shuttle, 2011)
-  *M_theta =
-      Mtc_ - std::pow(Mtc_, 2) / (3. + Mtc_) * cos(3. / 2. * *lode_angle);
+  invariants.M_theta = Mtc_ - Mtc_ * Mtc_ / (3. + Mtc_) *
+                                  cos(3. / 2. * invariants.lode_angle);
+  return invariants;
 }
 
 //! Compute state parameters
 template <unsigned Tdim>
 void mpm::NorSand<Tdim>::compute_state_variables(
-    const Vector6d& stress, const Vector6d& dstrain, mpm::dense_map* state_vars,
-    mpm::norsand::FailureState yield_type) {
-
-  // Initialize invariants
-  double mean_p = 0.;
-  double deviatoric_q = 0.;
-  double lode_angle = 0.;
-  double mtheta = 0.;
+    const Invariants& invariants, const Vector6d& dstrain,
+    StateVariables* state, mpm::norsand::FailureState yield_type) {
 
   // Get invariants
-  this->compute_stress_invariants(stress, &mean_p, &deviatoric_q, &lode_angle,
-                                  &mtheta);
+  const double mean_p = invariants.p;
+  const double deviatoric_q = invariants.q;
 
   // Get state variables (note that M_theta used is at current stress)
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
-  double p_image;
-  double e_image;
+  const double M_theta = state->M_theta;
+  const double p_cohesion = state->p_cohesion;
+  const double p_dilation = state->p_dilation;
 
-  if (yield_type == mpm::norsand::FailureState::Elastic) {
-    // Keep the same pressure image and void ratio image at critical state
-    p_image = (*state_vars).at("p_image");
-    e_image = (*state_vars).at("e_image");
-  } else {
+  // Keep the same pressure image and void ratio image at critical state in
+  // the elastic state
+  if (yield_type == mpm::norsand::FailureState::Yield) {
     // Compute and update pressure image
-    p_image =
+    const double p_image =
         (mean_p + p_cohesion) *
             std::pow(
                 ((1 - N_ / M_theta * deviatoric_q / (mean_p + p_cohesion)) /
                  (1 - N_)),
                 ((N_ - 1) / N_)) -
         p_cohesion - p_dilation;
-    (*state_vars).at("p_image") = p_image;
+    state->p_image = p_image;
 
     // Compute and update void ratio image
     // e_image = e_max_ - (e_max_ - e_min_) / log(crushing_pressure_ / p_image);
-    e_image = check_low(gamma_ - lambda_ * log(p_image / reference_pressure_));
-
-    (*state_vars).at("e_image") = e_image;
+    state->e_image =
+        check_low(gamma_ - lambda_ * log(p_image / reference_pressure_));
   }
 
   // Update M_theta at the updated stress state
-  (*state_vars).at("M_theta") = mtheta;
+  state->M_theta = invariants.M_theta;
 
   // Update void ratio
   // Note that dstrain is in tension positive - depsv = de / (1 + e_initial)
   double dvolumetric_strain = dstrain(0) + dstrain(1) + dstrain(2);
-  (*state_vars).at("void_ratio") =
-      check_low((*state_vars).at("void_ratio") -
-                (1 + void_ratio_initial_) * dvolumetric_strain);
+  state->void_ratio = check_low(state->void_ratio -
+                                (1 + void_ratio_initial_) * dvolumetric_strain);
 }
 
 //! Compute elastic tensor
 template <unsigned Tdim>
-void mpm::NorSand<Tdim>::compute_p_bond(mpm::dense_map* state_vars) {
+void mpm::NorSand<Tdim>::compute_p_bond(StateVariables* state) {
 
   // Compute current zeta cohesion
-  double zeta_cohesion = exp(-m_cohesion_ * (*state_vars).at("pdstrain"));
+  double zeta_cohesion = exp(-m_cohesion_ * state->pdstrain);
   zeta_cohesion = check_one(zeta_cohesion);
   zeta_cohesion = check_low(zeta_cohesion);
 
   // Update p_cohesion
-  double p_cohesion = p_cohesion_initial_ * zeta_cohesion;
-  (*state_vars).at("p_cohesion") = p_cohesion;
+  state->p_cohesion = p_cohesion_initial_ * zeta_cohesion;
 
   // Compute current zeta dilation
-  double zeta_dilation = exp(-m_dilation_ * (*state_vars).at("pdstrain"));
+  double zeta_dilation = exp(-m_dilation_ * state->pdstrain);
   zeta_dilation = check_one(zeta_dilation);
   zeta_dilation = check_low(zeta_dilation);
 
   // Update p_dilation
-  double p_dilation = p_dilation_initial_ * zeta_dilation;
-  (*state_vars).at("p_dilation") = p_dilation;
+  state->p_dilation = p_dilation_initial_ * zeta_dilation;
 }
 
 //! Compute yield function and yield state
 template <unsigned Tdim>
 typename mpm::norsand::FailureState mpm::NorSand<Tdim>::compute_yield_state(
-    double* yield_function, const Vector6d& stress,
-    mpm::dense_map* state_vars) {
-
-  // Initialize invariants
-  double mean_p = 0.;
-  double deviatoric_q = 0.;
-  double lode_angle = 0.;
-  double mtheta = 0.;
+    double* yield_function, const Invariants& invariants,
+    const StateVariables& state) const {
 
   // Get invariants
-  this->compute_stress_invariants(stress, &mean_p, &deviatoric_q, &lode_angle,
-                                  &mtheta);
+  const double mean_p = invariants.p;
+  const double deviatoric_q = invariants.q;
 
   // Get state variables
-  const double p_image = (*state_vars).at("p_image");
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
+  const double p_image = state.p_image;
+  const double M_theta = state.M_theta;
+  const double p_cohesion = state.p_cohesion;
+  const double p_dilation = state.p_dilation;
 
   // Initialise yield status (Elastic, Yield)
   auto yield_type = mpm::norsand::FailureState::Elastic;
@@ -275,28 +261,21 @@ typename mpm::norsand::FailureState mpm::NorSand<Tdim>::compute_yield_state(
 
 //! Compute plastic tensor
 template <unsigned Tdim>
-void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
-                                                mpm::dense_map* state_vars) {
+void mpm::NorSand<Tdim>::compute_plastic_tensor(const Invariants& invariants,
+                                                const StateVariables& state) {
 
   // Note that in this subroutine, stress is compression positive
 
-  // Initialize invariants
-  double mean_p = 0.;
-  double deviatoric_q = 0.;
-  double lode_angle = 0.;
-  double mtheta = 0.;
-
   // Get invariants
-  this->compute_stress_invariants(stress, &mean_p, &deviatoric_q, &lode_angle,
-                                  &mtheta);
+  const double mean_p = invariants.p;
 
   // Get state variables
-  const double M_theta = (*state_vars).at("M_theta");
-  const double p_image = (*state_vars).at("p_image");
-  const double e_image = (*state_vars).at("e_image");
-  const double void_ratio = (*state_vars).at("void_ratio");
-  const double p_cohesion = (*state_vars).at("p_cohesion");
-  const double p_dilation = (*state_vars).at("p_dilation");
+  const double M_theta = state.M_theta;
+  const double p_image = state.p_image;
+  const double e_image = state.e_image;
+  const double void_ratio = state.void_ratio;
+  const double p_cohesion = state.p_cohesion;
+  const double p_dilation = state.p_dilation;
 
   // Estimate dilatancy at peak
   const double D_min = chi_ * (void_ratio - e_image);
@@ -306,6 +285,11 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
       (mean_p + p_cohesion) *
       std::pow((1 + D_min * N_ / M_theta), ((N_ - 1) / N_));
 
+  // Ratios of pressures shared by the derivatives
+  const double p_ratio =
+      (mean_p + p_cohesion) / (p_image + p_cohesion + p_dilation);
+  const double p_ratio_pow = std::pow(p_ratio, (N_ / (1 - N_)));
+
   // Compute derivatives
   // Compute dF / dp
   const double dF_dp =
@@ -314,51 +298,47 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
                     (N_ / (1 - N_))));
 
   // Compute dp / dsigma
-  const Vector6d dp_dsigma = mpm::materials::dp_dsigma(-stress);
+  const Vector6d dp_dsigma =
+      mpm::materials::dp_dsigma(invariants.deviatoric_stress);
 
   // Compute dF / dq
   const double dF_dq = 1.;
 
   // Compute dq / dsigma
-  const Vector6d dq_dsigma = mpm::materials::dq_dsigma(-stress);
+  const Vector6d dq_dsigma = mpm::materials::dq_dsigma(
+      invariants.deviatoric_stress, std::sqrt(3. * invariants.j2));
 
   // Compute dF / dM
   const double dF_dM =
-      -1.0 / N_ * (mean_p + p_cohesion) *
-      (1 + (N_ - 1) * std::pow(((mean_p + p_cohesion) /
-                                (p_image + p_cohesion + p_dilation)),
-                               (N_ / (1 - N_))));
+      -1.0 / N_ * (mean_p + p_cohesion) * (1 + (N_ - 1) * p_ratio_pow);
 
   // Use current lode angle to compute dtheta
-  const double sin_lode_angle = sin(3. / 2. * lode_angle);
+  const double sin_lode_angle = sin(3. / 2. * invariants.lode_angle);
 
   // Compute dM / dtehta
-  const double dM_dtheta =
-      3. / 2. * std::pow(Mtc_, 2) / (3. + Mtc_) * sin_lode_angle;
+  const double dM_dtheta = 3. / 2. * Mtc_ * Mtc_ / (3. + Mtc_) * sin_lode_angle;
 
   // Compute dtheta / dsigma
-  const Vector6d dtheta_dsigma = mpm::materials::dtheta_dsigma(-stress);
+  const Vector6d dtheta_dsigma = mpm::materials::dtheta_dsigma(
+      invariants.deviatoric_stress, invariants.j2, invariants.j3,
+      std::numeric_limits<double>::epsilon());
 
   // dF_dsigma is in compression negative
   const Vector6d dF_dsigma = (dF_dp * dp_dsigma) + (-1. * dF_dq * dq_dsigma) +
                              (-1. * dF_dM * dM_dtheta * dtheta_dsigma);
 
   // Derivatives in respect to p_image
-  const double dF_dpi =
-      -1. * M_theta *
-      std::pow(((mean_p + p_cohesion) / (p_image + p_cohesion + p_dilation)),
-               (1 / (1 - N_)));
+  const double dF_dpi = -1. * M_theta * std::pow(p_ratio, (1 / (1 - N_)));
 
   const double dpi_depsd = hardening_modulus_ * (p_image_max - p_image);
 
   const double dF_dsigma_v = (dF_dsigma(0) + dF_dsigma(1) + dF_dsigma(2)) / 3;
   const double dF_dsigma_deviatoric =
-      std::sqrt(2. / 3.) * std::sqrt(std::pow(dF_dsigma(0) - dF_dsigma_v, 2) +
-                                     std::pow(dF_dsigma(1) - dF_dsigma_v, 2) +
-                                     std::pow(dF_dsigma(2) - dF_dsigma_v, 2) +
-                                     std::pow(dF_dsigma(3), 2) / 2. +
-                                     std::pow(dF_dsigma(4), 2) / 2. +
-                                     std::pow(dF_dsigma(5), 2) / 2.);
+      std::sqrt(2. / 3.) *
+      std::sqrt((dF_dsigma.template head<3>().array() - dF_dsigma_v)
+                    .matrix()
+                    .squaredNorm() +
+                dF_dsigma.template tail<3>().squaredNorm() / 2.);
 
   // Compute hardering term
   double hardening_term;
@@ -366,29 +346,18 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
     // Derivatives in respect to p_cohesion
     const double dF_dpcohesion =
         M_theta / N_ *
-        (1 +
-         (N_ - 1) * std::pow(((mean_p + p_cohesion) /
-                              (p_image + p_cohesion + p_dilation)),
-                             (N_ / (1 - N_))) -
+        (1 + (N_ - 1) * p_ratio_pow -
          N_ * (p_image + p_dilation - mean_p) /
-             (p_image + p_cohesion + p_dilation) *
-             std::pow(
-                 ((mean_p + p_cohesion) / (p_image + p_cohesion + p_dilation)),
-                 (N_ / (1 - N_))));
+             (p_image + p_cohesion + p_dilation) * p_ratio_pow);
 
     const double dpcohesion_depsd =
-        -p_cohesion_initial_ * m_cohesion_ *
-        exp(-m_cohesion_ * (*state_vars).at("pdstrain"));
+        -p_cohesion_initial_ * m_cohesion_ * exp(-m_cohesion_ * state.pdstrain);
 
     // Derivatives in respect to p_dilation
-    const double dF_dpdilation =
-        -1. * M_theta *
-        std::pow(((mean_p + p_cohesion) / (p_image + p_cohesion + p_dilation)),
-                 (1 / (1 - N_)));
+    const double dF_dpdilation = dF_dpi;
 
     const double dpdilation_depsd =
-        -p_dilation_initial_ * m_dilation_ *
-        exp(-m_dilation_ * (*state_vars).at("pdstrain"));
+        -p_dilation_initial_ * m_dilation_ * exp(-m_dilation_ * state.pdstrain);
 
     hardening_term = dF_dpi * dpi_depsd * dF_dsigma_deviatoric +
                      dF_dpcohesion * dpcohesion_depsd * dF_dsigma_deviatoric +
@@ -398,8 +367,9 @@ void mpm::NorSand<Tdim>::compute_plastic_tensor(const Vector6d& stress,
   }
 
   // Construct Dp matrix
-  this->dp_ = (de_ * dF_dsigma * dF_dsigma.transpose() * de_) /
-              (dF_dsigma.transpose() * de_ * dF_dsigma - hardening_term);
+  const Vector6d de_dF_dsigma = de_ * dF_dsigma;
+  this->dp_ = (de_dF_dsigma * de_dF_dsigma.transpose()) /
+              (dF_dsigma.dot(de_dF_dsigma) - hardening_term);
 }
 
 //! Compute stress
@@ -408,6 +378,13 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
 
+  // State variables
+  StateVariables state{
+      (*state_vars).at("M_theta"),    (*state_vars).at("void_ratio"),
+      (*state_vars).at("e_image"),    (*state_vars).at("p_image"),
+      (*state_vars).at("p_cohesion"), (*state_vars).at("p_dilation"),
+      (*state_vars).at("pdstrain")};
+
   // Note: compression positive in all derivations
   Vector6d stress_neg = -1 * stress;
   Vector6d dstrain_neg = -1 * dstrain;
@@ -417,9 +394,8 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
 
   // Elastic step
   // Bulk modulus computation
-  bulk_modulus_ = (1. + (*state_vars).at("void_ratio")) / kappa_ * mean_p +
-                  m_modulus_ * ((*state_vars).at("p_cohesion") +
-                                (*state_vars).at("p_dilation"));
+  bulk_modulus_ = (1. + state.void_ratio) / kappa_ * mean_p +
+                  m_modulus_ * (state.p_cohesion + state.p_dilation);
   // Shear modulus computation
   shear_modulus_ = 3. * bulk_modulus_ * (1. - 2. * poisson_ratio_) /
                    (2.0 * (1. + poisson_ratio_));
@@ -430,27 +406,32 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
   // Trial stress - elastic
   Vector6d trial_stress = stress_neg + (this->de_ * dstrain_neg);
 
+  // Trial stress invariants, reused by the elastic update
+  const Invariants trial_invariants =
+      this->compute_stress_invariants(trial_stress);
+
   // Initialise value for yield function
   double yield_function;
   auto yield_type =
-      this->compute_yield_state(&yield_function, trial_stress, state_vars);
+      this->compute_yield_state(&yield_function, trial_invariants, state);
 
   // Return the updated stress in elastic state
   if (yield_type == mpm::norsand::FailureState::Elastic) {
 
     // Update state variables
-    this->compute_state_variables(trial_stress, dstrain_neg, state_vars,
+    this->compute_state_variables(trial_invariants, dstrain_neg, &state,
                                   yield_type);
 
     // Update p_cohesion
-    this->compute_p_bond(state_vars);
+    if (bond_model_) this->compute_p_bond(&state);
 
     // Return elastic stress
     return (-trial_stress);
   }
 
   // Set plastic tensor
-  this->compute_plastic_tensor(stress_neg, state_vars);
+  this->compute_plastic_tensor(this->compute_stress_invariants(stress_neg),
+                               state);
 
   // Plastic step
   // Compute D matrix used in stress update
@@ -460,35 +441,39 @@ Eigen::Matrix<double, 6, 1> mpm::NorSand<Tdim>::compute_stress(
   Vector6d updated_stress = stress_neg + D_matrix * dstrain_neg;
 
   // Update state variables
-  this->compute_state_variables(updated_stress, dstrain_neg, state_vars,
-                                yield_type);
+  this->compute_state_variables(this->compute_stress_invariants(updated_stress),
+                                dstrain_neg, &state, yield_type);
 
   // Compute incremental plastic strain, still in tension positive
-  Vector6d dstress = updated_stress - stress_neg;
-  Vector6d dpstrain = dstrain_neg - (this->de_.inverse() * dstress);
+  // Elastic strain from the closed-form isotropic compliance
+  const Vector6d dstress = updated_stress - stress_neg;
+  const double dstress_mean = (dstress(0) + dstress(1) + dstress(2)) / 3.;
+  Vector6d delastic_strain;
+  delastic_strain.template head<3>() =
+      (dstress.template head<3>().array() - dstress_mean) /
+          (2. * shear_modulus_) +
+      dstress_mean / (3. * bulk_modulus_);
+  delastic_strain.template tail<3>() =
+      dstress.template tail<3>() / shear_modulus_;
+  Vector6d dpstrain = dstrain_neg - delastic_strain;
   if (Tdim == 2) dpstrain(4) = dpstrain(5) = 0.;
 
   // Update plastic strain
-  (*state_vars).at("plastic_strain0") += dpstrain(0);
-  (*state_vars).at("plastic_strain1") += dpstrain(1);
-  (*state_vars).at("plastic_strain2") += dpstrain(2);
-  (*state_vars).at("plastic_strain3") += dpstrain(3);
-  (*state_vars).at("plastic_strain4") += dpstrain(4);
-  (*state_vars).at("plastic_strain5") += dpstrain(5);
-
+  static const std::array<std::string, 6> plastic_strain_keys = {
+      "plastic_strain0", "plastic_strain1", "plastic_strain2",
+      "plastic_strain3", "plastic_strain4", "plastic_strain5"};
   Vector6d plastic_strain;
-  plastic_strain(0) = (*state_vars).at("plastic_strain0");
-  plastic_strain(1) = (*state_vars).at("plastic_strain1");
-  plastic_strain(2) = (*state_vars).at("plastic_strain2");
-  plastic_strain(3) = (*state_vars).at("plastic_strain3");
-  plastic_strain(4) = (*state_vars).at("plastic_strain4");
-  plastic_strain(5) = (*state_vars).at("plastic_strain5");
+  for (unsigned i = 0; i < 6; ++i) {
+    double& plastic_strain_i = (*state_vars).at(plastic_strain_keys[i]);
+    plastic_strain_i += dpstrain(i);
+    plastic_strain(i) = plastic_strain_i;
+  }
 
   // Update equivalent plastic deviatoric strain
-  (*state_vars).at("pdstrain") = mpm::materials::pdstrain(plastic_strain);
+  state.pdstrain = mpm::materials::pdstrain(plastic_strain);
 
   // Update p_cohesion
-  this->compute_p_bond(state_vars);
+  if (bond_model_) this->compute_p_bond(&state);
 
   // Return updated stress
   return (-updated_stress);
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <vector>
@@ -31,14 +32,18 @@ using Json = nlohmann::json;
 #include "generators/injection.h"
 #include "geometry.h"
 #include "hdf5_particle.h"
+#include "hdf5_writer.h"
 #include "io.h"
 #include "io_mesh.h"
 #include "logger.h"
 #include "material.h"
+#include "mesh_partition.h"
 #include "nodal_properties.h"
 #include "node.h"
+#include "parallel_sort.h"
 #include "particle.h"
 #include "particle_base.h"
+#include "range_set.h"
 #include "traction.h"
 #include "vector.h"
 #include "velocity_constraint.h"
@@ -156,6 +161,50 @@ class Mesh {
                     const std::vector<std::vector<mpm::Index>>& cells,
                     bool check_duplicates = true);
 
+  //! Extend node ids of linear cells to the node stencil of an element
+  //! \details GIMP and B-spline elements have functions at the nodes around
+  //! a cell. The stencil is gathered from the cells sharing a corner node and
+  //! from padding nodes that are in none of the cells, and ordered by the
+  //! natural coordinates of the element nodes. Cells at the boundary of the
+  //! mesh need a layer of padding nodes around them: a cell with an
+  //! incomplete stencil is an error. Cells keep their order
+  //! \param[in] element Element with nodes beyond the unit cell
+  //! \param[in] cells Node ids of cells, ordered as the unit cell
+  //! \retval extended_cells Node ids of cells, ordered as the element nodes,
+  //! empty on error
+  std::vector<std::vector<mpm::Index>> extended_cell_connectivity(
+      const std::shared_ptr<const mpm::Element<Tdim>>& element,
+      const std::vector<std::vector<mpm::Index>>& cells);
+
+  //! Create the nodes and cells of a rank of a partitioned mesh
+  //! \details Only the cells of the rank, the layers of ghost cells sharing
+  //! a node with them and their nodes are created, with their ids in the
+  //! global mesh. For elements with nodes beyond the cell, the nodes of the
+  //! stencils of these cells are created too, with the padding nodes that
+  //! are in none of the cells. Cells are assigned the rank of their
+  //! partition. Ids of nodes, cells and particles in sets, constraints and
+  //! particle files that are not in the local mesh are then skipped
+  //! \param[in] node_type Node type
+  //! \param[in] coordinates Nodal coordinates of the global mesh
+  //! \param[in] element Element type
+  //! \param[in] cells Node ids of cells of the global mesh
+  //! \param[in] partition Rank of each cell of the global mesh
+  //! \param[in] check_duplicates Parameter to check duplicates
+  //! \retval status Create mesh status
+  bool create_partitioned_mesh(
+      const std::string& node_type, const std::vector<VectorDim>& coordinates,
+      const std::shared_ptr<mpm::Element<Tdim>>& element,
+      const std::vector<std::vector<mpm::Index>>& cells,
+      const std::vector<unsigned>& partition, bool check_duplicates = true);
+
+  //! Return if only a partition of the global mesh is in the rank
+  bool is_partitioned() const { return partitioned_; }
+
+  //! Return if a node id is on another rank of a partitioned mesh
+  bool is_nonlocal_node(mpm::Index id) const {
+    return partitioned_ && map_nodes_.find(id) == map_nodes_.end();
+  }
+
   //! Add a cell from the mesh
   //! \param[in] cell A shared pointer to cell
   //! \param[in] check_duplicates Parameter to check duplicates
@@ -251,39 +300,80 @@ class Mesh {
   template <typename Toper>
   void iterate_over_particles(Toper oper);
 
+  //! Compute stresses of particles
+  //! \details Particles are taken in blocks, in which consecutive particles
+  //! of a material have their stresses updated in one call to the material
+  void compute_particle_stresses();
+
   //! Iterate over particle set
   //! \tparam Toper Callable object typically a baseclass functor
   //! \param[in] set_id particle set id
   template <typename Toper>
   void iterate_over_particle_set(int set_id, Toper oper);
 
+  //! Return positions of a sample of particles in the particle container
+  //! \details Particles with ids divisible by stride, which keeps the same
+  //! particles across steps, and coordinates within a box are sampled
+  //! \param[in] stride Stride of particle ids
+  //! \param[in] min Lower corner of the box of sampled particles
+  //! \param[in] max Upper corner of the box of sampled particles
+  //! \retval sample Ascending positions of sampled particles
+  std::vector<std::size_t> particles_sample(mpm::Index stride,
+                                            const VectorDim& min,
+                                            const VectorDim& max) const;
+
   //! Return coordinates of particles
-  std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates();
+  //! \param[in] sample Positions of particles to return, all if nullptr
+  std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates(
+      const std::vector<std::size_t>* sample = nullptr);
 
   //! Return particles scalar data
   //! \param[in] attribute Name of the scalar data attribute
+  //! \param[in] sample Positions of particles to return, all if nullptr
   //! \retval scalar_data Vector containing scalar properties from particles
-  std::vector<double> particles_scalar_data(const std::string& attribute) const;
+  std::vector<double> particles_scalar_data(
+      const std::string& attribute,
+      const std::vector<std::size_t>* sample = nullptr) const;
 
   //! Return particles vector data
   //! \param[in] attribute Name of the tensor data attribute
+  //! \param[in] sample Positions of particles to return, all if nullptr
   //! \retval vector_data Vector containing vector properties from particles
   std::vector<Eigen::Matrix<double, 3, 1>> particles_vector_data(
-      const std::string& attribute) const;
+      const std::string& attribute,
+      const std::vector<std::size_t>* sample = nullptr) const;
 
   //! Return particles tensor data
   //! \param[in] attribute Name of the tensor data attribute
+  //! \param[in] sample Positions of particles to return, all if nullptr
   //! \retval tensor_data Vector containing tensor properties from particles
   template <unsigned Tsize>
   std::vector<Eigen::Matrix<double, Tsize, 1>> particles_tensor_data(
-      const std::string& attribute) const;
+      const std::string& attribute,
+      const std::vector<std::size_t>* sample = nullptr) const;
 
   //! Return particles state variable data
   //! \param[in] attribute Name of the state variable attribute
   //! \param[in] phase Index corresponding to the phase
+  //! \param[in] sample Positions of particles to return, all if nullptr
   //! \retval statevars_data Vector containing state variable from particles
   std::vector<double> particles_statevars_data(
-      const std::string& attribute, unsigned phase = mpm::ParticlePhase::Solid);
+      const std::string& attribute, unsigned phase = mpm::ParticlePhase::Solid,
+      const std::vector<std::size_t>* sample = nullptr);
+
+  //! Write a particle field to a buffer
+  //! \details The field is looked up once, and particles are written in
+  //! parallel in their order, ncomponents values each. Known fields are read
+  //! directly from particles, others through the properties of each particle:
+  //! scalar for one component, tensor for six or more, and vector otherwise.
+  //! Values beyond those of the field are zero
+  //! \param[in] attribute Name of the field
+  //! \param[in] ncomponents Number of values of each particle
+  //! \param[out] data Buffer of number of particles x ncomponents values
+  //! \param[in] sample Positions of particles to write, all if nullptr
+  void particles_field_data(
+      const std::string& attribute, unsigned ncomponents, double* data,
+      const std::vector<std::size_t>* sample = nullptr) const;
 
   //! Compute and assign rotation matrix to nodes
   //! \param[in] euler_angles Map of node number and respective euler_angles
@@ -349,7 +439,10 @@ class Mesh {
   //! present
   bool status() const { return particles_.size(); }
 
-  //! Generate points
+  //! Generate material points at the Gauss points of cells
+  //! \details Points are generated in parallel over cells from the shape
+  //! functions of the Gauss points of each element, tagged with their cell
+  //! and local coordinates
   //! \param[in] nquadratures Number of points per direction in cell
   //! \param[in] particle_type Particle type
   //! \param[in] material_id ID of the material
@@ -404,8 +497,37 @@ class Mesh {
   bool read_particles_hdf5(unsigned phase, const std::string& filename);
 
   //! Return HDF5 particles
+  //! \param[in] sample Positions of particles to return, all if nullptr
   //! \retval particles_hdf5 Vector of HDF5 particles
-  std::vector<mpm::HDF5Particle> particles_hdf5() const;
+  std::vector<mpm::HDF5Particle> particles_hdf5(
+      const std::vector<std::size_t>* sample = nullptr) const;
+
+  //! Return reference locations of particles in their cells
+  //! \retval xi Reference locations of particles, zero padded to 3D
+  std::vector<Eigen::Matrix<double, 3, 1>> particles_reference_locations()
+      const;
+
+  //! Return deformation gradients of particle domains
+  //! \retval deformation_gradients Deformation gradients of particles,
+  //! padded to 3D with the identity
+  std::vector<Eigen::Matrix<double, 3, 3>> particles_deformation_gradients()
+      const;
+
+  //! Write a checkpoint of particles to HDF5
+  //! \param[in] filename Name of HDF5 checkpoint file
+  //! \param[in] compression Compression level from 0 (none) to 9
+  //! \retval status Status of writing HDF5 checkpoint
+  bool write_checkpoint_hdf5(const std::string& filename,
+                             unsigned compression);
+
+  //! Read a checkpoint of particles from HDF5
+  //! \details Particles are created in parallel and attached to the cells
+  //! of the checkpoint at their reference locations, without locating them.
+  //! Particles whose cell is not in the mesh are located.
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] filename Name of HDF5 checkpoint file
+  //! \retval status Status of reading HDF5 checkpoint
+  bool read_checkpoint_hdf5(unsigned phase, const std::string& filename);
 
   //! Return nodal coordinates
   std::vector<Eigen::Matrix<double, 3, 1>> nodal_coordinates() const;
@@ -415,28 +537,51 @@ class Mesh {
 
   //! Create map of vector of particles in sets
   //! \param[in] map of particles ids in sets
-  //! \param[in] check_duplicates Parameter to check duplicates
+  //! \param[in] check_duplicates Parameter to check duplicates, ids are
+  //! unique once stored as ranges
   //! \retval status Status of  create particle sets
   bool create_particle_sets(
       const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& particle_sets,
       bool check_duplicates);
 
+  //! Create map of ranges of particles in sets
+  //! \param[in] particle_sets Ranges of particles ids by set id
+  //! \retval status Status of  create particle sets
+  bool create_particle_sets(
+      const tsl::robin_map<mpm::Index, mpm::RangeSet>& particle_sets);
+
   //! Create map of vector of nodes in sets
   //! \param[in] map of nodes ids in sets
-  //! \param[in] check_duplicates Parameter to check duplicates
+  //! \param[in] check_duplicates Parameter to check duplicates, ids are
+  //! unique once stored as ranges
   //! \retval status Status of  create node sets
   bool create_node_sets(
       const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& node_sets,
       bool check_duplicates);
 
+  //! Create map of vector of nodes in sets from ranges of ids
+  //! \param[in] node_sets Ranges of nodes ids by set id
+  //! \retval status Status of  create node sets
+  bool create_node_sets(
+      const tsl::robin_map<mpm::Index, mpm::RangeSet>& node_sets);
+
   //! Create map of vector of cells in sets
   //! \param[in] map of cells ids in sets
-  //! \param[in] check_duplicates Parameter to check duplicates
+  //! \param[in] check_duplicates Parameter to check duplicates, ids are
+  //! unique once stored as ranges
   //! \retval status Status of  create cell sets
   bool create_cell_sets(
       const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& cell_sets,
       bool check_duplicates);
 
+  //! Create map of vector of cells in sets from ranges of ids
+  //! \details Cells keep the order of the ranges, which is the order of
+  //! the input and of particles generated in the set
+  //! \param[in] cell_sets Ranges of cells ids by set id
+  //! \retval status Status of  create cell sets
+  bool create_cell_sets(
+      const tsl::robin_map<mpm::Index, mpm::RangeSet>& cell_sets);
+
   //! Get the vector of cell
   mpm::Vector<Cell<Tdim>> cells();
 
@@ -474,19 +619,60 @@ class Mesh {
   bool locate_particle_cells(
       const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle);
 
+  //! Write a property of particles to a buffer in parallel
+  //! \param[in] property Property of a particle, as an Eigen vector
+  //! \param[in] ncomponents Number of values of each particle
+  //! \param[out] data Buffer of number of particles x ncomponents values
+  //! \param[in] sample Positions of particles to write, all if nullptr
+  //! \tparam Tproperty Callable returning the property of a particle
+  template <typename Tproperty>
+  void write_particles_property(
+      Tproperty property, unsigned ncomponents, double* data,
+      const std::vector<std::size_t>* sample = nullptr) const;
+
+  //! Return cells in ascending order of ids, and bins of their boxes
+  //! \param[out] cells Cells of the mesh in ascending order of ids
+  //! \retval bins Bins of the bounding boxes of the cells
+  mpm::BoxBins<Tdim> cell_bins(
+      std::vector<std::shared_ptr<mpm::Cell<Tdim>>>* cells) const;
+
+  //! Return the cell of the rank of a partitioned mesh holding a point
+  //! \details A point on the boundary between cells belongs to the cell with
+  //! the lowest id, as the ghost layer has all the cells around the cells of
+  //! the rank, ranks agree on the owner of every point. Points outside the
+  //! cells of the rank are discarded by the bounding box of the bins, and
+  //! others are searched in the cells of their bin only.
+  //! \param[in] coordinates Coordinates of the point
+  //! \param[in] cells Cells of the mesh in ascending order of ids
+  //! \param[in] bins Bins of the bounding boxes of the cells
+  //! \param[out] xi Local coordinates of the point in the cell
+  //! \retval cell Cell of the point, nullptr if it is not in the rank
+  std::shared_ptr<mpm::Cell<Tdim>> locate_rank_cell(
+      const VectorDim& coordinates,
+      const std::vector<std::shared_ptr<mpm::Cell<Tdim>>>& cells,
+      const mpm::BoxBins<Tdim>& bins, VectorDim* xi) const;
+
+  //! Return the id of the first of new particles, unique across MPI ranks
+  //! \details Ids follow the particles of all ranks of a partitioned mesh,
+  //! and ranks number their new particles in turn
+  //! \param[in] nparticles Number of new particles in the rank
+  mpm::Index first_new_particle_id(mpm::Index nparticles) const;
+
  private:
   //! mesh id
   unsigned id_{std::numeric_limits<unsigned>::max()};
   //! Isoparametric mesh
   bool isoparametric_{true};
+  //! Only a partition of the global mesh is in the rank
+  bool partitioned_{false};
   //! Vector of mesh neighbours
   Map<Mesh<Tdim>> neighbour_meshes_;
   //! Vector of particles
   Vector<ParticleBase<Tdim>> particles_;
   //! Vector of particles ids and cell ids
   std::map<mpm::Index, mpm::Index> particles_cell_ids_;
-  //! Vector of particle sets
-  tsl::robin_map<unsigned, std::vector<mpm::Index>> particle_sets_;
+  //! Ranges of particle ids of particle sets
+  tsl::robin_map<unsigned, mpm::RangeSet> particle_sets_;
   //! Map of particles for fast retrieval
   Map<ParticleBase<Tdim>> map_particles_;
   //! Vector of nodes
@@ -237,6 +237,263 @@ bool mpm::Mesh<Tdim>::create_cells(
   return status;
 }
 
+//! Extend node ids of linear cells to the node stencil of an element
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>>
+    mpm::Mesh<Tdim>::extended_cell_connectivity(
+        const std::shared_ptr<const mpm::Element<Tdim>>& element,
+        const std::vector<std::vector<mpm::Index>>& cells) {
+  std::vector<std::vector<mpm::Index>> extended_cells;
+  try {
+    const Eigen::MatrixXd& unit_cell = element->unit_cell_coordinates();
+    const Eigen::MatrixXd& natural_nodes = element->natural_nodal_coordinates();
+    const unsigned ncorners = unit_cell.rows();
+    const unsigned nnodes = natural_nodes.rows();
+    if (cells.empty()) return extended_cells;
+
+    // Corner nodes of the element are numbered first, as in the unit cell
+    if (nnodes < ncorners ||
+        !natural_nodes.topRows(ncorners).isApprox(unit_cell))
+      throw std::runtime_error(
+          "Element nodes do not start with the corners of the unit cell");
+
+    // Position in the stencil of a node from its natural coordinates
+    std::map<std::array<long, Tdim>, unsigned> stencil;
+    for (unsigned n = 0; n < nnodes; ++n) {
+      std::array<long, Tdim> key;
+      for (unsigned i = 0; i < Tdim; ++i)
+        key[i] = std::lround(natural_nodes(n, i));
+      stencil.emplace(key, n);
+    }
+
+    // Cells sharing a node
+    tsl::robin_map<mpm::Index, std::vector<mpm::Index>> node_cells;
+    for (mpm::Index cid = 0; cid < cells.size(); ++cid) {
+      if (cells[cid].size() != ncorners)
+        throw std::runtime_error(
+            "Number of nodes of a cell does not match the unit cell");
+      for (auto nid : cells[cid]) node_cells[nid].emplace_back(cid);
+    }
+
+    // Zeros
+    const VectorDim zero = VectorDim::Zero();
+    // Coordinates of corner nodes
+    Eigen::MatrixXd corners(ncorners, Tdim);
+    // Affine map of a cell x = x_0 + J^T xi at its centroid
+    Eigen::Matrix<double, Tdim, Tdim> jacobian;
+    Eigen::Matrix<double, Tdim, Tdim> inverse_jacobian_transpose;
+    VectorDim origin;
+    auto affine_map = [&](const std::vector<mpm::Index>& cell) {
+      for (unsigned k = 0; k < ncorners; ++k)
+        corners.row(k) = map_nodes_[cell[k]]->coordinates().transpose();
+      jacobian = element->jacobian_local(zero, corners, zero, zero);
+      inverse_jacobian_transpose = jacobian.inverse().transpose();
+      origin = (corners.colwise().mean() -
+                unit_cell.colwise().mean() * jacobian)
+                   .transpose();
+    };
+    // Position in the stencil of a node in the affine map of a cell
+    auto stencil_position = [&](mpm::Index nid) {
+      const VectorDim xi = inverse_jacobian_transpose *
+                           (map_nodes_[nid]->coordinates() - origin);
+      std::array<long, Tdim> key;
+      for (unsigned i = 0; i < Tdim; ++i) key[i] = std::lround(xi(i));
+      return stencil.find(key);
+    };
+
+    // Padding nodes, in none of the cells, binned by their coordinates with
+    // a bin size of a unit of natural coordinates of the first cell
+    affine_map(cells.front());
+    const double bin_size = jacobian.rowwise().norm().maxCoeff();
+    auto bin = [bin_size](double coordinate) {
+      return static_cast<long>(std::floor(coordinate / bin_size));
+    };
+    std::map<std::array<long, Tdim>, std::vector<mpm::Index>> padding_nodes;
+    for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+      if (node_cells.find((*nitr)->id()) != node_cells.end()) continue;
+      std::array<long, Tdim> key;
+      for (unsigned i = 0; i < Tdim; ++i)
+        key[i] = bin((*nitr)->coordinates()(i));
+      padding_nodes[key].emplace_back((*nitr)->id());
+    }
+
+    extended_cells.reserve(cells.size());
+    for (mpm::Index cid = 0; cid < cells.size(); ++cid) {
+      const auto& cell = cells[cid];
+      affine_map(cell);
+
+      std::vector<mpm::Index> nodes(nnodes,
+                                    std::numeric_limits<mpm::Index>::max());
+      unsigned nfound = 0;
+      auto add_node = [&](mpm::Index nid) {
+        const auto position = stencil_position(nid);
+        if (position != stencil.end() &&
+            nodes[position->second] == std::numeric_limits<mpm::Index>::max()) {
+          nodes[position->second] = nid;
+          ++nfound;
+        }
+      };
+      // Nodes of the cells sharing a corner of the cell
+      for (auto corner : cell)
+        for (auto neighbour : node_cells.at(corner))
+          for (auto nid : cells[neighbour]) add_node(nid);
+
+      // Padding nodes in the bins around the missing nodes of the stencil
+      if (nfound < nnodes && !padding_nodes.empty()) {
+        // Half extent of a unit of natural coordinates
+        const VectorDim extent =
+            0.5 * jacobian.cwiseAbs().colwise().sum().transpose();
+        for (unsigned n = 0; n < nnodes; ++n) {
+          if (nodes[n] != std::numeric_limits<mpm::Index>::max()) continue;
+          const VectorDim centre =
+              origin + (natural_nodes.row(n) * jacobian).transpose();
+          std::array<long, Tdim> first, last, key;
+          for (unsigned i = 0; i < Tdim; ++i) {
+            first[i] = bin(centre(i) - extent(i));
+            last[i] = bin(centre(i) + extent(i));
+          }
+          // Iterate over the bins from first to last
+          key = first;
+          while (true) {
+            const auto itr = padding_nodes.find(key);
+            if (itr != padding_nodes.end())
+              for (auto nid : itr->second) add_node(nid);
+            unsigned i = 0;
+            for (; i < Tdim && key[i] == last[i]; ++i) key[i] = first[i];
+            if (i == Tdim) break;
+            ++key[i];
+          }
+        }
+      }
+
+      if (nfound != nnodes)
+        throw std::runtime_error(
+            "Cell with corner node " + std::to_string(cell.front()) +
+            " has an incomplete node stencil: the mesh needs a layer of "
+            "padding nodes around its cells");
+      extended_cells.emplace_back(nodes);
+    }
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    extended_cells.clear();
+  }
+  return extended_cells;
+}
+
+//! Create the nodes and cells of a rank of a partitioned mesh
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::create_partitioned_mesh(
+    const std::string& node_type, const std::vector<VectorDim>& coordinates,
+    const std::shared_ptr<mpm::Element<Tdim>>& element,
+    const std::vector<std::vector<mpm::Index>>& cells,
+    const std::vector<unsigned>& partition, bool check_duplicates) {
+  bool status = true;
+  try {
+    if (coordinates.empty() || cells.empty())
+      throw std::runtime_error("List of coordinates or cells is empty");
+    if (partition.size() != cells.size())
+      throw std::runtime_error("Partition does not match the cells");
+
+    int mpi_rank = 0;
+#ifdef USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+    // Elements with nodes beyond the cell need two layers of ghost cells, as
+    // the nodes of the cells of the rank get contributions from cells two
+    // layers away, and the nodes of the next layer and padding nodes for the
+    // stencils of the outer layer
+    const bool extend = element->nfunctions() > cells.front().size();
+    const unsigned nlayers = extend ? 2 : 1;
+    const unsigned nnode_layers = extend ? nlayers + 1 : nlayers;
+
+    // Layers of ghost cells sharing a node with the cells of the rank
+    const unsigned no_layer = std::numeric_limits<unsigned>::max();
+    std::vector<unsigned> cell_layers(cells.size(), no_layer);
+    for (mpm::Index cid = 0; cid < cells.size(); ++cid)
+      if (partition[cid] == static_cast<unsigned>(mpi_rank))
+        cell_layers[cid] = 0;
+    std::vector<bool> local_nodes(coordinates.size(), false);
+    for (unsigned layer = 0;; ++layer) {
+      for (mpm::Index cid = 0; cid < cells.size(); ++cid)
+        if (cell_layers[cid] == layer)
+          for (auto nid : cells[cid]) local_nodes.at(nid) = true;
+      if (layer == nnode_layers) break;
+      for (mpm::Index cid = 0; cid < cells.size(); ++cid)
+        if (cell_layers[cid] == no_layer)
+          for (auto nid : cells[cid])
+            if (local_nodes.at(nid)) {
+              cell_layers[cid] = layer + 1;
+              break;
+            }
+    }
+    // Padding nodes are in none of the cells
+    if (extend) {
+      std::vector<bool> padding_nodes(coordinates.size(), true);
+      for (const auto& cell : cells)
+        for (auto nid : cell) padding_nodes.at(nid) = false;
+      for (mpm::Index nid = 0; nid < coordinates.size(); ++nid)
+        if (padding_nodes[nid]) local_nodes[nid] = true;
+    }
+
+    // Create local nodes with their global ids
+    for (mpm::Index nid = 0; nid < coordinates.size(); ++nid) {
+      if (!local_nodes[nid]) continue;
+      bool insert_status = this->add_node(
+          Factory<mpm::NodeBase<Tdim>, mpm::Index,
+                  const Eigen::Matrix<double, Tdim, 1>&>::instance()
+              ->create(node_type, static_cast<mpm::Index>(nid),
+                       coordinates[nid]),
+          check_duplicates);
+      if (!insert_status)
+        throw std::runtime_error("Addition of node to mesh failed!");
+    }
+
+    // Node ids of local cells
+    std::vector<mpm::Index> cell_ids;
+    std::vector<std::vector<mpm::Index>> cell_nodes;
+    for (mpm::Index cid = 0; cid < cells.size(); ++cid) {
+      if (cell_layers[cid] > nlayers) continue;
+      cell_ids.emplace_back(cid);
+      cell_nodes.emplace_back(cells[cid]);
+    }
+    if (extend) {
+      cell_nodes = this->extended_cell_connectivity(element, cell_nodes);
+      if (cell_nodes.size() != cell_ids.size())
+        throw std::runtime_error("Extension of node stencils failed");
+    }
+
+    // Create local cells with their global ids and ranks
+    for (mpm::Index i = 0; i < cell_nodes.size(); ++i) {
+      auto cell = std::make_shared<mpm::Cell<Tdim>>(
+          cell_ids[i], cell_nodes[i].size(), element, this->isoparametric_);
+      unsigned local_nid = 0;
+      for (auto nid : cell_nodes[i])
+        cell->add_node(local_nid++, map_nodes_[nid]);
+      cell->rank(partition[cell_ids[i]]);
+
+      // Initialise cell before insertion
+      bool insert_cell = false;
+      if (cell->nnodes() == cell_nodes[i].size()) {
+        cell->initialise();
+        if (cell->is_initialised())
+          insert_cell = this->add_cell(cell, check_duplicates);
+      } else
+        throw std::runtime_error("Invalid node ids for cell!");
+      if (!insert_cell)
+        throw std::runtime_error("Addition of cell to mesh failed!");
+    }
+
+    partitioned_ = true;
+    console_->info("Rank {} partition: {} nodes and {} cells", mpi_rank,
+                   this->nnodes(), this->ncells());
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
 //! Add a cell to the mesh
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_cell(const std::shared_ptr<mpm::Cell<Tdim>>& cell,
@@ -267,23 +524,56 @@ void mpm::Mesh<Tdim>::iterate_over_cells(Toper oper) {
 //! Create cells from node lists
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_cell_neighbours() {
-  // Initialize and compute node cell map
-  tsl::robin_map<mpm::Index, std::set<mpm::Index>> node_cell_map;
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    // Populate node_cell_map with the node_id and multiple cell_id
-    auto cell_id = (*citr)->id();
-    for (auto id : (*citr)->nodes_id()) node_cell_map[id].insert(cell_id);
+  const std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells(cells_.cbegin(),
+                                                            cells_.cend());
+
+  // Offsets of the nodes of each cell in the node-cell incidence
+  std::vector<std::size_t> cell_offsets(cells.size() + 1, 0);
+  for (std::size_t i = 0; i < cells.size(); ++i)
+    cell_offsets[i + 1] = cell_offsets[i] + cells[i]->nnodes();
+
+  // Node-cell incidence pairs, sorted by node and cell ids
+  std::vector<std::pair<mpm::Index, mpm::Index>> incidence(cell_offsets.back());
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    std::size_t offset = cell_offsets[i];
+    for (const auto& node : cells[i]->nodes())
+      incidence[offset++] = std::make_pair(node->id(), cells[i]->id());
   }
+  mpm::parallel_sort(incidence.begin(), incidence.end());
+
+  // Cells of each node in compressed sparse row format
+  std::vector<mpm::Index> node_ids;
+  std::vector<std::size_t> node_offsets;
+  std::vector<mpm::Index> node_cells;
+  node_cells.reserve(incidence.size());
+  for (const auto& pair : incidence) {
+    if (node_ids.empty() || node_ids.back() != pair.first) {
+      node_ids.emplace_back(pair.first);
+      node_offsets.emplace_back(node_cells.size());
+    }
+    node_cells.emplace_back(pair.second);
+  }
+  node_offsets.emplace_back(node_cells.size());
 
+  // Neighbours of a cell are the other cells sharing its nodes
 #pragma omp parallel for schedule(runtime)
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    // Iterate over each node in current cell
-    for (auto id : (*citr)->nodes_id()) {
-      auto cell_id = (*citr)->id();
-      // Get the cells associated with each node
-      for (auto neighbour_id : node_cell_map[id])
-        if (neighbour_id != cell_id) (*citr)->add_neighbour(neighbour_id);
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    std::vector<mpm::Index> neighbours;
+    for (const auto& node : cells[i]->nodes()) {
+      const std::size_t n =
+          std::lower_bound(node_ids.begin(), node_ids.end(), node->id()) -
+          node_ids.begin();
+      neighbours.insert(neighbours.end(), node_cells.begin() + node_offsets[n],
+                        node_cells.begin() + node_offsets[n + 1]);
     }
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()),
+                     neighbours.end());
+    neighbours.erase(
+        std::remove(neighbours.begin(), neighbours.end(), cells[i]->id()),
+        neighbours.end());
+    cells[i]->assign_neighbours(neighbours);
   }
 }
 
@@ -331,7 +621,8 @@ void mpm::Mesh<Tdim>::find_particle_neighbours(
       // Send particle ids
       if (neighbour_cell_rank == mpi_rank) {
         // Get particle ids from each cell
-        auto send_particle_ids = map_cells_[neighbour_cell_id]->particles();
+        const auto& send_particle_ids =
+            map_cells_[neighbour_cell_id]->particles();
         // Get size of the particle ids
         int pid_size = send_particle_ids.size();
         // Send the size of the particles in cell
@@ -395,7 +686,7 @@ void mpm::Mesh<Tdim>::find_ghost_boundary_cells() {
       // If cell rank is the current MPI rank
       if ((*citr)->rank() == mpi_rank) {
         // Iterate through the neighbours of a cell
-        auto neighbours = (*citr)->neighbours();
+        const auto& neighbours = (*citr)->neighbours();
         for (auto neighbour : neighbours) {
           // If the neighbour is in a different MPI rank
           if (map_cells_[neighbour]->rank() != mpi_rank) {
@@ -482,40 +773,96 @@ bool mpm::Mesh<Tdim>::generate_material_points(
 
       // If set id is -1, use all cells
       auto cset = (cset_id == -1) ? this->cells_ : cell_sets_.at(cset_id);
-      // Iterate over each cell to generate points
-      for (auto citr = cset.cbegin(); citr != cset.cend(); ++citr) {
-        (*citr)->assign_quadrature(nquadratures);
-        // Genereate particles at the Gauss points
-        const auto cpoints = (*citr)->generate_points();
-        // Iterate over each coordinate to generate material points
-        for (const auto& coordinates : cpoints) {
-          // Particle id
-          mpm::Index pid = particles_.size();
-          // Create particle
+      std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells(cset.cbegin(),
+                                                          cset.cend());
+      // A partitioned mesh generates particles in the cells of the rank
+      if (partitioned_) {
+        int mpi_rank = 0;
+#ifdef USE_MPI
+        MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+        cells.erase(std::remove_if(cells.begin(), cells.end(),
+                                   [=](const std::shared_ptr<Cell<Tdim>>& c) {
+                                     return c->rank() !=
+                                            static_cast<unsigned>(mpi_rank);
+                                   }),
+                    cells.end());
+      }
+
+      // Zeros
+      const Eigen::Matrix<double, Tdim, 1> zeros =
+          Eigen::Matrix<double, Tdim, 1>::Zero();
+
+      // Gauss points and their shape functions, once for each element
+      std::map<const mpm::Element<Tdim>*,
+               std::pair<Eigen::MatrixXd, Eigen::MatrixXd>>
+          tables;
+      // Offset of the points of each cell
+      std::vector<mpm::Index> offsets(cells.size() + 1, 0);
+      for (unsigned i = 0; i < cells.size(); ++i) {
+        const auto element = cells[i]->element_ptr();
+        auto table = tables.find(element.get());
+        if (table == tables.end()) {
+          const Eigen::MatrixXd xi =
+              element->quadrature(nquadratures)->quadratures();
+          Eigen::MatrixXd shapefns(element->nfunctions(), xi.cols());
+          for (unsigned j = 0; j < xi.cols(); ++j) {
+            const Eigen::Matrix<double, Tdim, 1> lpoint = xi.col(j);
+            shapefns.col(j) = element->shapefn(lpoint, zeros, zeros);
+          }
+          table = tables.emplace(element.get(), std::make_pair(xi, shapefns))
+                      .first;
+        }
+        offsets[i + 1] = offsets[i] + table->second.first.cols();
+      }
+
+      // Generate particles at the Gauss points of each cell, tagged with
+      // their cell and local coordinates
+      const mpm::Index first_pid = this->first_new_particle_id(offsets.back());
+      std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles(
+          offsets.back());
+      unsigned nfailed = 0;
+#pragma omp parallel for schedule(runtime) reduction(+ : nfailed)
+      for (unsigned i = 0; i < cells.size(); ++i) {
+        const auto& table = tables.at(cells[i]->element_ptr().get());
+        const Eigen::Matrix<double, Tdim, Eigen::Dynamic> points =
+            cells[i]->generate_points(table.second);
+        if (points.cols() != table.first.cols()) {
+          ++nfailed;
+          continue;
+        }
+        for (unsigned j = 0; j < points.cols(); ++j) {
+          mpm::Index pid = first_pid + offsets[i] + j;
+          const Eigen::Matrix<double, Tdim, 1> coordinates = points.col(j);
           auto particle =
               Factory<mpm::ParticleBase<Tdim>, mpm::Index,
                       const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           coordinates);
-
-          // Add particle to mesh
-          status = this->add_particle(particle, checks);
-          if (status) {
-            map_particles_[pid]->assign_cell(*citr);
-            for (unsigned phase = 0; phase < materials.size(); phase++)
-              map_particles_[pid]->assign_material(materials[phase], phase);
-            pids.emplace_back(pid);
-          } else
-            throw std::runtime_error("Generate particles in mesh failed");
+                  ->create(particle_type, std::move(pid), coordinates);
+          const Eigen::Matrix<double, Tdim, 1> xi = table.first.col(j);
+          if (!particle->assign_cell_xi(cells[i], xi)) ++nfailed;
+          for (unsigned phase = 0; phase < materials.size(); phase++)
+            particle->assign_material(materials[phase], phase);
+          particles[offsets[i] + j] = particle;
         }
       }
-      if (before_generation == this->nparticles())
+      if (nfailed > 0)
+        throw std::runtime_error("Generate particles in mesh failed");
+
+      // Add particles to mesh
+      pids.reserve(particles.size());
+      for (const auto& particle : particles) {
+        status = this->add_particle(particle, checks);
+        if (!status)
+          throw std::runtime_error("Generate particles in mesh failed");
+        pids.emplace_back(particle->id());
+      }
+      if (!partitioned_ && before_generation == this->nparticles())
         throw std::runtime_error("No particles were generated!");
 
       // Add particles to set
       status = this->particle_sets_
-                   .insert(std::pair<mpm::Index, std::vector<mpm::Index>>(
-                       pset_id, pids))
+                   .insert(std::pair<mpm::Index, mpm::RangeSet>(
+                       pset_id, mpm::RangeSet(std::move(pids))))
                    .second;
       if (!status) throw std::runtime_error("Particle set creation failed");
 
@@ -549,15 +896,33 @@ bool mpm::Mesh<Tdim>::create_particles(
     // Check if particle coordinates is empty
     if (coordinates.empty())
       throw std::runtime_error("List of coordinates is empty");
+    // All ranks of a partitioned mesh number the particles in the order of
+    // the coordinates, and create those in the cells of the rank
+    const mpm::Index first_pid =
+        partitioned_ ? this->first_new_particle_id(0) : 0;
+    // Cells of a partitioned mesh in bins to locate particles
+    std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells;
+    const auto bins = partitioned_ ? this->cell_bins(&cells)
+                                   : mpm::BoxBins<Tdim>({}, {});
     // Iterate over particle coordinates
-    for (const auto& particle_coordinates : coordinates) {
+    for (mpm::Index i = 0; i < coordinates.size(); ++i) {
+      const auto& particle_coordinates = coordinates[i];
       // Particle id
       mpm::Index pid = particles_.size();
+      std::shared_ptr<mpm::Cell<Tdim>> cell;
+      VectorDim xi;
+      if (partitioned_) {
+        cell = this->locate_rank_cell(particle_coordinates, cells, bins, &xi);
+        if (!cell) continue;
+        pid = first_pid + i;
+      }
       // Create particle
       auto particle = Factory<mpm::ParticleBase<Tdim>, mpm::Index,
                               const Eigen::Matrix<double, Tdim, 1>&>::instance()
                           ->create(particle_type, static_cast<mpm::Index>(pid),
                                    particle_coordinates);
+      // Particle in the cell located in the rank
+      if (cell) particle->assign_cell_xi(cell, xi);
 
       // Add particle to mesh and check
       bool insert_status = this->add_particle(particle, check_duplicates);
@@ -572,8 +937,8 @@ bool mpm::Mesh<Tdim>::create_particles(
     }
     // Add particles to set
     status = this->particle_sets_
-                 .insert(std::pair<mpm::Index, std::vector<mpm::Index>>(pset_id,
-                                                                        pids))
+                 .insert(std::pair<mpm::Index, mpm::RangeSet>(
+                     pset_id, mpm::RangeSet(std::move(pids))))
                  .second;
     if (!status) throw std::runtime_error("Particle set creation failed");
   } catch (std::exception& exception) {
@@ -703,8 +1068,10 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(ghost_cells_.size());
+    // Requests and numbers of particles to send, which must outlive the
+    // non-blocking sends until they are waited for
+    std::vector<MPI_Request> send_requests(ghost_cells_.size());
+    std::vector<unsigned> nsend_particles(ghost_cells_.size(), 0);
 
     unsigned i = 0;
     unsigned np = 0;
@@ -714,9 +1081,8 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
          citr != this->ghost_cells_.cend(); ++citr, ++i) {
 
       // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      unsigned nparticles = particle_ids.size();
-      MPI_Isend(&nparticles, 1, MPI_UNSIGNED, (*citr)->rank(), 1,
+      nsend_particles[i] = (*citr)->particles().size();
+      MPI_Isend(&nsend_particles[i], 1, MPI_UNSIGNED, (*citr)->rank(), 1,
                 MPI_COMM_WORLD, &send_requests[i]);
     }
 
@@ -724,8 +1090,8 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
     for (auto citr = this->ghost_cells_.cbegin();
          citr != this->ghost_cells_.cend(); ++citr, ++i) {
       // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      for (auto& id : particle_ids) {
+      const auto& particle_ids = (*citr)->particles();
+      for (const auto& id : particle_ids) {
         // Create a vector of serialized particle
         std::vector<uint8_t> buffer = map_particles_[id]->serialize();
         MPI_Send(buffer.data(), buffer.size(), MPI_UINT8_T, (*citr)->rank(), 0,
@@ -851,8 +1217,8 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
         MPI_Ibsend(&nparticles, 1, MPI_UNSIGNED, cell->rank(), 0,
                    MPI_COMM_WORLD, &send_requests[nsend_requests]);
 
-        auto particle_ids = cell->particles();
-        for (auto& id : particle_ids) {
+        const auto& particle_ids = cell->particles();
+        for (const auto& id : particle_ids) {
           // Create a vector of serialized particle
           std::vector<uint8_t> buffer = map_particles_[id]->serialize();
           MPI_Ibsend(buffer.data(), buffer.size(), MPI_UINT8_T, cell->rank(), 0,
@@ -956,6 +1322,12 @@ void mpm::Mesh<Tdim>::resume_domain_cell_ranks() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  // Cells of a partitioned mesh keep the ranks of their partition
+  if (partitioned_) {
+    this->find_domain_shared_nodes();
+    this->find_ghost_boundary_cells();
+    return;
+  }
   const unsigned rank_max = std::numeric_limits<unsigned>::max();
   const unsigned ncells = this->ncells();
   // Vector of cell ranks
@@ -1030,18 +1402,47 @@ void mpm::Mesh<Tdim>::find_domain_shared_nodes() {
     }
   }
 #else
-  nhalo_nodes_ = 0;
+  // Domain shared nodes active on current MPI rank
+  std::vector<mpm::Index> shared_ids;
   for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
     std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
     // If node has more than 1 MPI rank
-    if (nodal_mpi_ranks.size() > 1) {
-      (*nitr)->ghost_id(nhalo_nodes_);
-      nhalo_nodes_ += 1;
-      // Add to domain shared nodes only if active on current MPI rank
-      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end())
-        domain_shared_nodes_.add(*nitr);
+    if (nodal_mpi_ranks.size() > 1 &&
+        nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
+      domain_shared_nodes_.add(*nitr);
+      shared_ids.emplace_back((*nitr)->id());
     }
   }
+
+  // Ghost ids index the sorted ids of the shared nodes of all ranks, so ranks
+  // agree on them without the whole mesh on every rank
+#ifdef USE_MPI
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  int nshared = shared_ids.size();
+  std::vector<int> counts(mpi_size), displacements(mpi_size, 0);
+  MPI_Allgather(&nshared, 1, MPI_INT, counts.data(), 1, MPI_INT,
+                MPI_COMM_WORLD);
+  for (int i = 1; i < mpi_size; ++i)
+    displacements[i] = displacements[i - 1] + counts[i - 1];
+  std::vector<unsigned long long> local_ids(shared_ids.begin(),
+                                            shared_ids.end());
+  std::vector<unsigned long long> all_ids(displacements.back() +
+                                          counts.back());
+  MPI_Allgatherv(local_ids.data(), nshared, MPI_UNSIGNED_LONG_LONG,
+                 all_ids.data(), counts.data(), displacements.data(),
+                 MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+  shared_ids.assign(all_ids.begin(), all_ids.end());
+#endif
+  std::sort(shared_ids.begin(), shared_ids.end());
+  shared_ids.erase(std::unique(shared_ids.begin(), shared_ids.end()),
+                   shared_ids.end());
+  nhalo_nodes_ = shared_ids.size();
+  for (auto nitr = domain_shared_nodes_.cbegin();
+       nitr != domain_shared_nodes_.cend(); ++nitr)
+    (*nitr)->ghost_id(std::lower_bound(shared_ids.begin(), shared_ids.end(),
+                                       (*nitr)->id()) -
+                      shared_ids.begin());
 #endif
 }
 
@@ -1075,7 +1476,7 @@ bool mpm::Mesh<Tdim>::locate_particle_cells(
     if (particle->compute_reference_location()) return true;
 
     // Check if material point is in any of its nearest neighbours
-    const auto neighbours = map_cells_[particle->cell_id()]->neighbours();
+    const auto& neighbours = map_cells_[particle->cell_id()]->neighbours();
     Eigen::Matrix<double, Tdim, 1> xi;
     Eigen::Matrix<double, Tdim, 1> coordinates = particle->coordinates();
     for (auto neighbour : neighbours) {
@@ -1102,6 +1503,79 @@ bool mpm::Mesh<Tdim>::locate_particle_cells(
   return status;
 }
 
+//! Return cells in ascending order of ids, and bins of their boxes
+template <unsigned Tdim>
+mpm::BoxBins<Tdim> mpm::Mesh<Tdim>::cell_bins(
+    std::vector<std::shared_ptr<mpm::Cell<Tdim>>>* cells) const {
+  cells->assign(cells_.cbegin(), cells_.cend());
+  std::sort(cells->begin(), cells->end(),
+            [](const std::shared_ptr<mpm::Cell<Tdim>>& lhs,
+               const std::shared_ptr<mpm::Cell<Tdim>>& rhs) {
+              return lhs->id() < rhs->id();
+            });
+
+  // Bounding boxes of the nodes of cells
+  std::vector<VectorDim> lower(cells->size()), upper(cells->size());
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < cells->size(); ++i) {
+    const auto& nodes = (*cells)[i]->nodes();
+    lower[i] = upper[i] = nodes.front()->coordinates();
+    for (const auto& node : nodes) {
+      lower[i] = lower[i].cwiseMin(node->coordinates());
+      upper[i] = upper[i].cwiseMax(node->coordinates());
+    }
+  }
+  return mpm::BoxBins<Tdim>(lower, upper);
+}
+
+//! Return the cell of the rank of a partitioned mesh holding a point
+template <unsigned Tdim>
+std::shared_ptr<mpm::Cell<Tdim>> mpm::Mesh<Tdim>::locate_rank_cell(
+    const VectorDim& coordinates,
+    const std::vector<std::shared_ptr<mpm::Cell<Tdim>>>& cells,
+    const mpm::BoxBins<Tdim>& bins, VectorDim* xi) const {
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+  if (!bins.contains(coordinates)) return nullptr;
+  // Cells of the bin in ascending order of ids, the first holding the point
+  // has the lowest id
+  const auto candidates = bins.boxes(coordinates);
+  for (auto itr = candidates.first; itr != candidates.second; ++itr) {
+    const auto& cell = cells[*itr];
+    if (cell->is_point_in_cell(coordinates, xi))
+      return (cell->rank() == static_cast<unsigned>(mpi_rank)) ? cell
+                                                               : nullptr;
+  }
+  return nullptr;
+}
+
+//! Return the id of the first of new particles, unique across MPI ranks
+template <unsigned Tdim>
+mpm::Index mpm::Mesh<Tdim>::first_new_particle_id(
+    mpm::Index nparticles) const {
+  mpm::Index first_pid = particles_.size();
+#ifdef USE_MPI
+  if (partitioned_) {
+    // Particles of all ranks, then new particles of the preceding ranks
+    unsigned long long local[2] = {particles_.size(), nparticles};
+    unsigned long long global = 0, preceding = 0;
+    MPI_Allreduce(&local[0], &global, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Exscan(&local[1], &preceding, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+               MPI_COMM_WORLD);
+    int mpi_rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    // Exscan leaves the result of the first rank undefined
+    if (mpi_rank == 0) preceding = 0;
+    first_pid = global + preceding;
+  }
+#endif
+  return first_pid;
+}
+
 //! Iterate over particles
 template <unsigned Tdim>
 template <typename Toper>
@@ -1111,6 +1585,32 @@ void mpm::Mesh<Tdim>::iterate_over_particles(Toper oper) {
     oper(*pitr);
 }
 
+//! Compute stresses of particles
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_particle_stresses() {
+  using StressPoint = mpm::StressPoint<Tdim>;
+  constexpr std::size_t block = 256;
+  const std::size_t nparticles = particles_.size();
+  const std::size_t nblocks = (nparticles + block - 1) / block;
+  const auto first = particles_.cbegin();
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t b = 0; b < nblocks; ++b) {
+    std::array<StressPoint, block> points;
+    const std::size_t begin = b * block;
+    const std::size_t npoints = std::min(block, nparticles - begin);
+    for (std::size_t i = 0; i < npoints; ++i)
+      points[i] = (*(first + begin + i))->stress_point();
+
+    // Runs of particles of a material
+    for (std::size_t i = 0, j = 0; i < npoints; i = j) {
+      for (j = i + 1; j < npoints && points[j].material == points[i].material;
+           ++j)
+        ;
+      points[i].material->compute_stresses(points.data() + i, j - i);
+    }
+  }
+}
+
 //! Iterate over particle set
 template <unsigned Tdim>
 template <typename Toper>
@@ -1120,13 +1620,17 @@ void mpm::Mesh<Tdim>::iterate_over_particle_set(int set_id, Toper oper) {
     this->iterate_over_particles(oper);
   } else {
     // Iterate over the particle set
-    auto set = particle_sets_.at(set_id);
+    const auto& set = particle_sets_.at(set_id);
+    // Walk the ranges of the set in blocks of consecutive positions
+    const std::size_t block = 1024;
+    const std::size_t nblocks = (set.size() + block - 1) / block;
 #pragma omp parallel for schedule(runtime)
-    for (auto sitr = set.begin(); sitr != set.cend(); ++sitr) {
-      unsigned pid = (*sitr);
-      if (map_particles_.find(pid) != map_particles_.end())
-        oper(map_particles_[pid]);
-    }
+    for (std::size_t i = 0; i < nblocks; ++i)
+      set.for_each(i * block, std::min(set.size(), (i + 1) * block),
+                   [&](mpm::Index pid) {
+                     if (map_particles_.find(pid) != map_particles_.end())
+                       oper(map_particles_[pid]);
+                   });
   }
 }
 
@@ -1148,50 +1652,67 @@ bool mpm::Mesh<Tdim>::add_neighbour(
   return insertion_status;
 }
 
+//! Return positions of a sample of particles
+template <unsigned Tdim>
+std::vector<std::size_t> mpm::Mesh<Tdim>::particles_sample(
+    mpm::Index stride, const VectorDim& min, const VectorDim& max) const {
+  const std::size_t nparticles = particles_.size();
+  // Flag sampled particles in parallel
+  std::vector<unsigned char> sampled(nparticles, 0);
+  const auto first = particles_.cbegin();
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < nparticles; ++i) {
+    const auto& particle = *(first + i);
+    const VectorDim& coordinates = particle->coordinates();
+    sampled[i] = (stride <= 1 || particle->id() % stride == 0) &&
+                 (coordinates.array() >= min.array()).all() &&
+                 (coordinates.array() <= max.array()).all();
+  }
+
+  std::vector<std::size_t> sample;
+  for (std::size_t i = 0; i < nparticles; ++i)
+    if (sampled[i]) sample.emplace_back(i);
+  return sample;
+}
+
 //! Return particle coordinates
 template <unsigned Tdim>
-std::vector<Eigen::Matrix<double, 3, 1>>
-    mpm::Mesh<Tdim>::particle_coordinates() {
-  std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates;
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Vector3d coordinates;
-    coordinates.setZero();
-    auto pcoords = (*pitr)->coordinates();
-    // Fill coordinates to the size of dimensions
-    for (unsigned i = 0; i < Tdim; ++i) coordinates(i) = pcoords(i);
-    particle_coordinates.emplace_back(coordinates);
-  }
+std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::particle_coordinates(
+    const std::vector<std::size_t>* sample) {
+  static_assert(sizeof(Eigen::Matrix<double, 3, 1>) == 3 * sizeof(double),
+                "Vectors are not contiguous");
+  std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates(
+      sample ? sample->size() : particles_.size());
+  // Fill coordinates to the size of dimensions
+  this->write_particles_property(
+      [](const mpm::ParticleBase<Tdim>& particle) {
+        return particle.coordinates();
+      },
+      3, particle_coordinates.data()->data(), sample);
   return particle_coordinates;
 }
 
 //! Return particle scalar data
 template <unsigned Tdim>
 std::vector<double> mpm::Mesh<Tdim>::particles_scalar_data(
-    const std::string& attribute) const {
-  std::vector<double> scalar_data;
-  scalar_data.reserve(particles_.size());
-  // Iterate over particles and add scalar value to data
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    scalar_data.emplace_back((*pitr)->scalar_data(attribute));
+    const std::string& attribute,
+    const std::vector<std::size_t>* sample) const {
+  std::vector<double> scalar_data(sample ? sample->size() : particles_.size());
+  this->particles_field_data(attribute, 1, scalar_data.data(), sample);
   return scalar_data;
 }
 
 //! Return particle vector data
 template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::particles_vector_data(
-    const std::string& attribute) const {
-  std::vector<Eigen::Matrix<double, 3, 1>> vector_data;
-  // Iterate over particles
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Matrix<double, 3, 1> data;
-    data.setZero();
-    auto pdata = (*pitr)->vector_data(attribute);
-    // Fill vector_data to the size of dimensions
-    for (unsigned i = 0; i < pdata.size(); ++i) data(i) = pdata(i);
-
-    // Add to a tensor of data
-    vector_data.emplace_back(data);
-  }
+    const std::string& attribute,
+    const std::vector<std::size_t>* sample) const {
+  static_assert(sizeof(Eigen::Matrix<double, 3, 1>) == 3 * sizeof(double),
+                "Vectors are not contiguous");
+  std::vector<Eigen::Matrix<double, 3, 1>> vector_data(
+      sample ? sample->size() : particles_.size());
+  this->particles_field_data(attribute, 3, vector_data.data()->data(),
+                             sample);
   return vector_data;
 }
 
@@ -1199,34 +1720,112 @@ std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::particles_vector_data(
 template <unsigned Tdim>
 template <unsigned Tsize>
 std::vector<Eigen::Matrix<double, Tsize, 1>>
-    mpm::Mesh<Tdim>::particles_tensor_data(const std::string& attribute) const {
-  std::vector<Eigen::Matrix<double, Tsize, 1>> tensor_data;
-  // Iterate over particles
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Matrix<double, Tsize, 1> data;
-    data.setZero();
-    auto pdata = (*pitr)->tensor_data(attribute);
-    // Fill tensor_data to the size of dimensions
-    for (unsigned i = 0; i < pdata.size(); ++i) data(i) = pdata(i);
-
-    // Add to a tensor of data
-    tensor_data.emplace_back(data);
-  }
+    mpm::Mesh<Tdim>::particles_tensor_data(
+        const std::string& attribute,
+        const std::vector<std::size_t>* sample) const {
+  static_assert(
+      sizeof(Eigen::Matrix<double, Tsize, 1>) == Tsize * sizeof(double),
+      "Tensors are not contiguous");
+  std::vector<Eigen::Matrix<double, Tsize, 1>> tensor_data(
+      sample ? sample->size() : particles_.size());
+  this->particles_field_data(attribute, Tsize, tensor_data.data()->data(),
+                             sample);
   return tensor_data;
 }
 
 //! Return particle state variable data
 template <unsigned Tdim>
 std::vector<double> mpm::Mesh<Tdim>::particles_statevars_data(
-    const std::string& attribute, unsigned phase) {
-  std::vector<double> statevars_data;
-  statevars_data.reserve(particles_.size());
-  // Iterate over particles and add scalar value to data
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    statevars_data.emplace_back((*pitr)->state_variable(attribute, phase));
+    const std::string& attribute, unsigned phase,
+    const std::vector<std::size_t>* sample) {
+  std::vector<double> statevars_data(sample ? sample->size()
+                                            : particles_.size());
+  this->write_particles_property(
+      [&](const mpm::ParticleBase<Tdim>& particle) {
+        return Eigen::Matrix<double, 1, 1>(
+            particle.state_variable(attribute, phase));
+      },
+      1, statevars_data.data(), sample);
   return statevars_data;
 }
 
+//! Write a particle field to a buffer
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particles_field_data(
+    const std::string& attribute, unsigned ncomponents, double* data,
+    const std::vector<std::size_t>* sample) const {
+  using Particle = mpm::ParticleBase<Tdim>;
+  using Scalar = Eigen::Matrix<double, 1, 1>;
+  if (attribute == "mass")
+    this->write_particles_property(
+        [](const Particle& particle) { return Scalar(particle.mass()); },
+        ncomponents, data, sample);
+  else if (attribute == "volume")
+    this->write_particles_property(
+        [](const Particle& particle) { return Scalar(particle.volume()); },
+        ncomponents, data, sample);
+  else if (attribute == "mass_density")
+    this->write_particles_property(
+        [](const Particle& particle) {
+          return Scalar(particle.mass_density());
+        },
+        ncomponents, data, sample);
+  else if (attribute == "displacements")
+    this->write_particles_property(
+        [](const Particle& particle) { return particle.displacement(); },
+        ncomponents, data, sample);
+  else if (attribute == "velocities")
+    this->write_particles_property(
+        [](const Particle& particle) { return particle.velocity(); },
+        ncomponents, data, sample);
+  else if (attribute == "stresses")
+    this->write_particles_property(
+        [](const Particle& particle) { return particle.stress(); },
+        ncomponents, data, sample);
+  else if (attribute == "strains")
+    this->write_particles_property(
+        [](const Particle& particle) { return particle.strain(); },
+        ncomponents, data, sample);
+  // Properties registered by particles
+  else if (ncomponents == 1)
+    this->write_particles_property(
+        [&](const Particle& particle) {
+          return Scalar(particle.scalar_data(attribute));
+        },
+        ncomponents, data, sample);
+  else if (ncomponents >= 6)
+    this->write_particles_property(
+        [&](const Particle& particle) {
+          return particle.tensor_data(attribute);
+        },
+        ncomponents, data, sample);
+  else
+    this->write_particles_property(
+        [&](const Particle& particle) {
+          return particle.vector_data(attribute);
+        },
+        ncomponents, data, sample);
+}
+
+//! Write a property of particles to a buffer in parallel
+template <unsigned Tdim>
+template <typename Tproperty>
+void mpm::Mesh<Tdim>::write_particles_property(
+    Tproperty property, unsigned ncomponents, double* data,
+    const std::vector<std::size_t>* sample) const {
+  const auto first = particles_.cbegin();
+  const long long nparticles = sample ? sample->size() : particles_.size();
+#pragma omp parallel for schedule(static)
+  for (long long i = 0; i < nparticles; ++i) {
+    const auto values = property(**(first + (sample ? (*sample)[i] : i)));
+    double* output = data + i * ncomponents;
+    const unsigned nvalues =
+        std::min(ncomponents, static_cast<unsigned>(values.size()));
+    for (unsigned j = 0; j < nvalues; ++j) output[j] = values(j);
+    for (unsigned j = nvalues; j < ncomponents; ++j) output[j] = 0.;
+  }
+}
+
 //! Assign particles volumes
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::assign_particles_volumes(
@@ -1277,7 +1876,8 @@ bool mpm::Mesh<Tdim>::compute_nodal_rotation_matrices(
       const auto rotation_matrix = mpm::geometry::rotation_matrix(angles);
 
       // Apply rotation matrix to nodes
-      map_nodes_[nid]->assign_rotation_matrix(rotation_matrix);
+      if (!this->is_nonlocal_node(nid))
+        map_nodes_[nid]->assign_rotation_matrix(rotation_matrix);
       status = true;
     }
   } catch (std::exception& exception) {
@@ -1407,6 +2007,14 @@ bool mpm::Mesh<Tdim>::assign_particles_stresses(
       throw std::runtime_error(
           "No particles have been assigned in mesh, cannot assign stresses");
 
+    // A partitioned mesh has a part of all particles, matched to the
+    // stresses of all particles by id
+    if (partitioned_) {
+      for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+        (*pitr)->initial_stress(particle_stresses.at((*pitr)->id()));
+      return status;
+    }
+
     if (particles_.size() != particle_stresses.size())
       throw std::runtime_error(
           "Number of particles in mesh and initial stresses don't match");
@@ -1438,6 +2046,9 @@ bool mpm::Mesh<Tdim>::assign_particles_cells(
       // Cell id
       mpm::Index cid = particle_cell[1];
 
+      // Skip particles on other ranks of a partitioned mesh
+      if (partitioned_ && map_particles_.find(pid) == map_particles_.end())
+        continue;
       map_particles_[pid]->assign_cell_id(cid);
     }
   } catch (std::exception& exception) {
@@ -1472,37 +2083,15 @@ std::vector<std::array<mpm::Index, 2>> mpm::Mesh<Tdim>::particles_cells()
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
                                            const std::string& filename) {
-  const unsigned nparticles = this->nparticles();
-
-  std::vector<HDF5Particle> particle_data;  // = new HDF5Particle[nparticles];
-  particle_data.reserve(nparticles);
-
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    particle_data.emplace_back((*pitr)->hdf5());
-
-  // Calculate the size and the offsets of our struct members in memory
-  const hsize_t NRECORDS = nparticles;
-
-  const hsize_t NFIELDS = mpm::hdf5::particle::NFIELDS;
-
-  hid_t file_id;
-  hsize_t chunk_size = 10000;
-  int* fill_data = NULL;
-  int compress = 0;
-
-  // Create a new file using default properties.
-  file_id =
-      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
-
-  // make a table
-  H5TBmake_table(
-      "Table Title", file_id, "table", NFIELDS, NRECORDS,
-      mpm::hdf5::particle::dst_size, mpm::hdf5::particle::field_names,
-      mpm::hdf5::particle::dst_offset, mpm::hdf5::particle::field_type,
-      chunk_size, fill_data, compress, particle_data.data());
-
-  H5Fclose(file_id);
-  return true;
+  bool status = true;
+  try {
+    mpm::hdf5::write_particles(filename, this->particles_hdf5(),
+                               mpm::hdf5::Layout::Table, false);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
 }
 
 //! Write particles to HDF5
@@ -1510,25 +2099,9 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
                                           const std::string& filename) {
 
-  // Create a new file using default properties.
-  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
-  // Throw an error if file can't be found
-  if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
-
-  // Calculate the size and the offsets of our struct members in memory
-  hsize_t nrecords = 0;
-  hsize_t nfields = 0;
-  H5TBget_table_info(file_id, "table", &nfields, &nrecords);
-
-  if (nfields != mpm::hdf5::particle::NFIELDS)
-    throw std::runtime_error("HDF5 table has incorrect number of fields");
-
-  std::vector<HDF5Particle> dst_buf;
-  dst_buf.reserve(nrecords);
-  // Read the table
-  H5TBread_table(file_id, "table", mpm::hdf5::particle::dst_size,
-                 mpm::hdf5::particle::dst_offset,
-                 mpm::hdf5::particle::dst_sizes, dst_buf.data());
+  // Particles of the rank in a file of either layout
+  const auto dst_buf = mpm::hdf5::read_particles(filename);
+  const hsize_t nrecords = dst_buf.size();
 
   // Particle type
   const std::string particle_type = (Tdim == 2) ? "P2D" : "P3D";
@@ -1560,25 +2133,140 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
     if (!insert_status)
       throw std::runtime_error("Addition of particle to mesh failed!");
   }
-  // close the file
-  H5Fclose(file_id);
   return true;
 }
 
 //! Write particles to HDF5
 template <unsigned Tdim>
-std::vector<mpm::HDF5Particle> mpm::Mesh<Tdim>::particles_hdf5() const {
-  const unsigned nparticles = this->nparticles();
+std::vector<mpm::HDF5Particle> mpm::Mesh<Tdim>::particles_hdf5(
+    const std::vector<std::size_t>* sample) const {
+  const unsigned nparticles = sample ? sample->size() : this->nparticles();
 
-  std::vector<mpm::HDF5Particle> particles_hdf5;
-  particles_hdf5.reserve(nparticles);
-
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
-    particles_hdf5.emplace_back((*pitr)->hdf5());
+  std::vector<mpm::HDF5Particle> particles_hdf5(nparticles);
+  const auto first = particles_.cbegin();
+#pragma omp parallel for schedule(runtime)
+  for (unsigned i = 0; i < nparticles; ++i)
+    particles_hdf5[i] = (*(first + (sample ? (*sample)[i] : i)))->hdf5();
 
   return particles_hdf5;
 }
 
+//! Return reference locations of particles in their cells
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, 3, 1>>
+    mpm::Mesh<Tdim>::particles_reference_locations() const {
+  static_assert(sizeof(Eigen::Matrix<double, 3, 1>) == 3 * sizeof(double),
+                "Vectors are not contiguous");
+  std::vector<Eigen::Matrix<double, 3, 1>> xi(particles_.size());
+  this->write_particles_property(
+      [](const mpm::ParticleBase<Tdim>& particle) {
+        return particle.reference_location();
+      },
+      3, xi.data()->data());
+  return xi;
+}
+
+//! Return deformation gradients of particle domains
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, 3, 3>>
+    mpm::Mesh<Tdim>::particles_deformation_gradients() const {
+  std::vector<Eigen::Matrix<double, 3, 3>> deformation_gradients(
+      particles_.size(), Eigen::Matrix<double, 3, 3>::Identity());
+  const auto first = particles_.cbegin();
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < particles_.size(); ++i)
+    deformation_gradients[i].template topLeftCorner<Tdim, Tdim>() =
+        (*(first + i))->deformation_gradient();
+  return deformation_gradients;
+}
+
+//! Write a checkpoint of particles to HDF5
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::write_checkpoint_hdf5(const std::string& filename,
+                                            unsigned compression) {
+  bool status = true;
+  try {
+    mpm::hdf5::write_checkpoint(filename, this->particles_hdf5(),
+                                this->particles_reference_locations(),
+                                this->particles_deformation_gradients(),
+                                compression);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Read a checkpoint of particles from HDF5
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::read_checkpoint_hdf5(unsigned phase,
+                                           const std::string& filename) {
+  // Particles of the rank, their reference locations and deformation
+  std::vector<Eigen::Matrix<double, 3, 1>> xi;
+  std::vector<Eigen::Matrix<double, 3, 3>> deformation_gradients;
+  const auto pod_particles =
+      mpm::hdf5::read_checkpoint(filename, &xi, &deformation_gradients);
+  const std::size_t nrecords = pod_particles.size();
+
+  // Particle type
+  const std::string particle_type = (Tdim == 2) ? "P2D" : "P3D";
+
+  // Create and initialise particles in parallel
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles(nrecords);
+  bool status = true;
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < nrecords; ++i) {
+    try {
+      const auto& pod_particle = pod_particles[i];
+      const Eigen::Matrix<double, Tdim, 1> coords =
+          Eigen::Matrix<double, Tdim, 1>::Zero();
+      auto particle =
+          Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                  const Eigen::Matrix<double, Tdim, 1>&>::instance()
+              ->create(particle_type, static_cast<mpm::Index>(pod_particle.id),
+                       coords);
+      particle->initialise_particle(
+          pod_particle, materials_.at(pod_particle.material_id));
+      particle->assign_deformation_gradient(
+          deformation_gradients[i].template topLeftCorner<Tdim, Tdim>());
+      particles[i] = particle;
+    } catch (std::exception& exception) {
+#pragma omp critical
+      {
+        console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+        status = false;
+      }
+    }
+  }
+  if (!status) throw std::runtime_error("Initialise checkpoint particles");
+
+  // Add particles to mesh
+  for (const auto& particle : particles)
+    if (!this->add_particle(particle, false))
+      throw std::runtime_error("Addition of particle to mesh failed!");
+
+  // Attach particles to the cells of the checkpoint
+  std::vector<unsigned char> attached(nrecords, 0);
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < nrecords; ++i) {
+    const auto cell = map_cells_.find(pod_particles[i].cell_id);
+    if (cell != map_cells_.end())
+      attached[i] = particles[i]->assign_cell_xi(
+          cell->second, xi[i].template head<Tdim>());
+  }
+
+  // Locate particles not attached to their cells
+  for (std::size_t i = 0; i < nrecords; ++i) {
+    if (attached[i]) continue;
+    if (map_cells_.find(particles[i]->cell_id()) == map_cells_.end())
+      particles[i]->remove_cell();
+    if (!this->locate_particle_cells(particles[i]))
+      throw std::runtime_error("Particle outside the mesh domain");
+  }
+
+  return true;
+}
+
 //! Nodal coordinates
 template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::nodal_coordinates()
@@ -1647,19 +2335,44 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::create_particle_sets(
     const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& particle_sets,
     bool check_duplicates) {
+  // Store ids of each set as ranges
+  tsl::robin_map<mpm::Index, mpm::RangeSet> sets;
+  for (auto sitr = particle_sets.begin(); sitr != particle_sets.end(); ++sitr)
+    sets.insert(std::make_pair(sitr->first, mpm::RangeSet(sitr->second)));
+  return this->create_particle_sets(sets);
+}
+
+//! Create map of ranges of particles in sets
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::create_particle_sets(
+    const tsl::robin_map<mpm::Index, mpm::RangeSet>& particle_sets) {
   bool status = false;
   try {
-    // Create container for each particle set
+    // Create ranges of each particle set
     for (auto sitr = particle_sets.begin(); sitr != particle_sets.end();
          ++sitr) {
-      // Create a container for the set
-      std::vector<mpm::Index> particles((sitr->second).begin(),
-                                        (sitr->second).end());
+      mpm::RangeSet particles = sitr->second;
+      // Skip particles on other ranks of a partitioned mesh
+      if (partitioned_) {
+        std::vector<mpm::RangeSet::Range> ranges;
+        for (const auto& range : sitr->second.ranges())
+          for (mpm::Index pid = range.first; pid - range.first < range.count;
+               ++pid) {
+            if (map_particles_.find(pid) == map_particles_.end()) continue;
+            // Extend the last range with consecutive local particles
+            if (!ranges.empty() &&
+                ranges.back().first + ranges.back().count == pid)
+              ++ranges.back().count;
+            else
+              ranges.emplace_back(mpm::RangeSet::Range{pid, 1});
+          }
+        particles = mpm::RangeSet(std::move(ranges));
+      }
 
-      // Create the map of the container
+      // Create the map of the ranges
       status = this->particle_sets_
-                   .insert(std::pair<mpm::Index, std::vector<mpm::Index>>(
-                       sitr->first, particles))
+                   .insert(std::pair<mpm::Index, mpm::RangeSet>(
+                       sitr->first, std::move(particles)))
                    .second;
     }
   } catch (std::exception& exception) {
@@ -1673,6 +2386,17 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::create_node_sets(
     const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& node_sets,
     bool check_duplicates) {
+  // Store ids of each set as ranges
+  tsl::robin_map<mpm::Index, mpm::RangeSet> sets;
+  for (auto sitr = node_sets.begin(); sitr != node_sets.end(); ++sitr)
+    sets.insert(std::make_pair(sitr->first, mpm::RangeSet(sitr->second)));
+  return this->create_node_sets(sets);
+}
+
+//! Create map of container of nodes in sets from ranges of ids
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::create_node_sets(
+    const tsl::robin_map<mpm::Index, mpm::RangeSet>& node_sets) {
   bool status = false;
   try {
     // Create container for each node set
@@ -1681,10 +2405,13 @@ bool mpm::Mesh<Tdim>::create_node_sets(
       Vector<NodeBase<Tdim>> nodes;
       // Reserve the size of the container
       nodes.reserve((sitr->second).size());
-      // Add nodes to the container
-      for (auto pid : sitr->second) {
-        nodes.add(map_nodes_[pid], check_duplicates);
-      }
+      // Add nodes to the container, ids of ranges are unique
+      for (const auto& range : sitr->second.ranges())
+        for (mpm::Index nid = range.first; nid - range.first < range.count;
+             ++nid) {
+          if (this->is_nonlocal_node(nid)) continue;
+          nodes.add(map_nodes_[nid], false);
+        }
 
       // Create the map of the vector
       status = this->node_sets_
@@ -1709,6 +2436,17 @@ template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::create_cell_sets(
     const tsl::robin_map<mpm::Index, std::vector<mpm::Index>>& cell_sets,
     bool check_duplicates) {
+  // Store ids of each set as ranges
+  tsl::robin_map<mpm::Index, mpm::RangeSet> sets;
+  for (auto sitr = cell_sets.begin(); sitr != cell_sets.end(); ++sitr)
+    sets.insert(std::make_pair(sitr->first, mpm::RangeSet(sitr->second)));
+  return this->create_cell_sets(sets);
+}
+
+//! Create map of container of cells in sets from ranges of ids
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::create_cell_sets(
+    const tsl::robin_map<mpm::Index, mpm::RangeSet>& cell_sets) {
   bool status = false;
   try {
     // Create container for each cell set
@@ -1717,10 +2455,15 @@ bool mpm::Mesh<Tdim>::create_cell_sets(
       Vector<Cell<Tdim>> cells;
       // Reserve the size of the container
       cells.reserve((sitr->second).size());
-      // Add cells to the container
-      for (auto pid : sitr->second) {
-        cells.add(map_cells_[pid], check_duplicates);
-      }
+      // Add cells to the container, ids of ranges are unique
+      for (const auto& range : sitr->second.ranges())
+        for (mpm::Index cid = range.first; cid - range.first < range.count;
+             ++cid) {
+          // Skip cells on other ranks of a partitioned mesh
+          if (partitioned_ && map_cells_.find(cid) == map_cells_.end())
+            continue;
+          cells.add(map_cells_[cid], false);
+        }
 
       // Create the map of the container
       status = this->cell_sets_
@@ -0,0 +1,216 @@
+#ifndef MPM_MESH_PARTITION_H_
+#define MPM_MESH_PARTITION_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! Partition cells by recursive coordinate bisection of their centroids
+//! \details Each range of cells is split along its longest extent at the
+//! cell that balances the number of parts on either side. Ties are broken by
+//! cell id, so every rank computes the same partition from the same mesh
+//! without communication
+//! \param[in] coordinates Nodal coordinates
+//! \param[in] cells Node ids of cells
+//! \param[in] nparts Number of parts
+//! \retval partition Part of each cell
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+std::vector<unsigned> partition_cells(
+    const std::vector<Eigen::Matrix<double, Tdim, 1>>& coordinates,
+    const std::vector<std::vector<mpm::Index>>& cells, unsigned nparts) {
+  const mpm::Index ncells = cells.size();
+  std::vector<unsigned> partition(ncells, 0);
+  if (nparts < 2 || ncells == 0) return partition;
+
+  // Cell centroids
+  std::vector<Eigen::Matrix<double, Tdim, 1>> centroids(ncells);
+#pragma omp parallel for schedule(static)
+  for (mpm::Index c = 0; c < ncells; ++c) {
+    Eigen::Matrix<double, Tdim, 1> centroid =
+        Eigen::Matrix<double, Tdim, 1>::Zero();
+    for (auto nid : cells[c]) centroid += coordinates.at(nid);
+    centroids[c] = centroid / static_cast<double>(cells[c].size());
+  }
+
+  // Ranges of cell ids still to be split: first, last, first part, nparts
+  std::vector<mpm::Index> ids(ncells);
+  std::iota(ids.begin(), ids.end(), 0);
+  std::vector<std::array<mpm::Index, 4>> ranges{{0, ncells, 0, nparts}};
+  while (!ranges.empty()) {
+    const auto range = ranges.back();
+    ranges.pop_back();
+    const auto first = ids.begin() + range[0];
+    const auto last = ids.begin() + range[1];
+
+    if (range[3] == 1 || range[1] - range[0] < 2) {
+      for (auto itr = first; itr != last; ++itr)
+        partition[*itr] = static_cast<unsigned>(range[2]);
+      continue;
+    }
+
+    // Longest extent of the centroids in the range
+    Eigen::Matrix<double, Tdim, 1> lower = centroids[*first];
+    Eigen::Matrix<double, Tdim, 1> upper = centroids[*first];
+    for (auto itr = first; itr != last; ++itr) {
+      lower = lower.cwiseMin(centroids[*itr]);
+      upper = upper.cwiseMax(centroids[*itr]);
+    }
+    unsigned axis = 0;
+    (upper - lower).maxCoeff(&axis);
+
+    // Split the cells in proportion to the parts on either side
+    const mpm::Index nleft_parts = range[3] / 2;
+    const mpm::Index middle =
+        range[0] + (range[1] - range[0]) * nleft_parts / range[3];
+    std::nth_element(first, ids.begin() + middle, last,
+                     [&](mpm::Index a, mpm::Index b) {
+                       return centroids[a](axis) < centroids[b](axis) ||
+                              (centroids[a](axis) == centroids[b](axis) &&
+                               a < b);
+                     });
+    ranges.push_back({range[0], middle, range[2], nleft_parts});
+    ranges.push_back(
+        {middle, range[1], range[2] + nleft_parts, range[3] - nleft_parts});
+  }
+  return partition;
+}
+
+//! BoxBins class
+//! \brief Uniform grid of bins over boxes, to find the boxes that may hold a
+//! point without searching all boxes
+//! \details Each bin lists the boxes that overlap it, in ascending order of
+//! their indices, so a search over the boxes of a bin can stop at the first
+//! box that holds the point
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class BoxBins {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  //! \param[in] lower Lower corners of boxes
+  //! \param[in] upper Upper corners of boxes
+  //! \param[in] tolerance Margin around boxes, relative to the extent of all
+  //! boxes
+  BoxBins(const std::vector<VectorDim>& lower,
+          const std::vector<VectorDim>& upper, double tolerance = 1.E-6)
+      : offsets_(1, 0) {
+    if (lower.empty() || lower.size() != upper.size()) return;
+    lower_ = lower.front();
+    upper_ = upper.front();
+    for (std::size_t i = 0; i < lower.size(); ++i) {
+      lower_ = lower_.cwiseMin(lower[i]);
+      upper_ = upper_.cwiseMax(upper[i]);
+    }
+    margin_ = tolerance * std::max((upper_ - lower_).maxCoeff(), 1.);
+    lower_.array() -= margin_;
+    upper_.array() += margin_;
+
+    // About one box in each bin
+    const unsigned nbins = std::max(
+        1., std::floor(std::pow(static_cast<double>(lower.size()), 1. / Tdim)));
+    std::size_t total = 1;
+    for (unsigned d = 0; d < Tdim; ++d) {
+      nbins_[d] = nbins;
+      size_[d] = (upper_[d] - lower_[d]) / nbins;
+      total *= nbins;
+    }
+
+    // Count the boxes of each bin, then list them
+    offsets_.assign(total + 1, 0);
+    for (std::size_t i = 0; i < lower.size(); ++i)
+      this->for_each_bin(lower[i], upper[i],
+                         [&](std::size_t bin) { ++offsets_[bin + 1]; });
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+    boxes_.resize(offsets_.back());
+    std::vector<std::size_t> next(offsets_.begin(), offsets_.end() - 1);
+    for (std::size_t i = 0; i < lower.size(); ++i)
+      this->for_each_bin(lower[i], upper[i],
+                         [&](std::size_t bin) { boxes_[next[bin]++] = i; });
+  }
+
+  //! Return if a point is in the bounding box of all boxes
+  //! \param[in] point Coordinates of the point
+  bool contains(const VectorDim& point) const {
+    return offsets_.size() > 1 && (point.array() >= lower_.array()).all() &&
+           (point.array() <= upper_.array()).all();
+  }
+
+  //! Return the indices of boxes in the bin of a point, in ascending order
+  //! \param[in] point Coordinates of the point, in the bounding box
+  //! \retval boxes First and past the last index of boxes in the bin
+  std::pair<const mpm::Index*, const mpm::Index*> boxes(
+      const VectorDim& point) const {
+    const std::size_t bin = this->bin(point);
+    return std::make_pair(boxes_.data() + offsets_[bin],
+                          boxes_.data() + offsets_[bin + 1]);
+  }
+
+ private:
+  //! Return the bin of a coordinate along a direction
+  unsigned bin(double coordinate, unsigned dir) const {
+    const double position = std::floor((coordinate - lower_[dir]) / size_[dir]);
+    return static_cast<unsigned>(std::min(
+        std::max(position, 0.), static_cast<double>(nbins_[dir] - 1)));
+  }
+
+  //! Return the bin of a point
+  std::size_t bin(const VectorDim& point) const {
+    std::size_t index = 0;
+    for (unsigned d = Tdim; d-- > 0;)
+      index = index * nbins_[d] + this->bin(point[d], d);
+    return index;
+  }
+
+  //! Iterate over the bins that overlap a box with its margin
+  template <typename Toper>
+  void for_each_bin(const VectorDim& lower, const VectorDim& upper,
+                    Toper oper) const {
+    std::array<unsigned, Tdim> first, last, index;
+    for (unsigned d = 0; d < Tdim; ++d) {
+      first[d] = this->bin(lower[d] - margin_, d);
+      last[d] = this->bin(upper[d] + margin_, d);
+    }
+    index = first;
+    while (true) {
+      std::size_t bin = 0;
+      for (unsigned d = Tdim; d-- > 0;) bin = bin * nbins_[d] + index[d];
+      oper(bin);
+      // Next bin, with the first direction varying fastest
+      unsigned d = 0;
+      for (; d < Tdim && index[d] == last[d]; ++d) index[d] = first[d];
+      if (d == Tdim) break;
+      ++index[d];
+    }
+  }
+
+  //! Lower corner of the bins
+  VectorDim lower_{VectorDim::Zero()};
+  //! Upper corner of the bins
+  VectorDim upper_{VectorDim::Zero()};
+  //! Margin around boxes
+  double margin_{0.};
+  //! Number of bins along each direction
+  std::array<unsigned, Tdim> nbins_;
+  //! Size of bins along each direction
+  std::array<double, Tdim> size_;
+  //! Position of the first box of each bin in the boxes, and their number
+  std::vector<std::size_t> offsets_;
+  //! Indices of boxes of the bins
+  std::vector<mpm::Index> boxes_;
+};  // BoxBins class
+
+}  // namespace mpm
+
+#endif  // MPM_MESH_PARTITION_H_
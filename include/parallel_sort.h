@@ -0,0 +1,67 @@
+#ifndef MPM_PARALLEL_SORT_H_
+#define MPM_PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace mpm {
+
+//! Sort a range in parallel
+//! \details Sorts one chunk of the range per thread and merges the sorted
+//! chunks pairwise, with the merges of each level in parallel. Falls back to
+//! std::sort without OpenMP
+//! \param[in] first Iterator to the first element of the range
+//! \param[in] last Iterator past the last element of the range
+//! \param[in] compare Comparison function
+//! \tparam Titerator Random access iterator
+//! \tparam Tcompare Comparison function type
+template <typename Titerator, typename Tcompare>
+void parallel_sort(Titerator first, Titerator last, Tcompare compare) {
+  const long size = std::distance(first, last);
+#ifdef _OPENMP
+  const long nchunks = std::min<long>(omp_get_max_threads(), size / 1024 + 1);
+#else
+  const long nchunks = 1;
+#endif
+  if (nchunks < 2) {
+    std::sort(first, last, compare);
+    return;
+  }
+
+  // Chunk boundaries
+  std::vector<long> bounds(nchunks + 1);
+  for (long i = 0; i <= nchunks; ++i) bounds[i] = i * size / nchunks;
+
+#pragma omp parallel for schedule(static)
+  for (long i = 0; i < nchunks; ++i)
+    std::sort(first + bounds[i], first + bounds[i + 1], compare);
+
+  // Merge pairs of sorted chunks until one chunk is left
+  for (long width = 1; width < nchunks; width *= 2) {
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < nchunks - width; i += 2 * width)
+      std::inplace_merge(first + bounds[i], first + bounds[i + width],
+                         first + bounds[std::min(i + 2 * width, nchunks)],
+                         compare);
+  }
+}
+
+//! Sort a range in parallel in ascending order
+//! \param[in] first Iterator to the first element of the range
+//! \param[in] last Iterator past the last element of the range
+//! \tparam Titerator Random access iterator
+template <typename Titerator>
+void parallel_sort(Titerator first, Titerator last) {
+  using Tvalue = typename std::iterator_traits<Titerator>::value_type;
+  mpm::parallel_sort(first, last, std::less<Tvalue>());
+}
+
+}  // namespace mpm
+
+#endif  // MPM_PARALLEL_SORT_H_
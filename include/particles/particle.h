@@ -114,6 +114,13 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute shape functions of a particle, based on local coordinates
   void compute_shapefn() noexcept override;
 
+  //! Compute shape functions of a particle, unless it is in the same cell
+  //! and its local coordinates and domain changed less than a tolerance
+  //! since the last evaluation
+  //! \param[in] tolerance Tolerance on the change in local coordinates
+  //! \retval status Shape functions are recomputed
+  bool update_shapefn(double tolerance) noexcept override;
+
   //! Assign volume
   //! \param[in] volume Volume of particle
   bool assign_volume(double volume) override;
@@ -124,6 +131,19 @@ class Particle : public ParticleBase<Tdim> {
   //! Return size of particle in natural coordinates
   VectorDim natural_size() const override { return natural_size_; }
 
+  //! Return deformation gradient of the particle domain
+  //! \details Tracked for CPDI elements, identity otherwise
+  Eigen::Matrix<double, Tdim, Tdim> deformation_gradient() const override {
+    return deformation_gradient_;
+  }
+
+  //! Assign deformation gradient of the particle domain
+  //! \param[in] deformation_gradient Deformation gradient
+  void assign_deformation_gradient(
+      const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) override {
+    deformation_gradient_ = deformation_gradient;
+  }
+
   //! Compute volume as cell volume / nparticles
   void compute_volume() noexcept override;
 
@@ -171,7 +191,7 @@ class Particle : public ParticleBase<Tdim> {
   Eigen::Matrix<double, 6, 1> strain() const override { return strain_; }
 
   //! Return strain rate of the particle
-  Eigen::Matrix<double, 6, 1> strain_rate() const override {
+  const Eigen::Matrix<double, 6, 1>& strain_rate() const override {
     return strain_rate_;
   };
 
@@ -194,6 +214,9 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute stress
   void compute_stress() noexcept override;
 
+  //! Return the stress update of the particle for its material
+  mpm::StressPoint<Tdim> stress_point() noexcept override;
+
   //! Return stress of the particle
   Eigen::Matrix<double, 6, 1> stress() const override { return stress_; }
 
@@ -322,6 +345,18 @@ class Particle : public ParticleBase<Tdim> {
   void initialise_material(unsigned phase_size = 1);
 
  private:
+  //! Return if the particle is in a cell with CPDI shape functions
+  inline bool cpdi() const noexcept;
+
+  //! Return the vectors spanning the particle domain, from its size in
+  //! natural coordinates
+  //! \details Mapped by the deformation gradient for CPDI elements
+  inline Eigen::Matrix<double, Tdim, Tdim> domain() const noexcept;
+
+  //! Update the deformation gradient of the particle domain
+  //! \param[in] dt Analysis time step
+  inline void update_deformation_gradient(double dt) noexcept;
+
   //! Compute strain rate
   //! \param[in] dn_dx The spatial gradient of shape function
   //! \param[in] phase Index to indicate phase
@@ -366,6 +401,8 @@ class Particle : public ParticleBase<Tdim> {
   Eigen::Matrix<double, 1, Tdim> size_;
   //! Size of particle in natural coordinates
   Eigen::Matrix<double, 1, Tdim> natural_size_;
+  //! Deformation gradient of the particle domain
+  Eigen::Matrix<double, Tdim, Tdim> deformation_gradient_;
   //! Stresses
   Eigen::Matrix<double, 6, 1> stress_;
   //! Strains
@@ -394,6 +431,12 @@ class Particle : public ParticleBase<Tdim> {
   Eigen::MatrixXd dn_dx_;
   //! dN/dX at cell centroid
   Eigen::MatrixXd dn_dx_centroid_;
+  //! Cell id at the last evaluation of shape functions
+  Index shapefn_cell_id_{std::numeric_limits<Index>::max()};
+  //! Local coordinates at the last evaluation of shape functions
+  VectorDim shapefn_xi_;
+  //! Domain at the last evaluation of shape functions
+  Eigen::Matrix<double, Tdim, Tdim> shapefn_domain_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
   //! Map of scalar properties
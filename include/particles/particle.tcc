@@ -234,7 +234,9 @@ mpm::HDF5Particle mpm::Particle<Tdim>::hdf5() const {
 // Initialise particle properties
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::initialise() {
+  deformation_gradient_.setIdentity();
   displacement_.setZero();
+  shapefn_cell_id_ = std::numeric_limits<Index>::max();
   dstrain_.setZero();
   mass_ = 0.;
   natural_size_.setZero();
@@ -305,9 +307,11 @@ bool mpm::Particle<Tdim>::assign_cell(
       cell_id_ = cellptr->id();
       // dn_dx centroid
       dn_dx_centroid_ = cell_->dn_dx_centroid();
-      // Copy nodal pointer to cell
-      nodes_.clear();
-      nodes_ = cell_->nodes();
+      // Nodal pointers of the cell, without copying the shared pointers
+      const auto& cell_nodes = cell_->nodes();
+      nodes_.resize(cell_nodes.size());
+      for (unsigned i = 0; i < cell_nodes.size(); ++i)
+        nodes_[i] = cell_nodes[i].get();
 
       // Compute reference location of particle
       bool xi_status = this->compute_reference_location();
@@ -339,9 +343,11 @@ bool mpm::Particle<Tdim>::assign_cell_xi(
       cell_id_ = cellptr->id();
       // dn_dx centroid
       dn_dx_centroid_ = cell_->dn_dx_centroid();
-      // Copy nodal pointer to cell
-      nodes_.clear();
-      nodes_ = cell_->nodes();
+      // Nodal pointers of the cell, without copying the shared pointers
+      const auto& cell_nodes = cell_->nodes();
+      nodes_.resize(cell_nodes.size());
+      for (unsigned i = 0; i < cell_nodes.size(); ++i)
+        nodes_[i] = cell_nodes[i].get();
 
       // Assign the reference location of particle
       bool xi_nan = false;
@@ -438,18 +444,54 @@ template <unsigned Tdim>
 void mpm::Particle<Tdim>::compute_shapefn() noexcept {
   // Check if particle has a valid cell ptr
   assert(cell_ != nullptr);
-  // Get element ptr of a cell
-  const auto element = cell_->element_ptr();
 
-  // Zero matrix
-  Eigen::Matrix<double, Tdim, 1> zero = Eigen::Matrix<double, Tdim, 1>::Zero();
+  // Compute shape function and dN/dx of the particle, over its deformed
+  // domain for CPDI
+  const VectorDim natural_size = this->natural_size_.transpose();
+  if (this->cpdi())
+    cell_->domain_shapefn_dn_dx(this->xi_, natural_size, deformation_gradient_,
+                                &shapefn_, &dn_dx_);
+  else
+    cell_->shapefn_dn_dx(this->xi_, natural_size, VectorDim::Zero(),
+                         &shapefn_, &dn_dx_);
+
+  // Record the state of the evaluation
+  shapefn_cell_id_ = cell_id_;
+  shapefn_xi_ = this->xi_;
+  shapefn_domain_ = this->domain();
+}
+
+// Compute shape functions and gradients if the particle has moved
+template <unsigned Tdim>
+bool mpm::Particle<Tdim>::update_shapefn(double tolerance) noexcept {
+  // Reuse the last evaluation while the particle stays in the same cell.
+  // Changes are measured from the evaluated state, so they do not accumulate
+  if (cell_ != nullptr && cell_id_ == shapefn_cell_id_ &&
+      (this->xi_ - shapefn_xi_).template lpNorm<Eigen::Infinity>() <
+          tolerance &&
+      (this->domain() - shapefn_domain_).template lpNorm<Eigen::Infinity>() <
+          tolerance)
+    return false;
+
+  this->compute_shapefn();
+  return true;
+}
 
-  // Compute shape function of the particle
-  shapefn_ = element->shapefn(this->xi_, this->natural_size_, zero);
+// Return if the particle is in a cell with CPDI shape functions
+template <unsigned Tdim>
+inline bool mpm::Particle<Tdim>::cpdi() const noexcept {
+  return cell_ != nullptr &&
+         cell_->element_ptr()->shapefn_type() == mpm::ShapefnType::CPDI;
+}
 
-  // Compute dN/dx
-  dn_dx_ = element->dn_dx(this->xi_, cell_->nodal_coordinates(),
-                          this->natural_size_, zero);
+// Return the vectors spanning the particle domain in natural coordinates
+template <unsigned Tdim>
+inline Eigen::Matrix<double, Tdim, Tdim> mpm::Particle<Tdim>::domain() const
+    noexcept {
+  Eigen::Matrix<double, Tdim, Tdim> domain = this->natural_size_.asDiagonal();
+  // Deform the domain for CPDI
+  if (this->cpdi()) domain = (deformation_gradient_ * domain).eval();
+  return domain;
 }
 
 // Assign volume to the particle
@@ -658,6 +700,27 @@ void mpm::Particle<Tdim>::compute_strain(double dt) noexcept {
   // Assign volumetric strain at centroid
   dvolumetric_strain_ = dt * strain_rate_centroid.head(Tdim).sum();
   volumetric_strain_centroid_ += dvolumetric_strain_;
+
+  // Track the deformation of the particle domain for CPDI
+  if (cell_->element_ptr()->shapefn_type() == mpm::ShapefnType::CPDI)
+    this->update_deformation_gradient(dt);
+}
+
+// Update the deformation gradient of the particle domain
+template <unsigned Tdim>
+inline void mpm::Particle<Tdim>::update_deformation_gradient(
+    double dt) noexcept {
+  // Velocity gradient L = sum_i v_i (dN_i/dx)^T
+  Eigen::Matrix<double, Tdim, Tdim> velocity_gradient =
+      Eigen::Matrix<double, Tdim, Tdim>::Zero();
+  for (unsigned i = 0; i < this->nodes_.size(); ++i)
+    velocity_gradient.noalias() +=
+        nodes_[i]->velocity(mpm::ParticlePhase::Solid) * dn_dx_.row(i);
+
+  // F_{n+1} = (I + L dt) F_n
+  const Eigen::Matrix<double, Tdim, Tdim> increment =
+      Eigen::Matrix<double, Tdim, Tdim>::Identity() + dt * velocity_gradient;
+  deformation_gradient_ = (increment * deformation_gradient_).eval();
 }
 
 // Compute stress
@@ -666,10 +729,21 @@ void mpm::Particle<Tdim>::compute_stress() noexcept {
   // Check if material ptr is valid
   assert(this->material() != nullptr);
   // Calculate stress
-  this->stress_ =
-      (this->material())
-          ->compute_stress(stress_, dstrain_, this,
-                           &state_variables_[mpm::ParticlePhase::Solid]);
+  auto point = this->stress_point();
+  point.material->compute_stresses(&point, 1);
+}
+
+// Return the stress update of the particle for its material
+template <unsigned Tdim>
+mpm::StressPoint<Tdim> mpm::Particle<Tdim>::stress_point() noexcept {
+  return mpm::StressPoint<Tdim>{
+      material_[mpm::ParticlePhase::Solid].get(),
+      &stress_,
+      &dstrain_,
+      &strain_rate_,
+      dvolumetric_strain_,
+      &state_variables_[mpm::ParticlePhase::Solid],
+      this};
 }
 
 //! Map body force
@@ -934,6 +1008,9 @@ int mpm::Particle<Tdim>::compute_pack_size() const {
   // Coordinates, displacement, natural size, velocity
   MPI_Pack_size(4 * Tdim, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
   total_size += partial_size;
+  // Deformation gradient
+  MPI_Pack_size(Tdim * Tdim, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
+  total_size += partial_size;
   // Stress & strain
   MPI_Pack_size(6 * 2, MPI_DOUBLE, MPI_COMM_WORLD, &partial_size);
   total_size += partial_size;
@@ -1012,6 +1089,9 @@ std::vector<uint8_t> mpm::Particle<Tdim>::serialize() {
   // Natural size
   MPI_Pack(natural_size_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(),
            &position, MPI_COMM_WORLD);
+  // Deformation gradient
+  MPI_Pack(deformation_gradient_.data(), Tdim * Tdim, MPI_DOUBLE, data_ptr,
+           data.size(), &position, MPI_COMM_WORLD);
   // Velocity
   MPI_Pack(velocity_.data(), Tdim, MPI_DOUBLE, data_ptr, data.size(), &position,
            MPI_COMM_WORLD);
@@ -1104,6 +1184,9 @@ void mpm::Particle<Tdim>::deserialize(
   // Natural size
   MPI_Unpack(data_ptr, data.size(), &position, natural_size_.data(), Tdim,
              MPI_DOUBLE, MPI_COMM_WORLD);
+  // Deformation gradient
+  MPI_Unpack(data_ptr, data.size(), &position, deformation_gradient_.data(),
+             Tdim * Tdim, MPI_DOUBLE, MPI_COMM_WORLD);
   // Velocity
   MPI_Unpack(data_ptr, data.size(), &position, velocity_.data(), Tdim,
              MPI_DOUBLE, MPI_COMM_WORLD);
@@ -23,6 +23,31 @@ namespace mpm {
 template <unsigned Tdim>
 class Material;
 
+// Forward declaration of ParticleBase
+template <unsigned Tdim>
+class ParticleBase;
+
+//! Stress update of a particle
+//! \details Kinematics and history of a particle gathered by the particle,
+//! which material models read without querying the particle
+template <unsigned Tdim>
+struct StressPoint {
+  //! Material of the particle
+  Material<Tdim>* material;
+  //! Stress, updated in place
+  Eigen::Matrix<double, 6, 1>* stress;
+  //! Strain increment
+  const Eigen::Matrix<double, 6, 1>* dstrain;
+  //! Strain rate
+  const Eigen::Matrix<double, 6, 1>* strain_rate;
+  //! Volumetric strain increment
+  double dvolumetric_strain;
+  //! History-dependent state variables
+  mpm::dense_map* state_vars;
+  //! Particle
+  const ParticleBase<Tdim>* particle;
+};
+
 //! Particle phases
 enum ParticlePhase : unsigned int { Solid = 0, Liquid = 1, Gas = 2 };
 
@@ -126,6 +151,12 @@ class ParticleBase {
   //! Compute shape functions
   virtual void compute_shapefn() noexcept = 0;
 
+  //! Compute shape functions if the particle has moved
+  //! \param[in] tolerance Change in local coordinates below which the shape
+  //! functions of the last evaluation are reused
+  //! \retval status Shape functions are recomputed
+  virtual bool update_shapefn(double tolerance) noexcept = 0;
+
   //! Assign volume
   virtual bool assign_volume(double volume) = 0;
 
@@ -135,6 +166,14 @@ class ParticleBase {
   //! Return size of particle in natural coordinates
   virtual VectorDim natural_size() const = 0;
 
+  //! Return deformation gradient of the particle domain
+  virtual Eigen::Matrix<double, Tdim, Tdim> deformation_gradient() const = 0;
+
+  //! Assign deformation gradient of the particle domain
+  //! \param[in] deformation_gradient Deformation gradient
+  virtual void assign_deformation_gradient(
+      const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) = 0;
+
   //! Compute volume of particle
   virtual void compute_volume() noexcept = 0;
 
@@ -208,7 +247,7 @@ class ParticleBase {
   virtual Eigen::Matrix<double, 6, 1> strain() const = 0;
 
   //! Strain rate
-  virtual Eigen::Matrix<double, 6, 1> strain_rate() const = 0;
+  virtual const Eigen::Matrix<double, 6, 1>& strain_rate() const = 0;
 
   //! Volumetric strain of centroid
   virtual double volumetric_strain_centroid() const = 0;
@@ -222,6 +261,11 @@ class ParticleBase {
   //! Compute stress
   virtual void compute_stress() noexcept = 0;
 
+  //! Return the stress update of the particle for its material
+  //! \details Its pointers refer to the particle, which stays alive and
+  //! unmoved while they are used
+  virtual StressPoint<Tdim> stress_point() noexcept = 0;
+
   //! Return stress
   virtual Eigen::Matrix<double, 6, 1> stress() const = 0;
 
@@ -328,8 +372,8 @@ class ParticleBase {
   Eigen::Matrix<double, Tdim, 1> xi_;
   //! Cell
   std::shared_ptr<Cell<Tdim>> cell_;
-  //! Vector of nodal pointers
-  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
+  //! Vector of nodal pointers, owned by the cell
+  std::vector<NodeBase<Tdim>*> nodes_;
   //! Material
   std::vector<std::shared_ptr<Material<Tdim>>> material_;
   //! Unsigned material id
@@ -20,10 +20,13 @@
 #include "constraints.h"
 #include "contact.h"
 #include "contact_friction.h"
+#include "entity_sets.h"
+#include "mesh_partition.h"
 #include "mpm.h"
 #include "mpm_scheme.h"
 #include "mpm_scheme_usf.h"
 #include "mpm_scheme_usl.h"
+#include "output_pipeline.h"
 #include "particle.h"
 #include "vector.h"
 
@@ -84,6 +87,24 @@ class MPMBase : public MPM {
   //! Write HDF5 files
   void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
 
+  //! Return if a step is an output step of a cadence
+  //! \param[in] step Step
+  //! \param[in] steps Steps between outputs, none if 0
+  bool is_output_step(mpm::Index step, mpm::Index steps) const {
+    return steps > 0 && step % steps == 0;
+  }
+
+  //! Read particles of the rank from the checkpoint of a step
+  //! \param[in] phase Phase of particles
+  //! \param[in] step Step of the checkpoint
+  //! \param[in] particles Read HDF5 particles of the step without checkpoint
+  void read_checkpoint(unsigned phase, mpm::Index step, bool particles);
+
+  //! Write a checkpoint of particles
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps
+  void write_checkpoint(mpm::Index step, mpm::Index max_steps);
+
   //! Domain decomposition
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
@@ -92,9 +113,8 @@ class MPMBase : public MPM {
   //! \param[in] phase Phase to smooth pressure
   void pressure_smoothing(unsigned phase);
 
-  //! Particle entity sets
-  //! \param[in] check Check duplicates
-  void particle_entity_sets(bool check);
+  //! Particle entity sets from a JSON or a binary file
+  void particle_entity_sets();
 
   //! Particle velocity constraints
   void particle_velocity_constraints();
@@ -104,10 +124,9 @@ class MPMBase : public MPM {
   //! \retval isoparametric Status of mesh type
   bool is_isoparametric();
 
-  //! Node entity sets
+  //! Node entity sets from a JSON or a binary file
   //! \param[in] mesh_prop Mesh properties
-  //! \param[in] check Check duplicates
-  void node_entity_sets(const Json& mesh_prop, bool check);
+  void node_entity_sets(const Json& mesh_prop);
 
   //! Node Euler angles
   //! \param[in] mesh_prop Mesh properties
@@ -127,10 +146,9 @@ class MPMBase : public MPM {
   void nodal_frictional_constraints(
       const Json& mesh_prop, const std::shared_ptr<mpm::IOMesh<Tdim>>& mesh_io);
 
-  //! Cell entity sets
+  //! Cell entity sets from a JSON or a binary file
   //! \param[in] mesh_prop Mesh properties
-  //! \param[in] check Check duplicates
-  void cell_entity_sets(const Json& mesh_prop, bool check);
+  void cell_entity_sets(const Json& mesh_prop);
 
   //! Particles cells
   //! \param[in] mesh_prop Mesh properties
@@ -197,6 +215,36 @@ class MPMBase : public MPM {
   std::map<unsigned, std::shared_ptr<mpm::FunctionBase>> math_functions_;
   //! VTK particle variables
   tsl::robin_map<mpm::VariableType, std::vector<std::string>> vtk_vars_;
+  //! Steps between outputs of VTK variables with their own output steps
+  tsl::robin_map<std::string, mpm::Index> vtk_field_steps_;
+  //! Steps between HDF5 outputs, none if 0
+  mpm::Index hdf5_output_steps_{std::numeric_limits<mpm::Index>::max()};
+  //! Steps between VTK outputs of geometry and variables, none if 0
+  mpm::Index vtk_output_steps_{std::numeric_limits<mpm::Index>::max()};
+  //! Steps between Partio outputs, none if 0
+  mpm::Index partio_output_steps_{std::numeric_limits<mpm::Index>::max()};
+  //! Sample particles of VTK and Partio outputs
+  bool subsample_{false};
+  //! Stride of ids of sampled particles
+  mpm::Index subsample_stride_{1};
+  //! Lower corner of the box of sampled particles
+  Eigen::Matrix<double, Tdim, 1> subsample_min_;
+  //! Upper corner of the box of sampled particles
+  Eigen::Matrix<double, Tdim, 1> subsample_max_;
+  //! Write all VTK variables to a file per step
+  bool vtk_single_file_{false};
+  //! Compressor of VTK variables in a single file ("none", "zlib", "lz4")
+  std::string vtk_compressor_{"zlib"};
+  //! Write HDF5 particles of all ranks to a shared file
+  bool hdf5_shared_file_{false};
+  //! Layout of HDF5 particles
+  mpm::hdf5::Layout hdf5_layout_{mpm::hdf5::Layout::Table};
+  //! Steps between checkpoints of particles, none if 0
+  mpm::Index checkpoint_steps_{0};
+  //! Compression level of checkpoints from 0 (none) to 9
+  unsigned checkpoint_compression_{1};
+  //! Output pipeline writing snapshots in the background
+  std::unique_ptr<mpm::OutputPipeline> output_{nullptr};
   //! VTK state variables
   tsl::robin_map<unsigned, std::vector<std::string>> vtk_statevars_;
   //! Set node concentrated force
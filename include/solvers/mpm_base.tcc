@@ -116,10 +116,15 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
   if ((post_process_.find("vtk") != post_process_.end()) &&
       post_process_.at("vtk").is_array() &&
       post_process_.at("vtk").size() > 0) {
-    // Iterate over vtk
+    // Iterate over vtk, a name or an attribute with its own output steps
     for (unsigned i = 0; i < post_process_.at("vtk").size(); ++i) {
+      const auto& vtk = post_process_["vtk"][i];
       std::string attribute =
-          post_process_["vtk"][i].template get<std::string>();
+          vtk.is_object() ? vtk.at("attribute").template get<std::string>()
+                          : vtk.template get<std::string>();
+      if (vtk.is_object() && vtk.contains("output_steps"))
+        vtk_field_steps_[attribute] =
+            vtk.at("output_steps").template get<mpm::Index>();
       if (variables.find(attribute) != variables.end())
         vtk_vars_[variables.at(attribute)].emplace_back(attribute);
       else {
@@ -154,6 +159,11 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
         const std::vector<std::string> state_var = svars["statevars"];
         vtk_statevars_.insert(std::make_pair(phase_id, state_var));
         vtk_statevar = true;
+        // Output steps of the state variables
+        if (svars.contains("output_steps"))
+          for (const auto& attribute : state_var)
+            vtk_field_steps_["phase" + std::to_string(phase_id) + attribute] =
+                svars.at("output_steps").template get<mpm::Index>();
       } else {
         vtk_statevar = false;
         break;
@@ -164,6 +174,107 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     console_->warn(
         "{} #{}: No VTK statevariable were specified, none will be generated",
         __FILE__, __LINE__);
+
+  // Steps between outputs of each writer, output steps by default
+  hdf5_output_steps_ = output_steps_;
+  vtk_output_steps_ = output_steps_;
+  partio_output_steps_ = output_steps_;
+  try {
+    if (post_process_.contains("vtk_output_steps"))
+      vtk_output_steps_ =
+          post_process_.at("vtk_output_steps").template get<mpm::Index>();
+    if (post_process_.contains("partio_output_steps"))
+      partio_output_steps_ =
+          post_process_.at("partio_output_steps").template get<mpm::Index>();
+  } catch (std::exception& exception) {
+    console_->warn("{} #{}: Invalid output steps of writers: {}", __FILE__,
+                   __LINE__, exception.what());
+  }
+
+  // Sample of particles in visualisation outputs, by stride of ids and box
+  subsample_min_.fill(std::numeric_limits<double>::lowest());
+  subsample_max_.fill(std::numeric_limits<double>::max());
+  if (post_process_.contains("subsample") &&
+      post_process_.at("subsample").is_object()) {
+    try {
+      const auto& subsample = post_process_.at("subsample");
+      if (subsample.contains("stride"))
+        subsample_stride_ = subsample.at("stride").template get<mpm::Index>();
+      for (unsigned i = 0; i < Tdim; ++i) {
+        if (subsample.contains("min"))
+          subsample_min_(i) = subsample.at("min").at(i).template get<double>();
+        if (subsample.contains("max"))
+          subsample_max_(i) = subsample.at("max").at(i).template get<double>();
+      }
+      subsample_ = true;
+    } catch (std::exception& exception) {
+      console_->warn("{} #{}: Invalid subsample, writing all particles: {}",
+                     __FILE__, __LINE__, exception.what());
+      subsample_ = false;
+    }
+  }
+
+  // HDF5 particles of all ranks in a shared file and layout of fields
+  if (post_process_.contains("hdf5") && post_process_.at("hdf5").is_object()) {
+    try {
+      const auto& hdf5 = post_process_.at("hdf5");
+      if (hdf5.contains("output_steps"))
+        hdf5_output_steps_ = hdf5.at("output_steps").template get<mpm::Index>();
+      if (hdf5.contains("shared_file"))
+        hdf5_shared_file_ = hdf5.at("shared_file").template get<bool>();
+      if (hdf5.contains("layout"))
+        hdf5_layout_ =
+            mpm::hdf5::layout(hdf5.at("layout").template get<std::string>());
+    } catch (std::exception& exception) {
+      console_->warn("{} #{}: Invalid HDF5 options, using defaults: {}",
+                     __FILE__, __LINE__, exception.what());
+      hdf5_shared_file_ = false;
+      hdf5_layout_ = mpm::hdf5::Layout::Table;
+    }
+  }
+
+  // VTK variables in a single file per step, and its compressor
+  try {
+    if (post_process_.contains("vtk_single_file"))
+      vtk_single_file_ =
+          post_process_.at("vtk_single_file").template get<bool>();
+    if (post_process_.contains("vtk_compressor"))
+      vtk_compressor_ =
+          post_process_.at("vtk_compressor").template get<std::string>();
+  } catch (std::exception& exception) {
+    console_->warn("{} #{}: Invalid VTK file options: {}", __FILE__, __LINE__,
+                   exception.what());
+  }
+
+  // Checkpoints of particles for resume and their compression
+  if (post_process_.contains("checkpoint") &&
+      post_process_.at("checkpoint").is_object()) {
+    try {
+      const auto& checkpoint = post_process_.at("checkpoint");
+      if (checkpoint.contains("steps"))
+        checkpoint_steps_ =
+            checkpoint.at("steps").template get<mpm::Index>();
+      if (checkpoint.contains("compression"))
+        checkpoint_compression_ =
+            checkpoint.at("compression").template get<unsigned>();
+    } catch (std::exception& exception) {
+      console_->warn("{} #{}: Invalid checkpoint options, none written: {}",
+                     __FILE__, __LINE__, exception.what());
+      checkpoint_steps_ = 0;
+    }
+  }
+
+  // Output snapshots written in the background, synchronously if none
+  unsigned output_buffers = 2;
+  try {
+    if (post_process_.contains("output_buffers"))
+      output_buffers =
+          post_process_.at("output_buffers").template get<unsigned>();
+  } catch (std::exception& exception) {
+    console_->warn("{} #{}: Invalid output buffers, using {}: {}", __FILE__,
+                   __LINE__, output_buffers, exception.what());
+  }
+  output_ = std::make_unique<mpm::OutputPipeline>(output_buffers);
 }
 
 // Initialise mesh
@@ -207,16 +318,41 @@ void mpm::MPMBase<Tdim>::initialise_mesh() {
   std::string mesh_file =
       io_->file_name(mesh_props["mesh"].template get<std::string>());
 
-  // Create nodes from file
-  bool node_status =
-      mesh_->create_nodes(gid,                                  // global id
-                          node_type,                            // node type
-                          mesh_io->read_mesh_nodes(mesh_file),  // coordinates
-                          check_duplicates);                    // check dups
-
-  if (!node_status)
-    throw std::runtime_error(
-        "mpm::base::init_mesh(): Addition of nodes to mesh failed");
+  // Each MPI rank creates only its partition of a distributed mesh
+  bool distributed = false;
+  if (mesh_props.find("distributed") != mesh_props.end())
+    distributed = mesh_props["distributed"].template get<bool>();
+
+  if (distributed && mpi_size > 1) {
+    // Shape function
+    std::shared_ptr<mpm::Element<Tdim>> element =
+        Factory<mpm::Element<Tdim>>::instance()->create(
+            mesh_props["cell_type"].template get<std::string>());
+
+    // Partition the cells of the global mesh, which all ranks read, and
+    // create the nodes and cells of the rank with a ghost layer
+    const auto coordinates = mesh_io->read_mesh_nodes(mesh_file);
+    const auto cells = mesh_io->read_mesh_cells(mesh_file);
+    bool mesh_status = mesh_->create_partitioned_mesh(
+        node_type, coordinates, element, cells,
+        mpm::partition_cells<Tdim>(coordinates, cells, mpi_size),
+        check_duplicates);
+
+    if (!mesh_status)
+      throw std::runtime_error(
+          "mpm::base::init_mesh(): Creation of partitioned mesh failed");
+  } else {
+    // Create nodes from file
+    bool node_status = mesh_->create_nodes(
+        gid,                                  // global id
+        node_type,                            // node type
+        mesh_io->read_mesh_nodes(mesh_file),  // coordinates
+        check_duplicates);                    // check dups
+
+    if (!node_status)
+      throw std::runtime_error(
+          "mpm::base::init_mesh(): Addition of nodes to mesh failed");
+  }
 
   auto nodes_end = std::chrono::steady_clock::now();
   console_->info("Rank {} Read nodes: {} ms", mpi_rank,
@@ -225,7 +361,7 @@ void mpm::MPMBase<Tdim>::initialise_mesh() {
                      .count());
 
   // Read and assign node sets
-  this->node_entity_sets(mesh_props, check_duplicates);
+  this->node_entity_sets(mesh_props);
 
   // Read nodal euler angles and assign rotation matrices
   this->node_euler_angles(mesh_props, mesh_io);
@@ -238,28 +374,42 @@ void mpm::MPMBase<Tdim>::initialise_mesh() {
 
   // Initialise cell
   auto cells_begin = std::chrono::steady_clock::now();
-  // Shape function name
-  const auto cell_type = mesh_props["cell_type"].template get<std::string>();
-  // Shape function
-  std::shared_ptr<mpm::Element<Tdim>> element =
-      Factory<mpm::Element<Tdim>>::instance()->create(cell_type);
-
-  // Create cells from file
-  bool cell_status =
-      mesh_->create_cells(gid,                                  // global id
-                          element,                              // element tyep
-                          mesh_io->read_mesh_cells(mesh_file),  // Node ids
-                          check_duplicates);                    // Check dups
-
-  if (!cell_status)
-    throw std::runtime_error(
-        "mpm::base::init_mesh(): Addition of cells to mesh failed");
+  // Cells of a partitioned mesh are already created
+  if (!mesh_->is_partitioned()) {
+    // Shape function name
+    const auto cell_type = mesh_props["cell_type"].template get<std::string>();
+    // Shape function
+    std::shared_ptr<mpm::Element<Tdim>> element =
+        Factory<mpm::Element<Tdim>>::instance()->create(cell_type);
+
+    // Node ids of cells
+    auto cells = mesh_io->read_mesh_cells(mesh_file);
+    // Elements with nodes beyond the cell (GIMP, B-spline) on linear cells,
+    // which keep their order and so their ids
+    if (!cells.empty() && element->nfunctions() > cells.front().size()) {
+      cells = mesh_->extended_cell_connectivity(element, cells);
+      if (cells.empty())
+        throw std::runtime_error(
+            "mpm::base::init_mesh(): Extension of node stencils failed");
+    }
+
+    // Create cells from file
+    bool cell_status =
+        mesh_->create_cells(gid,                // global id
+                            element,            // element tyep
+                            cells,              // Node ids
+                            check_duplicates);  // Check dups
+
+    if (!cell_status)
+      throw std::runtime_error(
+          "mpm::base::init_mesh(): Addition of cells to mesh failed");
+  }
 
   // Compute cell neighbours
   mesh_->find_cell_neighbours();
 
   // Read and assign cell sets
-  this->cell_entity_sets(mesh_props, check_duplicates);
+  this->cell_entity_sets(mesh_props);
 
   auto cells_end = std::chrono::steady_clock::now();
   console_->info("Rank {} Read cells: {} ms", mpi_rank,
@@ -286,11 +436,6 @@ void mpm::MPMBase<Tdim>::initialise_particles() {
   // Get Mesh reader from JSON object
   const std::string io_type = mesh_props["io_type"].template get<std::string>();
 
-  // Check duplicates default set to true
-  bool check_duplicates = true;
-  if (mesh_props.find("check_duplicates") != mesh_props.end())
-    check_duplicates = mesh_props["check_duplicates"].template get<bool>();
-
   auto particles_gen_begin = std::chrono::steady_clock::now();
 
   // Get particles properties
@@ -326,10 +471,12 @@ void mpm::MPMBase<Tdim>::initialise_particles() {
     throw std::runtime_error(
         "mpm::base::init_particles() Particle outside the mesh domain");
 
-  // Write particles and cells to file
-  particle_io->write_particles_cells(
-      io_->output_file("particles-cells", ".txt", uuid_, 0, 0).string(),
-      mesh_->particles_cells());
+  // Write particles and cells to file, which has all particles only if the
+  // mesh is not partitioned
+  if (!mesh_->is_partitioned())
+    particle_io->write_particles_cells(
+        io_->output_file("particles-cells", ".txt", uuid_, 0, 0).string(),
+        mesh_->particles_cells());
 
   auto particles_locate_end = std::chrono::steady_clock::now();
   console_->info("Rank {} Locate particles: {} ms", mpi_rank,
@@ -355,7 +502,7 @@ void mpm::MPMBase<Tdim>::initialise_particles() {
                      .count());
 
   // Particle entity sets
-  this->particle_entity_sets(check_duplicates);
+  this->particle_entity_sets();
 
   // Read and assign particles velocity constraints
   this->particle_velocity_constraints();
@@ -442,26 +589,47 @@ bool mpm::MPMBase<Tdim>::checkpoint_resume() {
     // Get step
     this->step_ = analysis_["resume"]["step"].template get<mpm::Index>();
 
-    // Input particle h5 file for resume
-    std::string attribute = "particles";
-    std::string extension = ".h5";
-
-    auto particles_file =
-        io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
-            .string();
-
-    // Load particle information from file
-    mesh_->read_particles_hdf5(phase, particles_file);
-
-    // Clear all particle ids
-    mesh_->iterate_over_cells(
-        std::bind(&mpm::Cell<Tdim>::clear_particle_ids, std::placeholders::_1));
-
-    // Locate particles
-    auto unlocatable_particles = mesh_->locate_particles_mesh();
+    // Checkpoint of the rank at the step, or else HDF5 particles. If they
+    // cannot be read by every rank, checkpoints of earlier steps are read
+    std::vector<mpm::Index> steps(1, step_);
+    if (checkpoint_steps_ > 0 && step_ > 0)
+      for (mpm::Index i = (step_ - 1) / checkpoint_steps_ + 1; i-- > 0;)
+        steps.emplace_back(i * checkpoint_steps_);
+
+    bool resumed = false;
+    for (const auto step : steps) {
+      // Clear all particle ids
+      mesh_->iterate_over_cells(std::bind(&mpm::Cell<Tdim>::clear_particle_ids,
+                                          std::placeholders::_1));
+
+      bool status = true;
+      try {
+        this->read_checkpoint(phase, step, step == step_);
+      } catch (std::exception& exception) {
+        console_->warn("{} #{}: Rank {} unable to resume at step {}: {}",
+                       __FILE__, __LINE__, mpi_rank, step, exception.what());
+        status = false;
+      }
+#ifdef USE_MPI
+      MPI_Allreduce(MPI_IN_PLACE, &status, 1, MPI_C_BOOL, MPI_LAND,
+                    MPI_COMM_WORLD);
+#endif
+      if (status) {
+        this->step_ = step;
+        resumed = true;
+        break;
+      }
 
-    if (!unlocatable_particles.empty())
-      throw std::runtime_error("Particle outside the mesh domain");
+      // Remove particles read by the rank before trying an earlier step
+      std::vector<mpm::Index> pids;
+      mesh_->iterate_over_particles(
+          [&pids](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+#pragma omp critical
+            pids.emplace_back(particle->id());
+          });
+      mesh_->remove_particles(pids);
+    }
+    if (!resumed) throw std::runtime_error("No checkpoint could be read");
 
     // Increament step
     ++this->step_;
@@ -477,6 +645,38 @@ bool mpm::MPMBase<Tdim>::checkpoint_resume() {
   return checkpoint;
 }
 
+//! Read particles of the rank from the checkpoint of a step
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::read_checkpoint(unsigned phase, mpm::Index step,
+                                         bool particles) {
+  const std::string extension = ".h5";
+  auto checkpoint_file =
+      io_->output_file("checkpoint", extension, uuid_, step, this->nsteps_);
+
+  if (boost::filesystem::exists(checkpoint_file)) {
+    // Load particles attached to their cells
+    mesh_->read_checkpoint_hdf5(phase, checkpoint_file.string());
+  } else if (particles) {
+    // Input particle h5 file for resume
+    std::string attribute = "particles";
+    auto particles_file =
+        io_->output_file(attribute, extension, uuid_, step, this->nsteps_,
+                         !hdf5_shared_file_)
+            .string();
+
+    // Load particle information from file
+    if (!mesh_->read_particles_hdf5(phase, particles_file))
+      throw std::runtime_error("HDF5 particles could not be read");
+
+    // Locate particles
+    auto unlocatable_particles = mesh_->locate_particles_mesh();
+
+    if (!unlocatable_particles.empty())
+      throw std::runtime_error("Particle outside the mesh domain");
+  } else
+    throw std::runtime_error("Checkpoint is not found");
+}
+
 //! Write HDF5 files
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
@@ -485,34 +685,71 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
   std::string extension = ".h5";
 
   auto particles_file =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
+      io_->output_file(attribute, extension, uuid_, step, max_steps,
+                       !hdf5_shared_file_)
+          .string();
+
+  int mpi_size = 1;
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
 
-  const unsigned phase = 0;
-  mesh_->write_particles_hdf5(phase, particles_file);
+  const auto layout = hdf5_layout_;
+  const bool shared = hdf5_shared_file_;
+
+  // A file shared by many ranks is written collectively by the solver thread,
+  // after the snapshots before it
+  if (shared && mpi_size > 1) {
+    output_->flush();
+    try {
+      mpm::hdf5::write_particles(particles_file, mesh_->particles_hdf5(),
+                                 layout, shared);
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    }
+    return;
+  }
+
+  output_->submit([&]() -> mpm::OutputPipeline::Task {
+    auto particles = mesh_->particles_hdf5();
+    return [particles_file, layout, shared,
+            particles = std::move(particles)]() {
+      mpm::hdf5::write_particles(particles_file, particles, layout, shared);
+    };
+  });
+}
+
+//! Write a checkpoint of particles
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_checkpoint(mpm::Index step,
+                                          mpm::Index max_steps) {
+  // Checkpoint of particles of the rank
+  auto checkpoint_file =
+      io_->output_file("checkpoint", ".h5", uuid_, step, max_steps).string();
+  const unsigned compression = checkpoint_compression_;
+
+  // Written to a temporary file, which is renamed once complete, so that a
+  // checkpoint interrupted while being written is never read on resume
+  output_->submit([&]() -> mpm::OutputPipeline::Task {
+    auto particles = mesh_->particles_hdf5();
+    auto xi = mesh_->particles_reference_locations();
+    auto deformation_gradients = mesh_->particles_deformation_gradients();
+    return [checkpoint_file, compression, particles = std::move(particles),
+            xi = std::move(xi),
+            deformation_gradients = std::move(deformation_gradients)]() {
+      const std::string temporary_file = checkpoint_file + ".tmp";
+      mpm::hdf5::write_checkpoint(temporary_file, particles, xi,
+                                  deformation_gradients, compression);
+      boost::filesystem::rename(temporary_file, checkpoint_file);
+    };
+  });
 }
 
 #ifdef USE_VTK
 //! Write VTK files
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
-
-  // VTK PolyData writer
-  auto vtk_writer = std::make_unique<VtkWriter>(mesh_->particle_coordinates());
-
-  // Write mesh on step 0
-  // Get active node pairs use true
-  if (step % nload_balance_steps_ == 0)
-    vtk_writer->write_mesh(
-        io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string(),
-        mesh_->nodal_coordinates(), mesh_->node_pairs(true));
-
-  // Write input geometry to vtk file
-  const std::string extension = ".vtp";
-  const std::string attribute = "geometry";
-  auto meshfile =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  vtk_writer->write_geometry(meshfile);
-
   // MPI parallel vtk file
   int mpi_rank = 0;
   int mpi_size = 1;
@@ -525,95 +762,172 @@ void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
 #endif
 
-  //! VTK scalar variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar)) {
-    // Write scalar
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_scalar_point_data(
-        file, mesh_->particles_scalar_data(attribute), attribute);
-
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps);
+  // Fields with their own output steps, or those of VTK outputs, due at step
+  auto due = [&](const std::string& attribute) {
+    const auto steps = vtk_field_steps_.find(attribute);
+    return this->is_output_step(
+        step, (steps != vtk_field_steps_.end()) ? steps->second
+                                                : vtk_output_steps_);
+  };
+  bool fields_due = false;
+  for (const auto& vars : vtk_vars_)
+    for (const auto& attribute : vars.second) fields_due |= due(attribute);
+  for (const auto& vtk_statevar : vtk_statevars_)
+    for (const auto& attribute : vtk_statevar.second)
+      fields_due |=
+          due("phase" + std::to_string(vtk_statevar.first) + attribute);
+  if (!fields_due && !this->is_output_step(step, vtk_output_steps_)) return;
+
+  // Snapshot of the files and data, written by a VTK PolyData writer of the
+  // particle coordinates on the writer thread
+  output_->submit([&]() -> mpm::OutputPipeline::Task {
+    std::vector<std::function<void(VtkWriter*)>> writes;
+
+    // Sampled particles
+    std::vector<std::size_t> sample;
+    if (subsample_)
+      sample = mesh_->particles_sample(subsample_stride_, subsample_min_,
+                                       subsample_max_);
+    const auto* psample = subsample_ ? &sample : nullptr;
+
+    // Write mesh on step 0
+    // Get active node pairs use true
+    if (step % nload_balance_steps_ == 0) {
+      auto file =
+          io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string();
+      writes.emplace_back(
+          [file, coordinates = mesh_->nodal_coordinates(),
+           node_pairs = mesh_->node_pairs(true)](VtkWriter* vtk_writer) {
+            vtk_writer->write_mesh(file, coordinates, node_pairs);
+          });
     }
-#endif
-  }
 
-  //! VTK vector variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_vector_point_data(
-        file, mesh_->particles_vector_data(attribute), attribute);
-
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps);
+    //! VTK scalar variables and state variables
+    std::vector<std::pair<std::string, std::vector<double>>> scalars;
+    for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar))
+      if (due(attribute))
+        scalars.emplace_back(attribute,
+                             mesh_->particles_scalar_data(attribute, psample));
+    for (auto const& vtk_statevar : vtk_statevars_) {
+      unsigned phase_id = vtk_statevar.first;
+      for (const auto& attribute : vtk_statevar.second) {
+        const std::string name =
+            "phase" + std::to_string(phase_id) + attribute;
+        if (due(name))
+          scalars.emplace_back(name, mesh_->particles_statevars_data(
+                                         attribute, phase_id, psample));
+      }
     }
-#endif
-  }
-
-  //! VTK tensor variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_tensor_point_data(
-        file, mesh_->template particles_tensor_data<6>(attribute), attribute);
 
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
+    //! VTK vector variables
+    std::vector<std::pair<std::string, std::vector<Eigen::Vector3d>>> vectors;
+    for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector))
+      if (due(attribute))
+        vectors.emplace_back(attribute,
+                             mesh_->particles_vector_data(attribute, psample));
+
+    //! VTK tensor variables
+    std::vector<
+        std::pair<std::string, std::vector<Eigen::Matrix<double, 6, 1>>>>
+        tensors;
+    for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor))
+      if (due(attribute))
+        tensors.emplace_back(attribute,
+                             mesh_->template particles_tensor_data<6>(
+                                 attribute, psample));
+
+    // Names and number of components of fields in parallel MPI VTK container
+    // files
+    std::vector<std::pair<std::string, unsigned>> fields;
+    for (const auto& scalar : scalars) fields.emplace_back(scalar.first, 1);
+    for (const auto& vector : vectors) fields.emplace_back(vector.first, 3);
+    for (const auto& tensor : tensors) fields.emplace_back(tensor.first, 9);
+    const bool write_parallel = (mpi_rank == 0 && mpi_size > 1);
+    const std::string extension = ".vtp";
+
+    if (vtk_single_file_) {
+      // Write geometry and all variables to a file
+      const std::string attribute = "particles";
+      auto file = io_->output_file(attribute, extension, uuid_, step, max_steps)
+                      .string();
       auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
                                             max_steps, write_mpi_rank)
                                .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps, 9);
-    }
-#endif
-  }
-
-  // VTK state variables
-  for (auto const& vtk_statevar : vtk_statevars_) {
-    unsigned phase_id = vtk_statevar.first;
-    for (const auto& attribute : vtk_statevar.second) {
-      std::string phase_attribute =
-          "phase" + std::to_string(phase_id) + attribute;
-      // Write state variables
-      auto file =
-          io_->output_file(phase_attribute, extension, uuid_, step, max_steps)
+      writes.emplace_back([=, compressor = vtk_compressor_,
+                           scalars = std::move(scalars),
+                           vectors = std::move(vectors),
+                           tensors = std::move(tensors),
+                           fields = std::move(fields)](VtkWriter* vtk_writer) {
+        vtk_writer->write_point_data(file, scalars, vectors, tensors,
+                                     compressor);
+        // Write a parallel MPI VTK container file
+        if (write_parallel)
+          vtk_writer->write_parallel_vtk(parallel_file, attribute, fields,
+                                         mpi_size, step, max_steps);
+      });
+    } else {
+      // Write input geometry to vtk file
+      auto meshfile =
+          io_->output_file("geometry", extension, uuid_, step, max_steps)
               .string();
-      vtk_writer->write_scalar_point_data(
-          file, mesh_->particles_statevars_data(attribute, phase_id),
-          phase_attribute);
-      // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-      if (mpi_rank == 0 && mpi_size > 1) {
-        auto parallel_file = io_->output_file(phase_attribute, ".pvtp", uuid_,
-                                              step, max_steps, write_mpi_rank)
-                                 .string();
-        unsigned ncomponents = 1;
-        vtk_writer->write_parallel_vtk(parallel_file, phase_attribute, mpi_size,
-                                       step, max_steps, ncomponents);
+      writes.emplace_back([meshfile](VtkWriter* vtk_writer) {
+        vtk_writer->write_geometry(meshfile);
+      });
+
+      // Write a file of each variable
+      for (auto& scalar : scalars) {
+        auto file =
+            io_->output_file(scalar.first, extension, uuid_, step, max_steps)
+                .string();
+        writes.emplace_back(
+            [file, scalar = std::move(scalar)](VtkWriter* vtk_writer) {
+              vtk_writer->write_scalar_point_data(file, scalar.second,
+                                                  scalar.first);
+            });
+      }
+      for (auto& vector : vectors) {
+        auto file =
+            io_->output_file(vector.first, extension, uuid_, step, max_steps)
+                .string();
+        writes.emplace_back(
+            [file, vector = std::move(vector)](VtkWriter* vtk_writer) {
+              vtk_writer->write_vector_point_data(file, vector.second,
+                                                  vector.first);
+            });
+      }
+      for (auto& tensor : tensors) {
+        auto file =
+            io_->output_file(tensor.first, extension, uuid_, step, max_steps)
+                .string();
+        writes.emplace_back(
+            [file, tensor = std::move(tensor)](VtkWriter* vtk_writer) {
+              vtk_writer->write_tensor_point_data(file, tensor.second,
+                                                  tensor.first);
+            });
+      }
+
+      // Write a parallel MPI VTK container file of each variable
+      if (write_parallel) {
+        for (const auto& field : fields) {
+          auto parallel_file = io_->output_file(field.first, ".pvtp", uuid_,
+                                                step, max_steps, write_mpi_rank)
+                                   .string();
+          writes.emplace_back([=](VtkWriter* vtk_writer) {
+            vtk_writer->write_parallel_vtk(parallel_file, field.first,
+                                           mpi_size, step, max_steps,
+                                           field.second);
+          });
+        }
       }
-#endif
     }
-  }
+
+    return [coordinates = mesh_->particle_coordinates(psample),
+            writes = std::move(writes)]() {
+      // VTK PolyData writer
+      auto vtk_writer = std::make_unique<VtkWriter>(coordinates);
+      for (const auto& write : writes) write(vtk_writer.get());
+    };
+  });
 }
 #endif
 
@@ -621,25 +935,23 @@ void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
 //! Write Partio files
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_partio(mpm::Index step, mpm::Index max_steps) {
-
-  // MPI parallel partio file
-  int mpi_rank = 0;
-  int mpi_size = 1;
-#ifdef USE_MPI
-  // Get MPI rank
-  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  // Get number of MPI ranks
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-#endif
-
   // Get Partio file extensions
   const std::string extension = ".bgeo";
   const std::string attribute = "partio";
   // Create filename
   auto file =
       io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  // Write partio file
-  mpm::partio::write_particles(file, mesh_->particles_hdf5());
+  // Write partio file of sampled particles
+  output_->submit([&]() -> mpm::OutputPipeline::Task {
+    std::vector<std::size_t> sample;
+    if (subsample_)
+      sample = mesh_->particles_sample(subsample_stride_, subsample_min_,
+                                       subsample_max_);
+    return [file, particles = mesh_->particles_hdf5(subsample_ ? &sample
+                                                               : nullptr)]() {
+      mpm::partio::write_particles(file, particles);
+    };
+  });
 }
 #endif  // USE_PARTIO
 
@@ -786,16 +1098,14 @@ bool mpm::MPMBase<Tdim>::initialise_math_functions(const Json& math_functions) {
 
 //! Node entity sets
 template <unsigned Tdim>
-void mpm::MPMBase<Tdim>::node_entity_sets(const Json& mesh_props,
-                                          bool check_duplicates) {
+void mpm::MPMBase<Tdim>::node_entity_sets(const Json& mesh_props) {
   try {
     if (mesh_props.find("entity_sets") != mesh_props.end()) {
       std::string entity_sets =
           mesh_props["entity_sets"].template get<std::string>();
       if (!io_->file_name(entity_sets).empty()) {
-        bool node_sets = mesh_->create_node_sets(
-            (io_->entity_sets(io_->file_name(entity_sets), "node_sets")),
-            check_duplicates);
+        bool node_sets = mesh_->create_node_sets(mpm::entity_sets::read(
+            io_->file_name(entity_sets), "node_sets"));
         if (!node_sets)
           throw std::runtime_error("Node sets are not properly assigned");
       }
@@ -939,17 +1249,15 @@ void mpm::MPMBase<Tdim>::nodal_frictional_constraints(
 
 //! Cell entity sets
 template <unsigned Tdim>
-void mpm::MPMBase<Tdim>::cell_entity_sets(const Json& mesh_props,
-                                          bool check_duplicates) {
+void mpm::MPMBase<Tdim>::cell_entity_sets(const Json& mesh_props) {
   try {
     if (mesh_props.find("entity_sets") != mesh_props.end()) {
       // Read and assign cell sets
       std::string entity_sets =
           mesh_props["entity_sets"].template get<std::string>();
       if (!io_->file_name(entity_sets).empty()) {
-        bool cell_sets = mesh_->create_cell_sets(
-            (io_->entity_sets(io_->file_name(entity_sets), "cell_sets")),
-            check_duplicates);
+        bool cell_sets = mesh_->create_cell_sets(mpm::entity_sets::read(
+            io_->file_name(entity_sets), "cell_sets"));
         if (!cell_sets)
           throw std::runtime_error("Cell sets are not properly assigned");
       }
@@ -1086,7 +1394,7 @@ void mpm::MPMBase<Tdim>::particles_stresses(
 
 //! Particle entity sets
 template <unsigned Tdim>
-void mpm::MPMBase<Tdim>::particle_entity_sets(bool check_duplicates) {
+void mpm::MPMBase<Tdim>::particle_entity_sets() {
   // Get mesh properties
   auto mesh_props = io_->json_object("mesh");
   // Read and assign particle sets
@@ -1096,8 +1404,8 @@ void mpm::MPMBase<Tdim>::particle_entity_sets(bool check_duplicates) {
           mesh_props["entity_sets"].template get<std::string>();
       if (!io_->file_name(entity_sets).empty()) {
         bool particle_sets = mesh_->create_particle_sets(
-            (io_->entity_sets(io_->file_name(entity_sets), "particle_sets")),
-            check_duplicates);
+            mpm::entity_sets::read(io_->file_name(entity_sets),
+                                   "particle_sets"));
 
         if (!particle_sets)
           throw std::runtime_error("Particle set creation failed");
@@ -1147,7 +1455,16 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
   // Get number of MPI ranks
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
 
-  if (mpi_size > 1 && mesh_->ncells() > 1) {
+  // A partitioned mesh only has the cells of the rank and its ghost layer,
+  // so it keeps its initial partition
+  if (mesh_->is_partitioned()) {
+    if (initial_step) {
+      // Identify shared nodes across MPI domains
+      mesh_->find_domain_shared_nodes();
+      // Identify ghost boundary cells
+      mesh_->find_ghost_boundary_cells();
+    }
+  } else if (mpi_size > 1 && mesh_->ncells() > 1) {
 
     // Initialize MPI
     MPI_Comm comm;
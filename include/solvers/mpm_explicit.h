@@ -75,6 +75,14 @@ class MPMExplicit : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::damping_factor_;
   //! Locate particles
   using mpm::MPMBase<Tdim>::locate_particles_;
+  //! Output pipeline
+  using mpm::MPMBase<Tdim>::output_;
+  //! Steps between checkpoints
+  using mpm::MPMBase<Tdim>::checkpoint_steps_;
+  //! Steps between HDF5 outputs
+  using mpm::MPMBase<Tdim>::hdf5_output_steps_;
+  //! Steps between Partio outputs
+  using mpm::MPMBase<Tdim>::partio_output_steps_;
 
  private:
   //! Pressure smoothing
@@ -10,6 +10,11 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(const std::shared_ptr<IO>& io)
   else
     mpm_scheme_ = std::make_shared<mpm::MPMSchemeUSF<Tdim>>(mesh_, dt_);
 
+  //! Reuse shape functions of particles that have not moved
+  if (analysis_.find("shapefn_tolerance") != analysis_.end())
+    mpm_scheme_->assign_shapefn_tolerance(
+        analysis_["shapefn_tolerance"].template get<double>());
+
   //! Interface scheme
   if (this->interface_)
     contact_ = std::make_shared<mpm::ContactFriction<Tdim>>(mesh_);
@@ -31,9 +36,8 @@ void mpm::MPMExplicit<Tdim>::compute_stress_strain(unsigned phase) {
   // Pressure smoothing
   if (pressure_smoothing_) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  // Compute stresses of particles in batches of each material
+  mesh_->compute_particle_stresses();
 }
 
 //! MPM Explicit solver
@@ -102,7 +106,7 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 
   //! Particle entity sets and velocity constraints
   if (resume) {
-    this->particle_entity_sets(false);
+    this->particle_entity_sets();
     this->particle_velocity_constraints();
   }
 
@@ -156,25 +160,43 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     mpm_scheme_->locate_particles(this->locate_particles_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
+    // Transfer particles in ghost cells to their ranks, with graph
+    // partitioning or on a partitioned mesh
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
 
-    if (step_ % output_steps_ == 0) {
-      // HDF5 outputs
+    // HDF5 outputs
+    if (this->is_output_step(step_, hdf5_output_steps_))
       this->write_hdf5(this->step_, this->nsteps_);
 #ifdef USE_VTK
-      // VTK outputs
-      this->write_vtk(this->step_, this->nsteps_);
+    // VTK outputs of geometry and variables due at the step
+    this->write_vtk(this->step_, this->nsteps_);
 #endif
 #ifdef USE_PARTIO
-      // Partio outputs
+    // Partio outputs
+    if (this->is_output_step(step_, partio_output_steps_))
       this->write_partio(this->step_, this->nsteps_);
 #endif
+
+    if (step_ % output_steps_ == 0) {
+      // Constitutive iteration statistics
+      for (const auto& material : materials_)
+        material.second->log_iteration_statistics();
+      // Shape function statistics
+      mpm_scheme_->log_shapefn_statistics();
     }
+
+    // Checkpoint of particles for resume
+    if (this->is_output_step(step_, checkpoint_steps_))
+      this->write_checkpoint(this->step_, this->nsteps_);
   }
+  // Wait for the outputs of the last steps
+  output_->flush();
+  if (output_->nstalls() > 0)
+    console_->info("Rank {}, solver waited for {} output snapshots", mpi_rank,
+                   output_->nstalls());
+
   auto solver_end = std::chrono::steady_clock::now();
   console_->info("Rank {}, Explicit {} solver duration: {} ms", mpi_rank,
                  mpm_scheme_->scheme(),
@@ -5,6 +5,8 @@
 #include "graph.h"
 #endif
 
+#include <atomic>
+
 #include "mesh.h"
 
 namespace mpm {
@@ -21,6 +23,29 @@ class MPMScheme {
   //! Intialize
   virtual inline void initialise();
 
+  //! Assign the tolerance to reuse shape functions of particles
+  //! \details Shape functions of a particle are recomputed only if it moved
+  //! to another cell or its local coordinates changed more than the
+  //! tolerance. A tolerance of zero recomputes them every step
+  //! \param[in] tolerance Tolerance on the change in local coordinates
+  void assign_shapefn_tolerance(double tolerance) {
+    shapefn_tolerance_ = tolerance;
+  }
+
+  //! Return the tolerance to reuse shape functions of particles
+  double shapefn_tolerance() const { return shapefn_tolerance_; }
+
+  //! Number of shape function evaluations of particles
+  unsigned long long nshapefn() const { return nshapefn_.load(); }
+
+  //! Number of shape function evaluations skipped
+  unsigned long long nshapefn_skipped() const {
+    return nshapefn_skipped_.load();
+  }
+
+  //! Write shape function statistics to the log and reset the counters
+  void log_shapefn_statistics();
+
   //! Compute nodal kinematics - map mass and momentum to nodes
   //! \param[in] phase Phase to smooth pressure
   virtual inline void compute_nodal_kinematics(unsigned phase);
@@ -84,6 +109,14 @@ class MPMScheme {
   int mpi_size_ = 1;
   //! MPI rank
   int mpi_rank_ = 0;
+  //! Tolerance on local coordinates to reuse shape functions
+  double shapefn_tolerance_{0.};
+  //! Number of shape function evaluations
+  std::atomic<unsigned long long> nshapefn_{0};
+  //! Number of shape function evaluations skipped
+  std::atomic<unsigned long long> nshapefn_skipped_{0};
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
 };  // MPMScheme class
 }  // namespace mpm
 
@@ -12,6 +12,9 @@ mpm::MPMScheme<Tdim>::MPMScheme(const std::shared_ptr<mpm::Mesh<Tdim>>& mesh,
   // Get number of MPI ranks
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size_);
 #endif
+  //! Logger
+  std::string logger = "MPMScheme" + std::to_string(Tdim) + "D";
+  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 }
 
 //! Initialize nodes, cells and shape functions
@@ -32,13 +35,35 @@ inline void mpm::MPMScheme<Tdim>::initialise() {
     // Spawn a task for particles
 #pragma omp section
     {
-      // Iterate over each particle to compute shapefn
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
+      if (shapefn_tolerance_ > 0.) {
+        // Iterate over each particle to compute shapefn of moved particles
+        mesh_->iterate_over_particles(
+            [this](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+              nshapefn_.fetch_add(1, std::memory_order_relaxed);
+              if (!particle->update_shapefn(shapefn_tolerance_))
+                nshapefn_skipped_.fetch_add(1, std::memory_order_relaxed);
+            });
+      } else {
+        // Iterate over each particle to compute shapefn
+        mesh_->iterate_over_particles(std::bind(
+            &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
+      }
     }
   }  // Wait to complete
 }
 
+//! Write shape function statistics to the log and reset the counters
+template <unsigned Tdim>
+void mpm::MPMScheme<Tdim>::log_shapefn_statistics() {
+  const unsigned long long nshapefn = nshapefn_.exchange(0);
+  const unsigned long long nskipped = nshapefn_skipped_.exchange(0);
+  if (nshapefn == 0) return;
+  console_->info(
+      "Rank {}, shape functions: {} particle updates, {} skipped ({:.2f}%)",
+      mpi_rank_, nshapefn, nskipped,
+      100. * static_cast<double>(nskipped) / static_cast<double>(nshapefn));
+}
+
 //! Compute nodal kinematics - map mass and momentum to nodes
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(unsigned phase) {
@@ -85,9 +110,8 @@ inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
   // Pressure smoothing
   if (pressure_smoothing) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  // Compute stresses of particles in batches of each material
+  mesh_->compute_particle_stresses();
 }
 
 //! Pressure smoothing
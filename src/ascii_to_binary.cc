@@ -0,0 +1,36 @@
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "io_mesh_binary.h"
+
+//! Convert an ascii mesh or particle file to the binary format
+//! Usage: mpm_ascii_to_binary <dimension> <type> <ascii file> <binary file>
+//! where type is one of mesh, particles, particles_stresses, euler_angles,
+//! particles_volumes, particles_cells, velocity_constraints,
+//! friction_constraints, forces or entity_sets. Entity sets are converted
+//! from a JSON file of node, particle and cell sets, and need a dimension.
+int main(int argc, char** argv) {
+  if (argc != 5) {
+    std::cerr << "Usage: " << argv[0]
+              << " <dimension> <type> <ascii file> <binary file>\n";
+    return 1;
+  }
+
+  bool status = false;
+  try {
+    const std::string dimension(argv[1]);
+    const auto type = mpm::binary::file_type(argv[2]);
+    if (dimension == "2")
+      status = std::make_unique<mpm::IOMeshBinary<2>>()->convert_ascii(
+          type, argv[3], argv[4]);
+    else if (dimension == "3")
+      status = std::make_unique<mpm::IOMeshBinary<3>>()->convert_ascii(
+          type, argv[3], argv[4]);
+    else
+      throw std::runtime_error("Invalid dimension: " + dimension);
+  } catch (std::exception& exception) {
+    std::cerr << "MPM ascii to binary: " << exception.what() << std::endl;
+  }
+  return status ? 0 : 1;
+}
@@ -1,7 +1,11 @@
 #include "element.h"
 #include "factory.h"
+#include "hexahedron_bspline_element.h"
+#include "hexahedron_cpdi_element.h"
 #include "hexahedron_element.h"
 #include "hexahedron_gimp_element.h"
+#include "quadrilateral_bspline_element.h"
+#include "quadrilateral_cpdi_element.h"
 #include "quadrilateral_element.h"
 #include "quadrilateral_gimp_element.h"
 #include "triangle_element.h"
@@ -28,6 +32,18 @@ static Register<mpm::Element<2>, mpm::QuadrilateralElement<2, 9>> quad9(
 static Register<mpm::Element<2>, mpm::QuadrilateralGIMPElement<2, 16>>
     quad_gimp16("ED2Q16G");
 
+// Quadrilateral 4-node-base quadratic B-spline element
+static Register<mpm::Element<2>, mpm::QuadrilateralBSplineElement<2, 2>>
+    quad_bspline2("ED2Q16B2");
+
+// Quadrilateral 4-node-base cubic B-spline element
+static Register<mpm::Element<2>, mpm::QuadrilateralBSplineElement<2, 3>>
+    quad_bspline3("ED2Q16B3");
+
+// Quadrilateral 4-node-base CPDI element
+static Register<mpm::Element<2>, mpm::QuadrilateralCPDIElement<2, 16>>
+    quad_cpdi16("ED2Q16C");
+
 // Hexahedron 8-noded element
 static Register<mpm::Element<3>, mpm::HexahedronElement<3, 8>> hex8("ED3H8");
 
@@ -37,3 +53,15 @@ static Register<mpm::Element<3>, mpm::HexahedronElement<3, 20>> hex20("ED3H20");
 // Quadrilateral 4-node-base GIMP element
 static Register<mpm::Element<3>, mpm::HexahedronGIMPElement<3, 64>> hex_gimp64(
     "ED3H64G");
+
+// Hexahedron 8-node-base quadratic B-spline element
+static Register<mpm::Element<3>, mpm::HexahedronBSplineElement<3, 2>>
+    hex_bspline2("ED3H64B2");
+
+// Hexahedron 8-node-base cubic B-spline element
+static Register<mpm::Element<3>, mpm::HexahedronBSplineElement<3, 3>>
+    hex_bspline3("ED3H64B3");
+
+// Hexahedron 8-node-base CPDI element
+static Register<mpm::Element<3>, mpm::HexahedronCPDIElement<3, 64>> hex_cpdi64(
+    "ED3H64C");
@@ -0,0 +1,301 @@
+#include "entity_sets.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "json.hpp"
+
+#include "io_mesh_binary.h"
+
+using Json = nlohmann::json;
+
+namespace {
+
+//! Types of sets in binary files, at their index
+const std::vector<std::string> sets_types = {"node_sets", "particle_sets",
+                                             "cell_sets"};
+
+//! Return the index of a type of sets in binary files
+std::uint64_t sets_type_index(const std::string& sets_type) {
+  const auto itr = std::find(sets_types.begin(), sets_types.end(), sets_type);
+  if (itr == sets_types.end())
+    throw std::runtime_error("Invalid type of entity sets: " + sets_type);
+  return itr - sets_types.begin();
+}
+
+//! SetsReader class
+//! \brief Reads sets of one or all types from a stream of JSON events
+//! \details Only the set being read is held, with its ids run-length encoded
+//! into ranges as they are read, in the order of the file
+class SetsReader : public Json::json_sax_t {
+ public:
+  //! Constructor
+  //! \param[in] sets_type Type of sets to read, all if empty
+  explicit SetsReader(const std::string& sets_type) : sets_type_{sets_type} {}
+
+  //! Return sets read by type of sets
+  std::map<std::string, mpm::entity_sets::Sets>& sets() { return sets_; }
+
+  bool null() override { return true; }
+
+  bool boolean(bool) override { return true; }
+
+  bool number_integer(number_integer_t value) override {
+    if (value < 0) throw std::runtime_error("Negative id in entity sets");
+    return this->number(static_cast<mpm::Index>(value));
+  }
+
+  bool number_unsigned(number_unsigned_t value) override {
+    return this->number(static_cast<mpm::Index>(value));
+  }
+
+  bool number_float(number_float_t, const string_t&) override {
+    if (in_set_ && (key_ == "id" || key_ == "set" || key_ == "ranges"))
+      throw std::runtime_error("Non-integer id in entity sets");
+    return true;
+  }
+
+  bool string(string_t&) override { return true; }
+
+  bool start_object(std::size_t) override {
+    ++depth_;
+    // A set in the array of a type of sets
+    if (depth_ == 3 && !type_.empty()) {
+      in_set_ = true;
+      id_set_ = false;
+      ranges_.clear();
+      range_.clear();
+    }
+    return true;
+  }
+
+  bool key(string_t& key) override {
+    if (depth_ == 1)
+      type_ = (sets_type_.empty() || key == sets_type_) ? key : "";
+    else if (depth_ == 3)
+      key_ = key;
+    return true;
+  }
+
+  bool end_object() override {
+    if (depth_ == 3 && in_set_) {
+      if (!id_set_) throw std::runtime_error("Entity set without an id");
+      sets_[type_].insert(
+          std::make_pair(id_, mpm::RangeSet(std::move(ranges_))));
+      ranges_ = std::vector<mpm::RangeSet::Range>();
+      in_set_ = false;
+    }
+    --depth_;
+    return true;
+  }
+
+  bool start_array(std::size_t) override {
+    ++depth_;
+    return true;
+  }
+
+  bool end_array() override {
+    // A [first id, number of ids] pair of ranges
+    if (in_set_ && depth_ == 5 && key_ == "ranges") {
+      if (range_.size() != 2)
+        throw std::runtime_error("Range of entity set is not a pair");
+      this->add(range_[0], range_[1]);
+      range_.clear();
+    }
+    --depth_;
+    return true;
+  }
+
+  bool parse_error(std::size_t position, const std::string&,
+                   const nlohmann::detail::exception& exception) override {
+    throw std::runtime_error("Invalid entity sets JSON at byte " +
+                             std::to_string(position) + ": " +
+                             exception.what());
+  }
+
+ private:
+  //! Add an id, an id of an entity or a value of a range of a set
+  bool number(mpm::Index value) {
+    if (!in_set_) return true;
+    if (depth_ == 3 && key_ == "id") {
+      id_ = value;
+      id_set_ = true;
+    } else if (depth_ == 4 && key_ == "set")
+      this->add(value, 1);
+    else if (depth_ == 5 && key_ == "ranges")
+      range_.emplace_back(value);
+    return true;
+  }
+
+  //! Add a range of ids to the set, extending the last one it follows
+  void add(mpm::Index first, mpm::Index count) {
+    if (!ranges_.empty() &&
+        ranges_.back().first + ranges_.back().count == first)
+      ranges_.back().count += count;
+    else
+      ranges_.emplace_back(mpm::RangeSet::Range{first, count});
+  }
+
+  //! Type of sets to read, all if empty
+  std::string sets_type_;
+  //! Sets read by type of sets
+  std::map<std::string, mpm::entity_sets::Sets> sets_;
+  //! Number of open objects and arrays
+  unsigned depth_{0};
+  //! Type of sets being read, empty if they are skipped
+  std::string type_;
+  //! Key of the value being read in a set
+  std::string key_;
+  //! Reading a set
+  bool in_set_{false};
+  //! Id of the set being read
+  mpm::Index id_{0};
+  //! Id of the set is read
+  bool id_set_{false};
+  //! Ranges of ids of the set being read
+  std::vector<mpm::RangeSet::Range> ranges_;
+  //! Values of the range being read
+  std::vector<mpm::Index> range_;
+};
+
+//! Return if a file is an MPM binary file
+bool is_binary(const std::string& filename) {
+  char magic[sizeof(mpm::binary::magic)] = {0};
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Unable to open entity sets file: " + filename);
+  file.read(magic, sizeof(magic));
+  return file.gcount() == sizeof(magic) &&
+         std::memcmp(magic, mpm::binary::magic, sizeof(magic)) == 0;
+}
+
+//! Read sets of a type from a binary file
+mpm::entity_sets::Sets read_binary(const std::string& filename,
+                                   const std::string& sets_type) {
+  if (!mpm::binary::little_endian())
+    throw std::runtime_error("Binary files require a little-endian host");
+
+  mpm::MappedFile file(filename);
+  mpm::binary::Header header;
+  if (file.size() < sizeof(header))
+    throw std::runtime_error("Binary file is shorter than its header");
+  std::memcpy(&header, file.data(), sizeof(header));
+  if (header.version != mpm::binary::version)
+    throw std::runtime_error("Unsupported binary file version " +
+                             std::to_string(header.version));
+  if (header.type !=
+      static_cast<std::uint32_t>(mpm::binary::FileType::EntitySets))
+    throw std::runtime_error("Unexpected type of binary file");
+
+  // Arrays of the file
+  std::size_t offset = sizeof(header);
+  auto read_array = [&](std::size_t size) {
+    // Sizes come from the file, check them before multiplying
+    if (size > (file.size() - offset) / sizeof(std::uint64_t))
+      throw std::runtime_error("Binary file is truncated");
+    std::vector<std::uint64_t> array(size);
+    std::memcpy(array.data(), file.data() + offset,
+                size * sizeof(std::uint64_t));
+    offset += size * sizeof(std::uint64_t);
+    return array;
+  };
+  const std::size_t nsets = header.nrecords;
+  if (nsets >= file.size())
+    throw std::runtime_error("Binary file is truncated");
+  const auto types = read_array(nsets);
+  const auto ids = read_array(nsets);
+  const auto offsets = read_array(nsets + 1);
+  const std::size_t nranges = offsets.back();
+  const auto firsts = read_array(nranges);
+  const auto counts = read_array(nranges);
+
+  mpm::entity_sets::Sets sets;
+  const std::uint64_t type = sets_type_index(sets_type);
+  for (std::size_t i = 0; i < nsets; ++i) {
+    if (types[i] != type) continue;
+    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > nranges)
+      throw std::runtime_error("Invalid ranges of entity set");
+    std::vector<mpm::RangeSet::Range> ranges;
+    ranges.reserve(offsets[i + 1] - offsets[i]);
+    for (std::size_t r = offsets[i]; r < offsets[i + 1]; ++r)
+      ranges.emplace_back(mpm::RangeSet::Range{firsts[r], counts[r]});
+    sets.insert(std::make_pair(ids[i], mpm::RangeSet(std::move(ranges))));
+  }
+  return sets;
+}
+
+//! Read sets of a type, or all types if empty, from a JSON file
+std::map<std::string, mpm::entity_sets::Sets> read_json(
+    const std::string& filename, const std::string& sets_type) {
+  std::ifstream file(filename);
+  if (!file.is_open())
+    throw std::runtime_error("Unable to open entity sets file: " + filename);
+  SetsReader reader(sets_type);
+  Json::sax_parse(file, &reader);
+  return std::move(reader.sets());
+}
+
+}  // namespace
+
+//! Read sets of a type from a JSON or a binary file
+mpm::entity_sets::Sets mpm::entity_sets::read(const std::string& filename,
+                                              const std::string& sets_type) {
+  // Check the type of sets
+  sets_type_index(sets_type);
+  if (is_binary(filename)) return read_binary(filename, sets_type);
+  return std::move(read_json(filename, sets_type)[sets_type]);
+}
+
+//! Write sets of all types to a binary file
+void mpm::entity_sets::write_binary(const std::string& filename,
+                                    const std::map<std::string, Sets>& sets) {
+  if (!mpm::binary::little_endian())
+    throw std::runtime_error("Binary files require a little-endian host");
+
+  std::vector<std::uint64_t> types, ids, offsets(1, 0), firsts, counts;
+  for (const auto& type_sets : sets) {
+    const std::uint64_t type = sets_type_index(type_sets.first);
+    // Sets in ascending order of ids
+    std::map<mpm::Index, const mpm::RangeSet*> ordered;
+    for (const auto& set : type_sets.second)
+      ordered.emplace(set.first, &set.second);
+    for (const auto& set : ordered) {
+      types.emplace_back(type);
+      ids.emplace_back(set.first);
+      for (const auto& range : set.second->ranges()) {
+        firsts.emplace_back(range.first);
+        counts.emplace_back(range.count);
+      }
+      offsets.emplace_back(firsts.size());
+    }
+  }
+
+  mpm::binary::Header header;
+  std::memcpy(header.magic, mpm::binary::magic, sizeof(header.magic));
+  header.version = mpm::binary::version;
+  header.type = static_cast<std::uint32_t>(mpm::binary::FileType::EntitySets);
+  header.dimension = 0;
+  header.reserved = 0;
+  header.nrecords = ids.size();
+  header.ncells = 0;
+
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Unable to open binary file: " + filename);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (const auto* array : {&types, &ids, &offsets, &firsts, &counts})
+    file.write(reinterpret_cast<const char*>(array->data()),
+               array->size() * sizeof(std::uint64_t));
+  if (!file.good())
+    throw std::runtime_error("Unable to write binary file: " + filename);
+}
+
+//! Convert a JSON entity sets file to a binary file
+void mpm::entity_sets::convert_json(const std::string& json_file,
+                                    const std::string& binary_file) {
+  mpm::entity_sets::write_binary(binary_file, read_json(json_file, ""));
+}
@@ -0,0 +1,428 @@
+#include "hdf5_writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+#ifdef USE_MPI
+#include "mpi.h"
+#endif
+
+namespace {
+
+//! Compound type of a particle record
+hid_t particle_type() {
+  hid_t type = H5Tcreate(H5T_COMPOUND, mpm::hdf5::particle::dst_size);
+  for (hsize_t i = 0; i < mpm::hdf5::particle::NFIELDS; ++i)
+    H5Tinsert(type, mpm::hdf5::particle::field_names[i],
+              mpm::hdf5::particle::dst_offset[i],
+              mpm::hdf5::particle::field_type[i]);
+  return type;
+}
+
+//! Create a 1D dataset and write count elements of it from offset
+//! \details Ranks writing collectively call it with all datasets, and with
+//! no elements if they have none
+void write_dataset(hid_t file, const char* name, hid_t type, const void* data,
+                   hsize_t offset, hsize_t count, hsize_t size, hid_t xfer,
+                   hid_t dcpl = H5P_DEFAULT) {
+  // Buffer of ranks without elements
+  static const char empty = 0;
+
+  hid_t filespace = H5Screate_simple(1, &size, nullptr);
+  hid_t dataset = H5Dcreate2(file, name, type, filespace, H5P_DEFAULT, dcpl,
+                             H5P_DEFAULT);
+  hid_t memspace = H5Screate_simple(1, &count, nullptr);
+  if (count > 0)
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &offset, nullptr, &count,
+                        nullptr);
+  else {
+    H5Sselect_none(filespace);
+    H5Sselect_none(memspace);
+  }
+  const herr_t status =
+      (dataset < 0) ? -1
+                    : H5Dwrite(dataset, type, memspace, filespace, xfer,
+                               (count > 0) ? data : &empty);
+  H5Sclose(memspace);
+  if (dataset >= 0) H5Dclose(dataset);
+  H5Sclose(filespace);
+  if (status < 0)
+    throw std::runtime_error("Unable to write HDF5 dataset: " +
+                             std::string(name));
+}
+
+//! Write the particles of a rank from offset in datasets of size particles
+void write_datasets(hid_t file,
+                    const std::vector<mpm::HDF5Particle>& particles,
+                    mpm::hdf5::Layout layout, hsize_t offset, hsize_t size,
+                    hid_t xfer, hid_t dcpl = H5P_DEFAULT) {
+  using namespace mpm::hdf5::particle;
+  if (layout == mpm::hdf5::Layout::Table && particles.size() == size) {
+    // Whole table, chunked as a HDF5 table
+    const hsize_t chunk_size = 10000;
+    if (H5TBmake_table("Table Title", file, "table", NFIELDS, size, dst_size,
+                       field_names, dst_offset, field_type, chunk_size,
+                       nullptr, 0, particles.data()) < 0)
+      throw std::runtime_error("Unable to write HDF5 table");
+  } else if (layout == mpm::hdf5::Layout::Table) {
+    hid_t type = particle_type();
+    try {
+      write_dataset(file, "table", type, particles.data(), offset,
+                    particles.size(), size, xfer);
+    } catch (std::exception& exception) {
+      H5Tclose(type);
+      throw;
+    }
+    H5Tclose(type);
+  } else {
+    // Contiguous values of each field
+    std::vector<char> column;
+    for (hsize_t i = 0; i < NFIELDS; ++i) {
+      column.resize(particles.size() * dst_sizes[i]);
+#pragma omp parallel for schedule(static)
+      for (std::size_t p = 0; p < particles.size(); ++p)
+        std::memcpy(&column[p * dst_sizes[i]],
+                    reinterpret_cast<const char*>(&particles[p]) +
+                        dst_offset[i],
+                    dst_sizes[i]);
+      write_dataset(file, field_names[i], field_type[i], column.data(),
+                    offset, particles.size(), size, xfer, dcpl);
+    }
+  }
+}
+
+//! Creation properties of 1D datasets of size elements, which are chunked,
+//! byte shuffled and deflated at a compression level from 1 to 9
+//! \details Shuffling groups the bytes of equal significance of the values
+//! of a chunk, which deflate compresses losslessly
+hid_t compressed_dataset(hsize_t size, unsigned compression) {
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if (compression > 0 && size > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+    const hsize_t chunk_size = std::min<hsize_t>(size, 65536);
+    H5Pset_chunk(dcpl, 1, &chunk_size);
+    H5Pset_shuffle(dcpl);
+    H5Pset_deflate(dcpl, std::min(compression, 9u));
+  }
+  return dcpl;
+}
+
+//! Create a HDF5 file, opened by all ranks with parallel HDF5
+hid_t create_file(const std::string& filename, bool parallel) {
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+#if defined(USE_MPI) && defined(H5_HAVE_PARALLEL)
+  if (parallel) H5Pset_fapl_mpio(fapl, MPI_COMM_WORLD, MPI_INFO_NULL);
+#endif
+  hid_t file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  H5Pclose(fapl);
+  if (file < 0)
+    throw std::runtime_error("Unable to create HDF5 file: " + filename);
+  return file;
+}
+
+//! Names of the datasets of components of deformation gradients
+const char* F_names[3][3] = {{"F_xx", "F_xy", "F_xz"},
+                             {"F_yx", "F_yy", "F_yz"},
+                             {"F_zx", "F_zy", "F_zz"}};
+
+//! Number of elements of a 1D dataset
+hsize_t dataset_size(hid_t file, const char* name) {
+  hid_t dataset = H5Dopen2(file, name, H5P_DEFAULT);
+  if (dataset < 0)
+    throw std::runtime_error("HDF5 dataset is not found: " +
+                             std::string(name));
+  hid_t space = H5Dget_space(dataset);
+  hsize_t size = 0;
+  if (H5Sget_simple_extent_ndims(space) == 1)
+    H5Sget_simple_extent_dims(space, &size, nullptr);
+  H5Sclose(space);
+  H5Dclose(dataset);
+  return size;
+}
+
+//! Read count elements of a 1D dataset from offset
+void read_dataset(hid_t file, const char* name, hid_t type, void* data,
+                  hsize_t offset, hsize_t count) {
+  hid_t dataset = H5Dopen2(file, name, H5P_DEFAULT);
+  if (dataset < 0)
+    throw std::runtime_error("HDF5 dataset is not found: " +
+                             std::string(name));
+  hid_t filespace = H5Dget_space(dataset);
+  hid_t memspace = H5Screate_simple(1, &count, nullptr);
+  H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &offset, nullptr, &count,
+                      nullptr);
+  const herr_t status =
+      H5Dread(dataset, type, memspace, filespace, H5P_DEFAULT, data);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(dataset);
+  if (status < 0)
+    throw std::runtime_error("Unable to read HDF5 dataset: " +
+                             std::string(name));
+}
+
+}  // namespace
+
+//! Return the layout of particles from its name
+mpm::hdf5::Layout mpm::hdf5::layout(const std::string& name) {
+  if (name == "table") return Layout::Table;
+  if (name == "columns") return Layout::Columns;
+  throw std::runtime_error("Invalid HDF5 layout: " + name);
+}
+
+//! Write particles to a HDF5 file
+void mpm::hdf5::write_particles(const std::string& filename,
+                                const std::vector<mpm::HDF5Particle>& particles,
+                                Layout layout, bool shared) {
+  int mpi_rank = 0;
+  int mpi_size = 1;
+#ifdef USE_MPI
+  if (shared) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  }
+#endif
+
+  // Offsets of the particles of each rank
+  std::vector<unsigned long long> offsets(mpi_size + 1, 0);
+  offsets[mpi_rank + 1] = particles.size();
+#ifdef USE_MPI
+  if (mpi_size > 1)
+    MPI_Allgather(&offsets[mpi_rank + 1], 1, MPI_UNSIGNED_LONG_LONG,
+                  &offsets[1], 1, MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+#endif
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const hsize_t noffsets = offsets.size();
+
+  if (mpi_size == 1) {
+    hid_t file = create_file(filename, false);
+    try {
+      write_datasets(file, particles, layout, 0, particles.size(),
+                     H5P_DEFAULT);
+      if (shared)
+        write_dataset(file, "offsets", H5T_NATIVE_ULLONG, offsets.data(), 0,
+                      noffsets, noffsets, H5P_DEFAULT);
+    } catch (std::exception& exception) {
+      H5Fclose(file);
+      throw;
+    }
+    H5Fclose(file);
+    return;
+  }
+
+#ifdef USE_MPI
+#ifdef H5_HAVE_PARALLEL
+  // Ranks write their hyperslabs of the shared file collectively
+  hid_t file = create_file(filename, true);
+  hid_t xfer = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(xfer, H5FD_MPIO_COLLECTIVE);
+  write_datasets(file, particles, layout, offsets[mpi_rank], offsets.back(),
+                 xfer);
+  write_dataset(file, "offsets", H5T_NATIVE_ULLONG, offsets.data(), 0,
+                (mpi_rank == 0) ? noffsets : 0, noffsets, xfer);
+  H5Pclose(xfer);
+  H5Fclose(file);
+#else
+  // Rank 0 gathers the particles of all ranks and writes the file
+  MPI_Datatype mpi_particle;
+  MPI_Type_contiguous(sizeof(mpm::HDF5Particle), MPI_BYTE, &mpi_particle);
+  MPI_Type_commit(&mpi_particle);
+  std::vector<int> counts(mpi_size), displacements(mpi_size);
+  for (int i = 0; i < mpi_size; ++i) {
+    counts[i] = offsets[i + 1] - offsets[i];
+    displacements[i] = offsets[i];
+  }
+  std::vector<mpm::HDF5Particle> all_particles(
+      (mpi_rank == 0) ? offsets.back() : 0);
+  MPI_Gatherv(particles.data(), particles.size(), mpi_particle,
+              all_particles.data(), counts.data(), displacements.data(),
+              mpi_particle, 0, MPI_COMM_WORLD);
+  MPI_Type_free(&mpi_particle);
+
+  if (mpi_rank == 0) {
+    hid_t file = create_file(filename, false);
+    try {
+      write_datasets(file, all_particles, layout, 0, all_particles.size(),
+                     H5P_DEFAULT);
+      write_dataset(file, "offsets", H5T_NATIVE_ULLONG, offsets.data(), 0,
+                    noffsets, noffsets, H5P_DEFAULT);
+    } catch (std::exception& exception) {
+      H5Fclose(file);
+      throw;
+    }
+    H5Fclose(file);
+  }
+#endif
+#endif
+}
+
+//! Read particles from a HDF5 file
+std::vector<mpm::HDF5Particle> mpm::hdf5::read_particles(
+    const std::string& filename) {
+  using namespace mpm::hdf5::particle;
+  hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0) throw std::runtime_error("HDF5 particle file is not found");
+
+  std::vector<mpm::HDF5Particle> particles;
+  try {
+    const bool table = H5Lexists(file, "table", H5P_DEFAULT) > 0;
+    hsize_t offset = 0;
+    hsize_t count = dataset_size(file, table ? "table" : field_names[0]);
+
+    // Particles of the rank in a file shared by as many ranks
+    if (H5Lexists(file, "offsets", H5P_DEFAULT) > 0) {
+      int mpi_rank = 0;
+      int mpi_size = 1;
+#ifdef USE_MPI
+      MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+      MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+#endif
+      std::vector<unsigned long long> offsets(dataset_size(file, "offsets"));
+      read_dataset(file, "offsets", H5T_NATIVE_ULLONG, offsets.data(), 0,
+                   offsets.size());
+      if (offsets.size() == static_cast<std::size_t>(mpi_size + 1)) {
+        offset = offsets[mpi_rank];
+        count = offsets[mpi_rank + 1] - offsets[mpi_rank];
+      }
+    }
+
+    particles.resize(count);
+    if (count == 0) {
+      H5Fclose(file);
+      return particles;
+    }
+
+    if (table) {
+      hid_t dataset = H5Dopen2(file, "table", H5P_DEFAULT);
+      hid_t file_type = H5Dget_type(dataset);
+      const int nmembers = H5Tget_nmembers(file_type);
+      H5Tclose(file_type);
+      H5Dclose(dataset);
+      if (nmembers != static_cast<int>(NFIELDS))
+        throw std::runtime_error("HDF5 table has incorrect number of fields");
+
+      hid_t type = particle_type();
+      try {
+        read_dataset(file, "table", type, particles.data(), offset, count);
+      } catch (std::exception& exception) {
+        H5Tclose(type);
+        throw;
+      }
+      H5Tclose(type);
+    } else {
+      std::vector<char> column;
+      for (hsize_t i = 0; i < NFIELDS; ++i) {
+        column.resize(count * dst_sizes[i]);
+        read_dataset(file, field_names[i], field_type[i], column.data(),
+                     offset, count);
+#pragma omp parallel for schedule(static)
+        for (std::size_t p = 0; p < count; ++p)
+          std::memcpy(reinterpret_cast<char*>(&particles[p]) + dst_offset[i],
+                      &column[p * dst_sizes[i]], dst_sizes[i]);
+      }
+    }
+  } catch (std::exception& exception) {
+    H5Fclose(file);
+    throw;
+  }
+  H5Fclose(file);
+  return particles;
+}
+
+//! Write a checkpoint of particles to a HDF5 file
+void mpm::hdf5::write_checkpoint(
+    const std::string& filename,
+    const std::vector<mpm::HDF5Particle>& particles,
+    const std::vector<Eigen::Matrix<double, 3, 1>>& xi,
+    const std::vector<Eigen::Matrix<double, 3, 3>>& deformation_gradients,
+    unsigned compression) {
+  if (xi.size() != particles.size())
+    throw std::runtime_error(
+        "Reference locations do not match particles of checkpoint");
+  if (deformation_gradients.size() != particles.size())
+    throw std::runtime_error(
+        "Deformation gradients do not match particles of checkpoint");
+
+  const hsize_t size = particles.size();
+  hid_t file = create_file(filename, false);
+  hid_t dcpl = compressed_dataset(size, compression);
+  try {
+    write_datasets(file, particles, Layout::Columns, 0, size, H5P_DEFAULT,
+                   dcpl);
+
+    // Reference locations of particles in their cells
+    const char* xi_names[3] = {"xi_x", "xi_y", "xi_z"};
+    std::vector<double> column(size);
+    for (unsigned i = 0; i < 3; ++i) {
+#pragma omp parallel for schedule(static)
+      for (std::size_t p = 0; p < size; ++p) column[p] = xi[p](i);
+      write_dataset(file, xi_names[i], H5T_NATIVE_DOUBLE, column.data(), 0,
+                    size, size, H5P_DEFAULT, dcpl);
+    }
+
+    // Deformation gradients of particle domains
+    for (unsigned i = 0; i < 3; ++i)
+      for (unsigned j = 0; j < 3; ++j) {
+#pragma omp parallel for schedule(static)
+        for (std::size_t p = 0; p < size; ++p)
+          column[p] = deformation_gradients[p](i, j);
+        write_dataset(file, F_names[i][j], H5T_NATIVE_DOUBLE, column.data(), 0,
+                      size, size, H5P_DEFAULT, dcpl);
+      }
+  } catch (std::exception& exception) {
+    H5Pclose(dcpl);
+    H5Fclose(file);
+    throw;
+  }
+  H5Pclose(dcpl);
+  H5Fclose(file);
+}
+
+//! Read a checkpoint of particles from a HDF5 file
+std::vector<mpm::HDF5Particle> mpm::hdf5::read_checkpoint(
+    const std::string& filename, std::vector<Eigen::Matrix<double, 3, 1>>* xi,
+    std::vector<Eigen::Matrix<double, 3, 3>>* deformation_gradients) {
+  auto particles = mpm::hdf5::read_particles(filename);
+  const hsize_t size = particles.size();
+
+  hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0) throw std::runtime_error("HDF5 checkpoint file is not found");
+  try {
+    xi->resize(size);
+    const char* xi_names[3] = {"xi_x", "xi_y", "xi_z"};
+    std::vector<double> column(size);
+    for (unsigned i = 0; i < 3; ++i) {
+      if (dataset_size(file, xi_names[i]) != size)
+        throw std::runtime_error(
+            "HDF5 checkpoint has incorrect number of reference locations");
+      if (size > 0)
+        read_dataset(file, xi_names[i], H5T_NATIVE_DOUBLE, column.data(), 0,
+                     size);
+#pragma omp parallel for schedule(static)
+      for (std::size_t p = 0; p < size; ++p) (*xi)[p](i) = column[p];
+    }
+
+    // Deformation gradients, undeformed in checkpoints without them
+    deformation_gradients->assign(size,
+                                  Eigen::Matrix<double, 3, 3>::Identity());
+    for (unsigned i = 0; i < 3; ++i)
+      for (unsigned j = 0; j < 3; ++j) {
+        if (H5Lexists(file, F_names[i][j], H5P_DEFAULT) <= 0) continue;
+        if (dataset_size(file, F_names[i][j]) != size)
+          throw std::runtime_error(
+              "HDF5 checkpoint has incorrect number of deformation gradients");
+        if (size > 0)
+          read_dataset(file, F_names[i][j], H5T_NATIVE_DOUBLE, column.data(),
+                       0, size);
+#pragma omp parallel for schedule(static)
+        for (std::size_t p = 0; p < size; ++p)
+          (*deformation_gradients)[p](i, j) = column[p];
+      }
+  } catch (std::exception& exception) {
+    H5Fclose(file);
+    throw;
+  }
+  H5Fclose(file);
+  return particles;
+}
@@ -12,6 +12,10 @@ const std::shared_ptr<spdlog::logger> mpm::Logger::io_mesh_logger =
 const std::shared_ptr<spdlog::logger> mpm::Logger::io_mesh_ascii_logger =
     spdlog::stdout_color_st("IOMeshAscii");
 
+// Create a logger for reading binary mesh
+const std::shared_ptr<spdlog::logger> mpm::Logger::io_mesh_binary_logger =
+    spdlog::stdout_color_st("IOMeshBinary");
+
 // Create a logger for point generator
 const std::shared_ptr<spdlog::logger> mpm::Logger::point_generator_logger =
     spdlog::stdout_color_st("PointGenerator");
@@ -35,3 +39,7 @@ const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usf_logger =
 // Create a logger for MPM Explicit USL
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usl_logger =
     spdlog::stdout_color_st("MPMExplicitUSL");
+
+// Create a logger for output pipeline
+const std::shared_ptr<spdlog::logger> mpm::Logger::output_pipeline_logger =
+    spdlog::stdout_color_mt("OutputPipeline");
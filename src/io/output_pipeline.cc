@@ -0,0 +1,104 @@
+#include "output_pipeline.h"
+
+//! Constructor
+mpm::OutputPipeline::OutputPipeline(unsigned nbuffers) : nbuffers_{nbuffers} {
+  console_ = mpm::Logger::output_pipeline_logger;
+  if (nbuffers_ > 0) thread_ = std::thread(&mpm::OutputPipeline::run, this);
+}
+
+//! Destructor
+mpm::OutputPipeline::~OutputPipeline() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_queued_.notify_all();
+  if (thread_.joinable()) thread_.join();
+}
+
+//! Stage a snapshot on a free buffer and queue its write
+void mpm::OutputPipeline::submit(const std::function<Task()>& stage) {
+  // Write on staging without buffers
+  if (nbuffers_ == 0) {
+    try {
+      this->write(stage());
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    }
+    return;
+  }
+
+  // Wait for a free buffer
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (nstaged_ >= nbuffers_) {
+      ++nstalls_;
+      task_written_.wait(lock, [&]() { return nstaged_ < nbuffers_; });
+    }
+    ++nstaged_;
+  }
+
+  // Snapshot on the calling thread
+  Task task;
+  try {
+    task = stage();
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nstaged_;
+    }
+    task_written_.notify_all();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.emplace_back(std::move(task));
+  }
+  task_queued_.notify_one();
+}
+
+//! Wait for all queued snapshots to be written
+void mpm::OutputPipeline::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  task_written_.wait(lock, [&]() { return nstaged_ == 0; });
+}
+
+//! Number of times staging waited for the writer thread
+std::size_t mpm::OutputPipeline::nstalls() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return nstalls_;
+}
+
+//! Write queued tasks until stopped
+void mpm::OutputPipeline::run() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_queued_.wait(lock, [&]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) return;
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    this->write(task);
+
+    // Free the buffer of the snapshot
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nstaged_;
+    }
+    task_written_.notify_all();
+  }
+}
+
+//! Run a task and log its errors
+void mpm::OutputPipeline::write(const Task& task) const {
+  try {
+    if (task) task();
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  }
+}
@@ -168,6 +168,99 @@ void VtkWriter::write_scalar_point_data(const std::string& filename,
   writer->Write();
 }
 
+//! Write all point data to a file, appended as raw binary
+void VtkWriter::write_point_data(
+    const std::string& filename,
+    const std::vector<std::pair<std::string, std::vector<double>>>& scalars,
+    const std::vector<std::pair<std::string, std::vector<Eigen::Vector3d>>>&
+        vectors,
+    const std::vector<
+        std::pair<std::string, std::vector<Eigen::Matrix<double, 6, 1>>>>&
+        tensors,
+    const std::string& compressor) {
+
+  // Create a polydata to store everything in it
+  auto pdata = vtkSmartPointer<vtkPolyData>::New();
+
+  // Add the points to the dataset
+  pdata->SetPoints(points_);
+  const vtkIdType npoints = pdata->GetNumberOfPoints();
+
+  // Scalar and vector fields refer to the data without copying, which the
+  // writer only reads
+  static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+                "Vectors are not contiguous");
+  for (const auto& scalar : scalars) {
+    if (static_cast<vtkIdType>(scalar.second.size()) != npoints)
+      throw std::runtime_error("Invalid size of VTK scalar data");
+    auto scalardata = vtkSmartPointer<vtkDoubleArray>::New();
+    scalardata->SetNumberOfComponents(1);
+    scalardata->SetArray(const_cast<double*>(scalar.second.data()), npoints,
+                         1);
+    scalardata->SetName(scalar.first.c_str());
+    pdata->GetPointData()->AddArray(scalardata);
+  }
+
+  // Vector fields
+  for (const auto& vector : vectors) {
+    if (static_cast<vtkIdType>(vector.second.size()) != npoints)
+      throw std::runtime_error("Invalid size of VTK vector data");
+    auto vectordata = vtkSmartPointer<vtkDoubleArray>::New();
+    vectordata->SetNumberOfComponents(3);
+    vectordata->SetArray(const_cast<double*>(vector.second.data()->data()),
+                         3 * npoints, 1);
+    vectordata->SetName(vector.first.c_str());
+    pdata->GetPointData()->AddArray(vectordata);
+  }
+
+  // Tensor fields, as full symmetric tensors
+  for (const auto& tensor : tensors) {
+    auto tensordata = vtkSmartPointer<vtkDoubleArray>::New();
+    tensordata->SetNumberOfComponents(9);
+    tensordata->SetNumberOfTuples(npoints);
+    tensordata->SetName(tensor.first.c_str());
+    for (vtkIdType id = 0; id < npoints; ++id) {
+      const double* vdata = tensor.second.at(id).data();
+      tensordata->SetTuple9(id, vdata[0], vdata[3], vdata[5], vdata[3],
+                            vdata[1], vdata[4], vdata[5], vdata[4], vdata[2]);
+    }
+    pdata->GetPointData()->AddArray(tensordata);
+  }
+
+  // First field of each type is the active attribute
+  if (!scalars.empty())
+    pdata->GetPointData()->SetActiveScalars(scalars.front().first.c_str());
+  if (!vectors.empty())
+    pdata->GetPointData()->SetActiveVectors(vectors.front().first.c_str());
+  if (!tensors.empty())
+    pdata->GetPointData()->SetActiveTensors(tensors.front().first.c_str());
+
+  // Write file
+  auto writer = vtkSmartPointer<vtkXMLPolyDataWriter>::New();
+
+  writer->SetFileName(filename.c_str());
+
+  // Raw binary data appended after the XML header
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+
+#if VTK_MAJOR_VERSION <= 5
+  writer->SetInput(pdata);
+#else
+  writer->SetInputData(pdata);
+#endif
+
+  if (compressor == "none")
+    writer->SetCompressor(nullptr);
+#if VTK_MAJOR_VERSION > 8 || (VTK_MAJOR_VERSION == 8 && VTK_MINOR_VERSION >= 2)
+  else if (compressor == "lz4")
+    writer->SetCompressor(vtkSmartPointer<vtkLZ4DataCompressor>::New());
+#endif
+  else
+    writer->SetCompressor(vtkSmartPointer<vtkZLibDataCompressor>::New());
+  writer->Write();
+}
+
 //! VTK Write mesh
 void VtkWriter::write_mesh(
     const std::string& filename,
@@ -224,34 +317,53 @@ void VtkWriter::write_parallel_vtk(const std::string& filename,
                                    const std::string& attribute, int mpi_size,
                                    unsigned step, unsigned max_steps,
                                    unsigned ncomponents) {
+  this->write_parallel_vtk(filename, attribute, {{attribute, ncomponents}},
+                           mpi_size, step, max_steps);
+}
 
-  // If the number of components is 1, set as scalar or vector / tensor
-  std::string data_type;
-  switch (ncomponents) {
-    case 1:
-      data_type = "Scalars";
-      break;
-    case 9:
-      data_type = "Tensors";
-      break;
-    default:
-      data_type = "Vectors";
-      break;
+//! Write Parallel VTK file of many data fields
+void VtkWriter::write_parallel_vtk(
+    const std::string& filename, const std::string& attribute,
+    const std::vector<std::pair<std::string, unsigned>>& fields, int mpi_size,
+    unsigned step, unsigned max_steps) {
+
+  // If the number of components is 1, set as scalar or vector / tensor, the
+  // first field of each type being the active one
+  std::string attributes;
+  std::set<std::string> data_types;
+  for (const auto& field : fields) {
+    std::string data_type;
+    switch (field.second) {
+      case 1:
+        data_type = "Scalars";
+        break;
+      case 9:
+        data_type = "Tensors";
+        break;
+      default:
+        data_type = "Vectors";
+        break;
+    }
+    if (data_types.insert(data_type).second)
+      attributes += " " + data_type + "=\"" + field.first + "\"";
   }
 
   std::string ppolydata =
       "<?xml version=\"1.0\"?>\n<VTKFile type=\"PPolyData\" version=\"0.1\" "
       "byte_order=\"LittleEndian\" "
       "compressor=\"vtkZLibDataCompressor\">\n<PPolyData "
-      "GhostLevel=\"0\">\n\t<PPointData " +
-      data_type + "=\"" + attribute +
-      "\">\n\t\t<PDataArray "
-      "type=\"Float64\" Name=\"" +
-      attribute + "\"";
-  if (ncomponents != 1)
-    ppolydata += " NumberOfComponents=\"" + std::to_string(ncomponents) + "\"";
+      "GhostLevel=\"0\">\n\t<PPointData" +
+      attributes + ">";
+  for (const auto& field : fields) {
+    ppolydata += "\n\t\t<PDataArray type=\"Float64\" Name=\"" + field.first +
+                 "\"";
+    if (field.second != 1)
+      ppolydata +=
+          " NumberOfComponents=\"" + std::to_string(field.second) + "\"";
+    ppolydata += "/>";
+  }
   ppolydata +=
-      "/>\n\t</"
+      "\n\t</"
       "PPointData>\n\n\t<PPoints>\n\t\t<PDataArray "
       "type=\"Float32\" Name=\"Points\" "
       "NumberOfComponents=\"3\"/>\n\t</PPoints>\n";
@@ -0,0 +1,105 @@
+#include "range_set.h"
+
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+//! Construct a set of ids
+mpm::RangeSet::RangeSet(const std::vector<mpm::Index>& ids) {
+  // Run-length encode ids that follow each other
+  for (const auto id : ids) {
+    if (!ranges_.empty() &&
+        ranges_.back().first + ranges_.back().count == id)
+      ++ranges_.back().count;
+    else
+      ranges_.emplace_back(Range{id, 1});
+  }
+  this->merge();
+}
+
+//! Construct a set of ranges of ids
+mpm::RangeSet::RangeSet(std::vector<Range> ranges)
+    : ranges_{std::move(ranges)} {
+  this->merge();
+}
+
+//! Drop empty ranges and ids already in the set, and compute offsets
+void mpm::RangeSet::merge() {
+  // Ids in the set, as the end of disjoint ranges by their first id
+  std::map<mpm::Index, mpm::Index> covered;
+  std::vector<Range> ranges;
+  ranges.reserve(ranges_.size());
+  // Add a range after the last one, or extend it if it follows it
+  auto add = [&ranges](mpm::Index first, mpm::Index end) {
+    if (!ranges.empty() && ranges.back().first + ranges.back().count == first)
+      ranges.back().count += end - first;
+    else
+      ranges.emplace_back(Range{first, end - first});
+  };
+
+  for (const auto& range : ranges_) {
+    if (range.count == 0) continue;
+    if (range.count > std::numeric_limits<mpm::Index>::max() - range.first)
+      throw std::runtime_error("Range of ids overflows");
+    const mpm::Index begin = range.first;
+    const mpm::Index end = range.first + range.count;
+
+    // First range in the set that ends after the beginning
+    auto itr = covered.upper_bound(begin);
+    if (itr != covered.begin() && std::prev(itr)->second >= begin) --itr;
+
+    // Add ids between ranges in the set, and merge those ranges
+    mpm::Index cursor = begin;
+    mpm::Index merged_begin = begin, merged_end = end;
+    auto last = itr;
+    for (; last != covered.end() && last->first <= end; ++last) {
+      if (last->first > cursor) add(cursor, last->first);
+      cursor = std::max(cursor, last->second);
+      merged_begin = std::min(merged_begin, last->first);
+      merged_end = std::max(merged_end, last->second);
+    }
+    if (cursor < end) add(cursor, end);
+    covered.erase(itr, last);
+    covered.emplace(merged_begin, merged_end);
+  }
+  ranges.shrink_to_fit();
+  ranges_ = std::move(ranges);
+
+  sorted_.clear();
+  sorted_.reserve(covered.size());
+  for (const auto& range : covered)
+    sorted_.emplace_back(Range{range.first, range.second - range.first});
+
+  offsets_.assign(1, 0);
+  offsets_.reserve(ranges_.size() + 1);
+  for (const auto& range : ranges_)
+    offsets_.emplace_back(offsets_.back() + range.count);
+}
+
+//! Return if an id is in the set
+bool mpm::RangeSet::contains(mpm::Index id) const {
+  // First range after the id
+  const auto range = std::upper_bound(
+      sorted_.cbegin(), sorted_.cend(), id,
+      [](mpm::Index id, const Range& range) { return id < range.first; });
+  if (range == sorted_.cbegin()) return false;
+  const auto& previous = *(range - 1);
+  return id - previous.first < previous.count;
+}
+
+//! Return id at a position in the set
+mpm::Index mpm::RangeSet::operator[](std::size_t position) const {
+  const std::size_t range = this->range_index(position);
+  return ranges_[range].first + (position - offsets_[range]);
+}
+
+//! Return ids in input order
+std::vector<mpm::Index> mpm::RangeSet::ids() const {
+  std::vector<mpm::Index> ids;
+  ids.reserve(this->size());
+  this->for_each(0, this->size(), [&ids](mpm::Index id) {
+    ids.emplace_back(id);
+  });
+  return ids;
+}
@@ -0,0 +1,325 @@
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "cell.h"
+#include "element.h"
+#include "factory.h"
+#include "hexahedron_element.h"
+#include "material.h"
+#include "mesh.h"
+#include "mpm_scheme_usf.h"
+#include "node.h"
+#include "particle.h"
+#include "quadrilateral_element.h"
+#include "triangle_element.h"
+
+// Count heap allocations made by all threads, which include those of OpenMP
+// loops. Eigen and operator new both allocate through malloc, so interposing
+// the malloc family catches both. This replaces malloc for the whole
+// executable, so these tests are built on their own, in mpmtest_allocation.
+#if defined(__GLIBC__)
+#define MPM_COUNT_ALLOCATIONS
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t n, std::size_t size);
+extern "C" void* __libc_realloc(void* ptr, std::size_t size);
+
+namespace {
+//! Count allocations
+std::atomic<bool> count_allocations{false};
+//! Number of allocations
+std::atomic<std::size_t> nallocations{0};
+
+//! Count an allocation
+inline void count_allocation() {
+  if (count_allocations.load(std::memory_order_relaxed))
+    nallocations.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace
+
+extern "C" void* malloc(std::size_t size) {
+  count_allocation();
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(std::size_t n, std::size_t size) {
+  count_allocation();
+  return __libc_calloc(n, size);
+}
+
+extern "C" void* realloc(void* ptr, std::size_t size) {
+  count_allocation();
+  return __libc_realloc(ptr, size);
+}
+
+namespace {
+//! Return the number of heap allocations made by a function
+template <typename Tfunction>
+std::size_t allocations(Tfunction function) {
+  nallocations = 0;
+  count_allocations = true;
+  function();
+  count_allocations = false;
+  return nallocations;
+}
+}  // namespace
+#endif
+
+//! \brief Check element topology queries do not allocate
+TEST_CASE("Element topology queries are allocation free",
+          "[allocation][element]") {
+#ifdef MPM_COUNT_ALLOCATIONS
+  SECTION("Quadrilateral and triangle elements") {
+    for (const std::string type : {"ED2Q4", "ED2Q8", "ED2Q9", "ED2T3"}) {
+      std::shared_ptr<const mpm::Element<2>> element =
+          Factory<mpm::Element<2>>::instance()->create(type);
+
+      // First call initialises the topology tables
+      long nindices = element->corner_indices().size() +
+                      element->sides_indices().size() +
+                      element->inhedron_indices().size() +
+                      element->unit_cell_coordinates().size();
+      for (unsigned i = 0; i < element->nfaces(); ++i)
+        nindices += element->face_indices(i).size();
+
+      long count = 0;
+      REQUIRE(allocations([&]() {
+                count = element->corner_indices().size() +
+                        element->sides_indices().size() +
+                        element->inhedron_indices().size() +
+                        element->unit_cell_coordinates().size();
+                for (unsigned i = 0; i < element->nfaces(); ++i)
+                  count += element->face_indices(i).size();
+              }) == 0);
+      REQUIRE(count == nindices);
+    }
+  }
+
+  SECTION("Hexahedron elements") {
+    for (const std::string type : {"ED3H8", "ED3H20"}) {
+      std::shared_ptr<const mpm::Element<3>> element =
+          Factory<mpm::Element<3>>::instance()->create(type);
+
+      // First call initialises the topology tables
+      long nindices = element->corner_indices().size() +
+                      element->sides_indices().size() +
+                      element->inhedron_indices().size() +
+                      element->unit_cell_coordinates().size();
+      for (unsigned i = 0; i < element->nfaces(); ++i)
+        nindices += element->face_indices(i).size();
+
+      long count = 0;
+      REQUIRE(allocations([&]() {
+                count = element->corner_indices().size() +
+                        element->sides_indices().size() +
+                        element->inhedron_indices().size() +
+                        element->unit_cell_coordinates().size();
+                for (unsigned i = 0; i < element->nfaces(); ++i)
+                  count += element->face_indices(i).size();
+              }) == 0);
+      REQUIRE(count == nindices);
+    }
+  }
+#endif
+}
+
+//! \brief Check locating points in affine cells does not allocate
+TEST_CASE("Point location in affine cells is allocation free",
+          "[allocation][cell]") {
+#ifdef MPM_COUNT_ALLOCATIONS
+  SECTION("2D cells") {
+    const unsigned Dim = 2;
+    std::shared_ptr<mpm::Element<Dim>> element =
+        Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+
+    // Parallelogram cell
+    Eigen::Matrix<double, 4, Dim> coordinates;
+    // clang-format off
+    coordinates << 0., 0.,
+                   2., 0.,
+                   3., 1.,
+                   1., 1.;
+    // clang-format on
+
+    auto cell = std::make_shared<mpm::Cell<Dim>>(0, 4, element);
+    for (unsigned i = 0; i < 4; ++i) {
+      const Eigen::Matrix<double, Dim, 1> point = coordinates.row(i);
+      REQUIRE(cell->add_node(
+                  i, std::make_shared<mpm::Node<Dim, Dim, 1>>(i, point)) ==
+              true);
+    }
+    REQUIRE(cell->initialise() == true);
+    REQUIRE(cell->geometry() == mpm::CellGeometry::Affine);
+
+    Eigen::Matrix<double, Dim, 1> point;
+    point << 1.5, 0.25;
+    Eigen::Matrix<double, Dim, 1> xi;
+
+    bool status = false;
+    REQUIRE(allocations([&]() {
+              for (unsigned i = 0; i < 100; ++i)
+                status = cell->is_point_in_cell(point, &xi);
+            }) == 0);
+    REQUIRE(status == true);
+    REQUIRE(xi(0) == Approx(0.25).epsilon(1.E-7));
+    REQUIRE(xi(1) == Approx(-0.5).epsilon(1.E-7));
+  }
+
+  SECTION("3D cells") {
+    const unsigned Dim = 3;
+    std::shared_ptr<mpm::Element<Dim>> element =
+        Factory<mpm::Element<Dim>>::instance()->create("ED3H8");
+
+    // Cartesian cell
+    const Eigen::MatrixXd& unit_cell = element->unit_cell_coordinates();
+    auto cell = std::make_shared<mpm::Cell<Dim>>(0, 8, element);
+    for (unsigned i = 0; i < 8; ++i) {
+      const Eigen::Matrix<double, Dim, 1> point = unit_cell.row(i);
+      REQUIRE(cell->add_node(
+                  i, std::make_shared<mpm::Node<Dim, Dim, 1>>(i, point)) ==
+              true);
+    }
+    REQUIRE(cell->initialise() == true);
+    REQUIRE(cell->geometry() == mpm::CellGeometry::Cartesian);
+
+    Eigen::Matrix<double, Dim, 1> point;
+    point << 0.25, -0.5, 0.75;
+    Eigen::Matrix<double, Dim, 1> xi;
+
+    bool status = false;
+    REQUIRE(allocations([&]() {
+              for (unsigned i = 0; i < 100; ++i)
+                status = cell->is_point_in_cell(point, &xi);
+            }) == 0);
+    REQUIRE(status == true);
+    for (unsigned i = 0; i < Dim; ++i)
+      REQUIRE(xi(i) == Approx(point(i)).epsilon(1.E-7));
+  }
+#endif
+}
+
+//! \brief Check CPDI particle shape functions do not allocate
+TEST_CASE("CPDI particle shape functions are allocation free",
+          "[allocation][particle][cpdi]") {
+#ifdef MPM_COUNT_ALLOCATIONS
+  SECTION("2D particles") {
+    const unsigned Dim = 2;
+    std::shared_ptr<mpm::Element<Dim>> element =
+        Factory<mpm::Element<Dim>>::instance()->create("ED2Q16C");
+
+    // Uniform grid with a unit spacing around a cell centred at the origin
+    const Eigen::MatrixXd& natural_nodes = element->natural_nodal_coordinates();
+    auto cell = std::make_shared<mpm::Cell<Dim>>(0, 16, element);
+    for (unsigned i = 0; i < 16; ++i) {
+      const Eigen::Matrix<double, Dim, 1> point = 0.5 * natural_nodes.row(i);
+      REQUIRE(cell->add_node(
+                  i, std::make_shared<mpm::Node<Dim, Dim, 1>>(i, point)) ==
+              true);
+    }
+    REQUIRE(cell->initialise() == true);
+    REQUIRE(cell->geometry() == mpm::CellGeometry::Cartesian);
+
+    Eigen::Matrix<double, Dim, 1> coordinates;
+    coordinates << 0.1, -0.2;
+    auto particle = std::make_shared<mpm::Particle<Dim>>(0, coordinates);
+    REQUIRE(particle->assign_cell(cell) == true);
+    REQUIRE(particle->assign_volume(0.25) == true);
+
+    // First call sizes the shape functions and gradients
+    particle->compute_shapefn();
+    REQUIRE(allocations([&]() {
+              for (unsigned i = 0; i < 100; ++i) particle->compute_shapefn();
+            }) == 0);
+  }
+#endif
+}
+
+//! \brief Check a step of the explicit scheme does not allocate once the
+//! particles stay in their cells
+TEST_CASE("Steady-state step of the USF scheme is allocation free",
+          "[allocation][mesh][MPMScheme]") {
+#ifdef MPM_COUNT_ALLOCATIONS
+  const unsigned Dim = 2;
+
+  // Structured mesh of 4 x 4 unit cells
+  const unsigned ncells_dir = 4;
+  std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+  for (unsigned j = 0; j <= ncells_dir; ++j)
+    for (unsigned i = 0; i <= ncells_dir; ++i)
+      coordinates.emplace_back(Eigen::Matrix<double, Dim, 1>(i, j));
+  std::vector<std::vector<mpm::Index>> cells;
+  for (unsigned j = 0; j < ncells_dir; ++j)
+    for (unsigned i = 0; i < ncells_dir; ++i) {
+      const mpm::Index n0 = j * (ncells_dir + 1) + i;
+      cells.emplace_back(std::vector<mpm::Index>(
+          {n0, n0 + 1, n0 + ncells_dir + 2, n0 + ncells_dir + 1}));
+    }
+
+  auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+  std::shared_ptr<mpm::Element<Dim>> element =
+      Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+  REQUIRE(mesh->create_nodes(0, "N2D", coordinates) == true);
+  REQUIRE(mesh->create_cells(0, element, cells) == true);
+
+  // Linear elastic material
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>> materials;
+  materials[0] =
+      Factory<mpm::Material<Dim>, unsigned, const Json&>::instance()->create(
+          "LinearElastic2D", 0, jmaterial);
+  mesh->initialise_material_models(materials);
+
+  // Four particles in each of the central cells
+  std::vector<Eigen::Matrix<double, Dim, 1>> points;
+  for (unsigned j = 1; j < 3; ++j)
+    for (unsigned i = 1; i < 3; ++i)
+      for (double dy : {0.25, 0.75})
+        for (double dx : {0.25, 0.75})
+          points.emplace_back(Eigen::Matrix<double, Dim, 1>(i + dx, j + dy));
+  REQUIRE(mesh->create_particles("P2D", points, {0}, 0) == true);
+  REQUIRE(mesh->locate_particles_mesh().empty() == true);
+  mesh->iterate_over_particles(std::bind(
+      &mpm::ParticleBase<Dim>::compute_volume, std::placeholders::_1));
+  mesh->iterate_over_particles(std::bind(
+      &mpm::ParticleBase<Dim>::compute_mass, std::placeholders::_1));
+
+  auto scheme = std::make_shared<mpm::MPMSchemeUSF<Dim>>(mesh, 1.E-4);
+  const unsigned phase = 0;
+  const Eigen::Matrix<double, Dim, 1> gravity(0., -9.81);
+
+  // Phases of an explicit step
+  std::vector<std::size_t> nallocations(7, 0);
+  auto step = [&](unsigned nstep) {
+    nallocations[0] = allocations([&]() { scheme->initialise(); });
+    nallocations[1] =
+        allocations([&]() { scheme->compute_nodal_kinematics(phase); });
+    nallocations[2] = allocations(
+        [&]() { scheme->precompute_stress_strain(phase, false); });
+    nallocations[3] = allocations(
+        [&]() { scheme->compute_forces(gravity, phase, nstep, false); });
+    nallocations[4] = allocations([&]() {
+      scheme->compute_particle_kinematics(true, phase, "Cundall", 0.02);
+    });
+    nallocations[5] = allocations(
+        [&]() { scheme->postcompute_stress_strain(phase, false); });
+    nallocations[6] = allocations([&]() { scheme->locate_particles(true); });
+  };
+
+  // First steps size the nodal and particle storage and thread pools
+  for (unsigned i = 0; i < 2; ++i) step(i);
+
+  for (unsigned i = 2; i < 5; ++i) {
+    step(i);
+    REQUIRE(nallocations == std::vector<std::size_t>(7, 0));
+  }
+  // Particles stay in their cells
+  REQUIRE(mesh->nparticles() == points.size());
+#endif
+}
@@ -164,6 +164,94 @@ TEST_CASE("Cell is checked for 2D case", "[cell][2D]") {
       const auto side_indices = cell->side_node_pairs();
       REQUIRE(side_indices.size() == 4);
     }
+
+    // Check cached Jacobian and dN/dx of an affine cell
+    SECTION("Check affine cell Jacobian and dN/dx") {
+      REQUIRE(cell->affine() == true);
+      REQUIRE(cell->geometry() == mpm::CellGeometry::Cartesian);
+
+      // Jacobian of a 2 x 2 cell
+      const auto jacobian = cell->jacobian();
+      REQUIRE(jacobian(0, 0) == Approx(1.).epsilon(Tolerance));
+      REQUIRE(jacobian(0, 1) == Approx(0.).epsilon(Tolerance));
+      REQUIRE(jacobian(1, 0) == Approx(0.).epsilon(Tolerance));
+      REQUIRE(jacobian(1, 1) == Approx(1.).epsilon(Tolerance));
+
+      Eigen::Vector2d xi;
+      xi << 0.25, -0.5;
+      const Eigen::Vector2d zero = Eigen::Vector2d::Zero();
+      const Eigen::MatrixXd dn_dx = cell->dn_dx(xi, zero, zero);
+      const Eigen::MatrixXd element_dn_dx =
+          element->dn_dx(xi, cell->nodal_coordinates(), zero, zero);
+      REQUIRE(dn_dx.rows() == element_dn_dx.rows());
+      REQUIRE(dn_dx.cols() == element_dn_dx.cols());
+      for (unsigned i = 0; i < dn_dx.rows(); ++i)
+        for (unsigned j = 0; j < dn_dx.cols(); ++j)
+          REQUIRE(dn_dx(i, j) ==
+                  Approx(element_dn_dx(i, j)).epsilon(Tolerance));
+
+      // Distorted cell falls back to the element dN/dx
+      coords << 3., 3.;
+      std::shared_ptr<mpm::NodeBase<Dim>> node5 =
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(5, coords);
+      auto cell1 = std::make_shared<mpm::Cell<Dim>>(1, Nnodes, element, true);
+      REQUIRE(cell1->add_node(0, node0) == true);
+      REQUIRE(cell1->add_node(1, node1) == true);
+      REQUIRE(cell1->add_node(2, node5) == true);
+      REQUIRE(cell1->add_node(3, node3) == true);
+      REQUIRE(cell1->initialise() == true);
+      REQUIRE(cell1->affine() == false);
+      REQUIRE(cell1->geometry() == mpm::CellGeometry::General);
+
+      const Eigen::MatrixXd distorted_dn_dx = cell1->dn_dx(xi, zero, zero);
+      const Eigen::MatrixXd element_distorted_dn_dx =
+          element->dn_dx(xi, cell1->nodal_coordinates(), zero, zero);
+      for (unsigned i = 0; i < distorted_dn_dx.rows(); ++i)
+        for (unsigned j = 0; j < distorted_dn_dx.cols(); ++j)
+          REQUIRE(distorted_dn_dx(i, j) ==
+                  Approx(element_distorted_dn_dx(i, j)).epsilon(Tolerance));
+    }
+
+    // Check inverse map of Cartesian, affine and general cells
+    SECTION("Check closed-form inverse map of affine cells") {
+      Eigen::Vector2d xi;
+      Eigen::Vector2d point;
+      point << 1.5, 0.5;
+
+      // Cartesian cell
+      REQUIRE(cell->is_point_in_cell(point, &xi) == true);
+      REQUIRE(xi(0) == Approx(0.5).epsilon(Tolerance));
+      REQUIRE(xi(1) == Approx(-0.5).epsilon(Tolerance));
+
+      // Parallelogram
+      coords << 3., 1.;
+      std::shared_ptr<mpm::NodeBase<Dim>> node5 =
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(5, coords);
+      coords << 1., 1.;
+      std::shared_ptr<mpm::NodeBase<Dim>> node6 =
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(6, coords);
+      auto cell1 = std::make_shared<mpm::Cell<Dim>>(1, Nnodes, element, true);
+      REQUIRE(cell1->add_node(0, node0) == true);
+      REQUIRE(cell1->add_node(1, node1) == true);
+      REQUIRE(cell1->add_node(2, node5) == true);
+      REQUIRE(cell1->add_node(3, node6) == true);
+      REQUIRE(cell1->initialise() == true);
+      REQUIRE(cell1->geometry() == mpm::CellGeometry::Affine);
+
+      // x = (1.5, 0.5) + xi_0 (1, 0) + xi_1 (0.5, 0.5)
+      point << 1.5, 0.25;
+      xi = cell1->transform_real_to_unit_cell(point);
+      REQUIRE(xi(0) == Approx(0.25).epsilon(Tolerance));
+      REQUIRE(xi(1) == Approx(-0.5).epsilon(Tolerance));
+
+      REQUIRE(cell1->is_point_in_cell(point, &xi) == true);
+      REQUIRE(xi(0) == Approx(0.25).epsilon(Tolerance));
+      REQUIRE(xi(1) == Approx(-0.5).epsilon(Tolerance));
+
+      // Point outside the parallelogram
+      point << 0.25, 0.75;
+      REQUIRE(cell1->is_point_in_cell(point, &xi) == false);
+    }
     // Check shape functions
     SECTION("Check shape functions") {
       const auto sf_ptr = cell->element_ptr();
@@ -790,6 +878,32 @@ TEST_CASE("Cell is checked for 3D case", "[cell][3D]") {
       REQUIRE(sf_ptr->nfunctions() == element->nfunctions());
     }
 
+    // Check cached Jacobian and dN/dx of an affine cell
+    SECTION("Check affine cell Jacobian and dN/dx") {
+      REQUIRE(cell->affine() == true);
+      REQUIRE(cell->geometry() == mpm::CellGeometry::Cartesian);
+
+      // Jacobian of a 2 x 2 x 2 cell
+      const auto jacobian = cell->jacobian();
+      for (unsigned i = 0; i < Dim; ++i)
+        for (unsigned j = 0; j < Dim; ++j)
+          REQUIRE(jacobian(i, j) ==
+                  Approx(i == j ? 1. : 0.).epsilon(Tolerance));
+
+      Eigen::Vector3d xi;
+      xi << 0.25, -0.5, 0.75;
+      const Eigen::Vector3d zero = Eigen::Vector3d::Zero();
+      const Eigen::MatrixXd dn_dx = cell->dn_dx(xi, zero, zero);
+      const Eigen::MatrixXd element_dn_dx =
+          element->dn_dx(xi, cell->nodal_coordinates(), zero, zero);
+      REQUIRE(dn_dx.rows() == element_dn_dx.rows());
+      REQUIRE(dn_dx.cols() == element_dn_dx.cols());
+      for (unsigned i = 0; i < dn_dx.rows(); ++i)
+        for (unsigned j = 0; j < dn_dx.cols(); ++j)
+          REQUIRE(dn_dx(i, j) ==
+                  Approx(element_dn_dx(i, j)).epsilon(Tolerance));
+    }
+
     // Check cell volume calculation
     SECTION("Compute volume of a cell") {
       REQUIRE(cell->nfunctions() == 8);
@@ -0,0 +1,111 @@
+// Hexahedron B-spline element test
+#include <memory>
+#include <set>
+
+#include "catch.hpp"
+
+#include "hexahedron_bspline_element.h"
+
+//! \brief Check hexahedron B-spline element class
+TEST_CASE("Hexahedron B-spline elements are checked",
+          "[hex][element][3D][bspline]") {
+  const unsigned Dim = 3;
+  const double Tolerance = 1.E-7;
+
+  // Zero particle size and deformation gradient
+  const Eigen::Matrix<double, Dim, 1> zero =
+      Eigen::Matrix<double, Dim, 1>::Zero();
+
+  // Local coordinates of points in the cell
+  std::vector<Eigen::Matrix<double, Dim, 1>> points;
+  for (double x : {-1., -0.25, 0.3, 1.})
+    for (double y : {-0.6, 0., 0.75})
+      for (double z : {-1., 0.1, 0.5})
+        points.emplace_back(Eigen::Matrix<double, Dim, 1>(x, y, z));
+
+  //! Check quadratic B-spline element
+  SECTION("64 Node Hexahedron quadratic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> hex =
+        std::make_shared<mpm::HexahedronBSplineElement<Dim, 2>>();
+
+    REQUIRE(hex->nfunctions() == 64);
+    REQUIRE(hex->shapefn_type() == mpm::ShapefnType::BSPLINE);
+    REQUIRE(hex->degree() == mpm::ElementDegree::Linear);
+
+    // 1D weights at the centre are (0, 0.5, 0.5, 0)
+    const auto shapefn = hex->shapefn(zero, zero, zero);
+    REQUIRE(shapefn.size() == 64);
+    for (unsigned i = 0; i < 8; ++i)
+      REQUIRE(shapefn(i) == Approx(0.125).epsilon(Tolerance));
+    for (unsigned i = 8; i < 64; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+  }
+
+  //! Check cubic B-spline element
+  SECTION("64 Node Hexahedron cubic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> hex =
+        std::make_shared<mpm::HexahedronBSplineElement<Dim, 3>>();
+
+    // 1D weights at the centre are (1/48, 23/48, 23/48, 1/48)
+    const auto shapefn = hex->shapefn(zero, zero, zero);
+    REQUIRE(shapefn(0) ==
+            Approx(23. * 23. * 23. / (48. * 48. * 48.)).epsilon(Tolerance));
+    // Node 8 is at (-3, -3, -3)
+    REQUIRE(shapefn(8) == Approx(1. / (48. * 48. * 48.)).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity and linear completeness
+  SECTION("B-spline partition of unity and linear completeness") {
+    for (const auto& hex :
+         {std::shared_ptr<mpm::Element<Dim>>(
+              std::make_shared<mpm::HexahedronBSplineElement<Dim, 2>>()),
+          std::shared_ptr<mpm::Element<Dim>>(
+              std::make_shared<mpm::HexahedronBSplineElement<Dim, 3>>())}) {
+      // Corners first, and each node of the 4 x 4 x 4 stencil once
+      const Eigen::MatrixXd& nodes = hex->natural_nodal_coordinates();
+      REQUIRE(nodes.rows() == 64);
+      REQUIRE(nodes.topRows(8).isApprox(hex->unit_cell_coordinates()));
+      std::set<std::array<int, Dim>> stencil;
+      for (unsigned n = 0; n < 64; ++n)
+        stencil.insert({static_cast<int>(nodes(n, 0)),
+                        static_cast<int>(nodes(n, 1)),
+                        static_cast<int>(nodes(n, 2))});
+      REQUIRE(stencil.size() == 64);
+
+      for (const auto& xi : points) {
+        const Eigen::VectorXd shapefn = hex->shapefn(xi, zero, zero);
+        const Eigen::MatrixXd grad_shapefn = hex->grad_shapefn(xi, zero, zero);
+        REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+        REQUIRE(shapefn.minCoeff() >= 0.);
+        for (unsigned i = 0; i < Dim; ++i) {
+          REQUIRE(grad_shapefn.col(i).sum() == Approx(0.).margin(Tolerance));
+          // Reproduces the local coordinates and their gradient
+          REQUIRE(shapefn.dot(nodes.col(i)) ==
+                  Approx(xi(i)).epsilon(Tolerance));
+          for (unsigned j = 0; j < Dim; ++j)
+            REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                    Approx(i == j ? 1. : 0.).margin(Tolerance));
+        }
+      }
+
+      // Jacobian and B-matrix of a uniform grid with a spacing of 0.5
+      const Eigen::MatrixXd nodal_coordinates = 0.25 * nodes;
+      const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4, 0.9);
+      const auto jacobian = hex->jacobian(xi, nodal_coordinates, zero, zero);
+      REQUIRE(jacobian.isApprox(0.25 * Eigen::Matrix3d::Identity()));
+
+      const auto bmatrix = hex->bmatrix(xi, nodal_coordinates, zero, zero);
+      REQUIRE(bmatrix.size() == 64);
+      const Eigen::MatrixXd grad_shapefn = hex->grad_shapefn(xi, zero, zero);
+      for (unsigned n = 0; n < 64; ++n) {
+        REQUIRE(bmatrix.at(n)(2, 2) ==
+                Approx(4. * grad_shapefn(n, 2)).margin(Tolerance));
+        REQUIRE(bmatrix.at(n)(4, 1) ==
+                Approx(4. * grad_shapefn(n, 2)).margin(Tolerance));
+      }
+
+      // Local shape functions are those of the 8-noded cell
+      REQUIRE(hex->shapefn_local(zero, zero, zero).size() == 8);
+    }
+  }
+}
@@ -0,0 +1,170 @@
+// Hexahedron CPDI element test
+#include <cmath>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "hexahedron_cpdi_element.h"
+
+//! \brief Check hexahedron CPDI element class
+TEST_CASE("Hexahedron CPDI elements are checked",
+          "[hex][element][3D][cpdi]") {
+  const unsigned Dim = 3;
+  const double Tolerance = 1.E-7;
+
+  // Zero deformation gradient
+  const Eigen::Matrix<double, Dim, 1> zero =
+      Eigen::Matrix<double, Dim, 1>::Zero();
+
+  std::shared_ptr<mpm::Element<Dim>> hex =
+      std::make_shared<mpm::HexahedronCPDIElement<Dim, 64>>();
+
+  //! Check shape functions of a particle domain
+  SECTION("64 Node Hexahedron CPDI Element") {
+    REQUIRE(hex->nfunctions() == 64);
+    REQUIRE(hex->shapefn_type() == mpm::ShapefnType::CPDI);
+    REQUIRE(hex->degree() == mpm::ElementDegree::Linear);
+
+    // A domain of size 2 at the centre spans [-1, 1]: 1D weights are
+    // (0, 0.5, 0.5, 0)
+    const Eigen::Matrix<double, Dim, 1> size(2., 2., 2.);
+    const auto shapefn = hex->shapefn(zero, size, zero);
+    REQUIRE(shapefn.size() == 64);
+    for (unsigned i = 0; i < 8; ++i)
+      REQUIRE(shapefn(i) == Approx(0.125).epsilon(Tolerance));
+    for (unsigned i = 8; i < 64; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+
+    // A unit domain at the corner node (-1, -1, -1): node 8 is at (-3, -3, -3)
+    const Eigen::Matrix<double, Dim, 1> corner(-1., -1., -1.);
+    const Eigen::Matrix<double, Dim, 1> unit(1., 1., 1.);
+    const auto corner_shapefn = hex->shapefn(corner, unit, zero);
+    REQUIRE(corner_shapefn(0) == Approx(0.421875).epsilon(Tolerance));
+    REQUIRE(corner_shapefn(8) == Approx(0.001953125).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity and linear completeness
+  SECTION("CPDI partition of unity and linear completeness") {
+    // Corners first, and each node of the 4 x 4 x 4 stencil once
+    const Eigen::MatrixXd& nodes = hex->natural_nodal_coordinates();
+    REQUIRE(nodes.rows() == 64);
+    REQUIRE(nodes.topRows(8).isApprox(hex->unit_cell_coordinates()));
+    std::set<std::array<int, Dim>> stencil;
+    for (unsigned n = 0; n < 64; ++n)
+      stencil.insert({static_cast<int>(nodes(n, 0)),
+                      static_cast<int>(nodes(n, 1)),
+                      static_cast<int>(nodes(n, 2))});
+    REQUIRE(stencil.size() == 64);
+
+    // Stretched particle domain
+    const Eigen::Matrix<double, Dim, 1> size(0.5, 1.5, 3.);
+    for (double x : {-1., -0.25, 0.3, 1.}) {
+      for (double y : {-0.6, 0., 0.75}) {
+        for (double z : {-1., 0.1, 0.5}) {
+          const Eigen::Matrix<double, Dim, 1> xi(x, y, z);
+          const Eigen::VectorXd shapefn = hex->shapefn(xi, size, zero);
+          const Eigen::MatrixXd grad_shapefn =
+              hex->grad_shapefn(xi, size, zero);
+          REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+          REQUIRE(shapefn.minCoeff() >= 0.);
+          for (unsigned i = 0; i < Dim; ++i) {
+            REQUIRE(grad_shapefn.col(i).sum() ==
+                    Approx(0.).margin(Tolerance));
+            // Reproduces the local coordinates and their gradient
+            REQUIRE(shapefn.dot(nodes.col(i)) ==
+                    Approx(xi(i)).margin(Tolerance));
+            for (unsigned j = 0; j < Dim; ++j)
+              REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                      Approx(i == j ? 1. : 0.).margin(Tolerance));
+          }
+
+          // In place evaluation matches the separate evaluations
+          Eigen::VectorXd sf;
+          Eigen::MatrixXd grad_sf;
+          hex->shapefn_grad_shapefn(xi, size, zero, &sf, &grad_sf);
+          REQUIRE(sf.isApprox(shapefn));
+          REQUIRE(grad_sf.isApprox(grad_shapefn));
+        }
+      }
+    }
+
+    // Jacobian of a uniform grid with a spacing of 0.5
+    const Eigen::MatrixXd nodal_coordinates = 0.25 * nodes;
+    const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4, 0.9);
+    const auto jacobian = hex->jacobian(xi, nodal_coordinates, size, zero);
+    REQUIRE(jacobian.isApprox(0.25 * Eigen::Matrix3d::Identity()));
+    REQUIRE(hex->bmatrix(xi, nodal_coordinates, size, zero).size() == 64);
+
+    // Local shape functions are those of the 8-noded cell
+    REQUIRE(hex->shapefn_local(zero, zero, zero).size() == 8);
+  }
+
+  //! Check shape functions of parallelepiped particle domains
+  SECTION("CPDI parallelepiped domains") {
+    const Eigen::MatrixXd& nodes = hex->natural_nodal_coordinates();
+
+    // A rectangular domain matches the domain of its size
+    Eigen::Matrix<double, Dim, Dim> domain;
+    // clang-format off
+    domain << 0.25, 0.,   0.,
+              0.,   0.75, 0.,
+              0.,   0.,   0.5;
+    // clang-format on
+    const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4, 0.9);
+    Eigen::VectorXd shapefn;
+    Eigen::MatrixXd grad_shapefn;
+    hex->domain_shapefn_grad_shapefn(xi, domain, &shapefn, &grad_shapefn);
+    const Eigen::Matrix<double, Dim, 1> size = 2. * domain.diagonal();
+    REQUIRE(shapefn.isApprox(hex->shapefn(xi, size, zero)));
+    REQUIRE(grad_shapefn.isApprox(hex->grad_shapefn(xi, size, zero)));
+
+    // Sheared, rotated, degenerate and oversized (clamped) domains
+    std::vector<Eigen::Matrix<double, Dim, Dim>> domains;
+    // clang-format off
+    domain << 0.5, 0.3,  0.,
+              0.,  0.25, 0.2,
+              0.1, 0.,   0.4;
+    domains.emplace_back(domain);
+    domain << 0.6 * std::cos(0.5), -0.4 * std::sin(0.5), 0.,
+              0.6 * std::sin(0.5),  0.4 * std::cos(0.5), 0.,
+              0.,                   0.,                  0.3;
+    domains.emplace_back(domain);
+    domain << 0.5,  1.,  0.,
+              0.25, 0.5, 0.,
+              0.,   0.,  0.5;
+    domains.emplace_back(domain);
+    domain << 2.5, -1.,  0.5,
+              0.5,  1.5, 0.,
+              0.,   0.5, 3.;
+    domains.emplace_back(domain);
+    // clang-format on
+
+    for (const auto& domain : domains) {
+      for (double x : {-1., 0.3, 1.}) {
+        for (double y : {-0.6, 0., 0.75}) {
+          for (double z : {-1., 0.5}) {
+            const Eigen::Matrix<double, Dim, 1> xi(x, y, z);
+            hex->domain_shapefn_grad_shapefn(xi, domain, &shapefn,
+                                             &grad_shapefn);
+            REQUIRE(shapefn.size() == 64);
+            REQUIRE(grad_shapefn.rows() == 64);
+            REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+            REQUIRE(shapefn.minCoeff() >= 0.);
+            for (unsigned i = 0; i < Dim; ++i) {
+              REQUIRE(grad_shapefn.col(i).sum() ==
+                      Approx(0.).margin(Tolerance));
+              // Reproduces the local coordinates and their gradient
+              REQUIRE(shapefn.dot(nodes.col(i)) ==
+                      Approx(xi(i)).margin(Tolerance));
+              for (unsigned j = 0; j < Dim; ++j)
+                REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                        Approx(i == j ? 1. : 0.).margin(Tolerance));
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,119 @@
+// Quadrilateral B-spline element test
+#include <memory>
+
+#include "catch.hpp"
+
+#include "quadrilateral_bspline_element.h"
+
+//! \brief Check quadrilateral B-spline element class
+TEST_CASE("Quadrilateral B-spline elements are checked",
+          "[quad][element][2D][bspline]") {
+  const unsigned Dim = 2;
+  const double Tolerance = 1.E-7;
+
+  // Zero particle size and deformation gradient
+  const Eigen::Matrix<double, Dim, 1> zero =
+      Eigen::Matrix<double, Dim, 1>::Zero();
+
+  // Local coordinates of points in the cell
+  std::vector<Eigen::Matrix<double, Dim, 1>> points;
+  for (double x : {-1., -0.6, -0.25, 0., 0.3, 0.75, 1.})
+    for (double y : {-1., -0.4, 0.1, 0.5, 1.})
+      points.emplace_back(Eigen::Matrix<double, Dim, 1>(x, y));
+
+  //! Check quadratic B-spline element
+  SECTION("16 Node Quadrilateral quadratic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> quad =
+        std::make_shared<mpm::QuadrilateralBSplineElement<Dim, 2>>();
+
+    REQUIRE(quad->nfunctions() == 16);
+    REQUIRE(quad->shapefn_type() == mpm::ShapefnType::BSPLINE);
+    REQUIRE(quad->degree() == mpm::ElementDegree::Linear);
+
+    // 1D weights at the centre are (0, 0.5, 0.5, 0)
+    const auto shapefn = quad->shapefn(zero, zero, zero);
+    REQUIRE(shapefn.size() == 16);
+    for (unsigned i = 0; i < 4; ++i)
+      REQUIRE(shapefn(i) == Approx(0.25).epsilon(Tolerance));
+    for (unsigned i = 4; i < 16; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+
+    // At a corner node (-1, -1): 1D weights are (0.125, 0.75, 0.125, 0)
+    const Eigen::Matrix<double, Dim, 1> corner(-1., -1.);
+    const auto corner_shapefn = quad->shapefn(corner, zero, zero);
+    REQUIRE(corner_shapefn(0) == Approx(0.5625).epsilon(Tolerance));
+    REQUIRE(corner_shapefn(4) == Approx(0.015625).epsilon(Tolerance));
+    REQUIRE(corner_shapefn(7) == Approx(0.).margin(Tolerance));
+
+    const auto grad_shapefn = quad->grad_shapefn(corner, zero, zero);
+    REQUIRE(grad_shapefn.rows() == 16);
+    REQUIRE(grad_shapefn.cols() == Dim);
+    // d/dxi of node 0 = 0.5 * (0 * 0.75) and of node 1 = 0.5 * 0.5 * 0.75
+    REQUIRE(grad_shapefn(0, 0) == Approx(0.).margin(Tolerance));
+    REQUIRE(grad_shapefn(1, 0) == Approx(0.1875).epsilon(Tolerance));
+  }
+
+  //! Check cubic B-spline element
+  SECTION("16 Node Quadrilateral cubic B-spline Element") {
+    std::shared_ptr<mpm::Element<Dim>> quad =
+        std::make_shared<mpm::QuadrilateralBSplineElement<Dim, 3>>();
+
+    REQUIRE(quad->nfunctions() == 16);
+    REQUIRE(quad->shapefn_type() == mpm::ShapefnType::BSPLINE);
+
+    // 1D weights at the centre are (1/48, 23/48, 23/48, 1/48)
+    const auto shapefn = quad->shapefn(zero, zero, zero);
+    REQUIRE(shapefn(0) == Approx(23. * 23. / 2304.).epsilon(Tolerance));
+    REQUIRE(shapefn(4) == Approx(1. / 2304.).epsilon(Tolerance));
+    REQUIRE(shapefn(5) == Approx(23. / 2304.).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity and linear completeness
+  SECTION("B-spline partition of unity and linear completeness") {
+    for (const auto& quad :
+         {std::shared_ptr<mpm::Element<Dim>>(
+              std::make_shared<mpm::QuadrilateralBSplineElement<Dim, 2>>()),
+          std::shared_ptr<mpm::Element<Dim>>(
+              std::make_shared<mpm::QuadrilateralBSplineElement<Dim, 3>>())}) {
+      const Eigen::MatrixXd& nodes = quad->natural_nodal_coordinates();
+      REQUIRE(nodes.rows() == 16);
+      REQUIRE(nodes.topRows(4).isApprox(quad->unit_cell_coordinates()));
+
+      for (const auto& xi : points) {
+        const Eigen::VectorXd shapefn = quad->shapefn(xi, zero, zero);
+        const Eigen::MatrixXd grad_shapefn =
+            quad->grad_shapefn(xi, zero, zero);
+        REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+        REQUIRE(shapefn.minCoeff() >= 0.);
+        for (unsigned i = 0; i < Dim; ++i) {
+          REQUIRE(grad_shapefn.col(i).sum() == Approx(0.).margin(Tolerance));
+          // Reproduces the local coordinates and their gradient
+          REQUIRE(shapefn.dot(nodes.col(i)) ==
+                  Approx(xi(i)).epsilon(Tolerance));
+          for (unsigned j = 0; j < Dim; ++j)
+            REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                    Approx(i == j ? 1. : 0.).margin(Tolerance));
+        }
+      }
+
+      // Jacobian and B-matrix of a uniform grid with a spacing of 0.5
+      const Eigen::MatrixXd nodal_coordinates = 0.25 * nodes;
+      const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4);
+      const auto jacobian = quad->jacobian(xi, nodal_coordinates, zero, zero);
+      REQUIRE(jacobian.isApprox(0.25 * Eigen::Matrix2d::Identity()));
+
+      const auto bmatrix = quad->bmatrix(xi, nodal_coordinates, zero, zero);
+      REQUIRE(bmatrix.size() == 16);
+      const Eigen::MatrixXd grad_shapefn = quad->grad_shapefn(xi, zero, zero);
+      for (unsigned n = 0; n < 16; ++n) {
+        REQUIRE(bmatrix.at(n)(0, 0) ==
+                Approx(4. * grad_shapefn(n, 0)).margin(Tolerance));
+        REQUIRE(bmatrix.at(n)(2, 0) ==
+                Approx(4. * grad_shapefn(n, 1)).margin(Tolerance));
+      }
+
+      // Local shape functions are those of the 4-noded cell
+      REQUIRE(quad->shapefn_local(zero, zero, zero).size() == 4);
+    }
+  }
+}
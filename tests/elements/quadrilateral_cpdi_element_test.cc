@@ -0,0 +1,186 @@
+// Quadrilateral CPDI element test
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "quadrilateral_cpdi_element.h"
+
+//! \brief Check quadrilateral CPDI element class
+TEST_CASE("Quadrilateral CPDI elements are checked",
+          "[quad][element][2D][cpdi]") {
+  const unsigned Dim = 2;
+  const double Tolerance = 1.E-7;
+
+  // Zero deformation gradient
+  const Eigen::Matrix<double, Dim, 1> zero =
+      Eigen::Matrix<double, Dim, 1>::Zero();
+
+  std::shared_ptr<mpm::Element<Dim>> quad =
+      std::make_shared<mpm::QuadrilateralCPDIElement<Dim, 16>>();
+
+  //! Check shape functions of a particle domain
+  SECTION("16 Node Quadrilateral CPDI Element") {
+    REQUIRE(quad->nfunctions() == 16);
+    REQUIRE(quad->shapefn_type() == mpm::ShapefnType::CPDI);
+    REQUIRE(quad->degree() == mpm::ElementDegree::Linear);
+
+    // A point particle has the linear shape functions of the cell
+    const Eigen::Matrix<double, Dim, 1> xi(0.5, -0.5);
+    const auto point_shapefn = quad->shapefn(xi, zero, zero);
+    REQUIRE(point_shapefn.size() == 16);
+    REQUIRE(point_shapefn(0) == Approx(0.1875).epsilon(Tolerance));
+    REQUIRE(point_shapefn(1) == Approx(0.5625).epsilon(Tolerance));
+    REQUIRE(point_shapefn(2) == Approx(0.1875).epsilon(Tolerance));
+    REQUIRE(point_shapefn(3) == Approx(0.0625).epsilon(Tolerance));
+    for (unsigned i = 4; i < 16; ++i)
+      REQUIRE(point_shapefn(i) == Approx(0.).margin(Tolerance));
+
+    // A unit domain at the corner node (-1, -1) spans [-1.5, -0.5]: 1D
+    // weights are (0.125, 0.75, 0.125, 0) and gradients (-0.25, 0, 0.25, 0)
+    const Eigen::Matrix<double, Dim, 1> corner(-1., -1.);
+    const Eigen::Matrix<double, Dim, 1> size(1., 1.);
+    const auto shapefn = quad->shapefn(corner, size, zero);
+    REQUIRE(shapefn(0) == Approx(0.5625).epsilon(Tolerance));
+    REQUIRE(shapefn(1) == Approx(0.09375).epsilon(Tolerance));
+    REQUIRE(shapefn(4) == Approx(0.015625).epsilon(Tolerance));
+    REQUIRE(shapefn(7) == Approx(0.).margin(Tolerance));
+
+    const auto grad_shapefn = quad->grad_shapefn(corner, size, zero);
+    REQUIRE(grad_shapefn.rows() == 16);
+    REQUIRE(grad_shapefn.cols() == Dim);
+    REQUIRE(grad_shapefn(0, 0) == Approx(0.).margin(Tolerance));
+    REQUIRE(grad_shapefn(1, 0) == Approx(0.1875).epsilon(Tolerance));
+    REQUIRE(grad_shapefn(4, 1) == Approx(-0.03125).epsilon(Tolerance));
+  }
+
+  //! Check partition of unity and linear completeness
+  SECTION("CPDI partition of unity and linear completeness") {
+    const Eigen::MatrixXd& nodes = quad->natural_nodal_coordinates();
+    REQUIRE(nodes.rows() == 16);
+    REQUIRE(nodes.topRows(4).isApprox(quad->unit_cell_coordinates()));
+
+    // Point, stretched and oversized (clamped) particle domains
+    std::vector<Eigen::Matrix<double, Dim, 1>> sizes;
+    sizes.emplace_back(Eigen::Matrix<double, Dim, 1>(0., 0.));
+    sizes.emplace_back(Eigen::Matrix<double, Dim, 1>(0.5, 1.5));
+    sizes.emplace_back(Eigen::Matrix<double, Dim, 1>(2., 1.));
+    sizes.emplace_back(Eigen::Matrix<double, Dim, 1>(6., 3.5));
+
+    for (const auto& size : sizes) {
+      for (double x : {-1., -0.6, 0., 0.3, 1.}) {
+        for (double y : {-1., 0.1, 0.5, 1.}) {
+          const Eigen::Matrix<double, Dim, 1> xi(x, y);
+          const Eigen::VectorXd shapefn = quad->shapefn(xi, size, zero);
+          const Eigen::MatrixXd grad_shapefn =
+              quad->grad_shapefn(xi, size, zero);
+          REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+          REQUIRE(shapefn.minCoeff() >= 0.);
+          for (unsigned i = 0; i < Dim; ++i) {
+            REQUIRE(grad_shapefn.col(i).sum() ==
+                    Approx(0.).margin(Tolerance));
+            // Reproduces the local coordinates and their gradient
+            REQUIRE(shapefn.dot(nodes.col(i)) ==
+                    Approx(xi(i)).margin(Tolerance));
+            for (unsigned j = 0; j < Dim; ++j)
+              REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                      Approx(i == j ? 1. : 0.).margin(Tolerance));
+          }
+
+          // In place evaluation matches the separate evaluations
+          Eigen::VectorXd sf;
+          Eigen::MatrixXd grad_sf;
+          quad->shapefn_grad_shapefn(xi, size, zero, &sf, &grad_sf);
+          REQUIRE(sf.isApprox(shapefn));
+          REQUIRE(grad_sf.isApprox(grad_shapefn));
+        }
+      }
+    }
+
+    // Jacobian of a uniform grid with a spacing of 0.5
+    const Eigen::MatrixXd nodal_coordinates = 0.25 * nodes;
+    const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4);
+    const Eigen::Matrix<double, Dim, 1> size(1., 0.5);
+    const auto jacobian = quad->jacobian(xi, nodal_coordinates, size, zero);
+    REQUIRE(jacobian.isApprox(0.25 * Eigen::Matrix2d::Identity()));
+    REQUIRE(quad->bmatrix(xi, nodal_coordinates, size, zero).size() == 16);
+
+    // Local shape functions are those of the 4-noded cell
+    REQUIRE(quad->shapefn_local(zero, zero, zero).size() == 4);
+  }
+
+  //! Check shape functions of parallelogram particle domains
+  SECTION("CPDI parallelogram domains") {
+    const Eigen::MatrixXd& nodes = quad->natural_nodal_coordinates();
+
+    // A rectangular domain matches the domain of its size
+    Eigen::Matrix<double, Dim, Dim> domain;
+    // clang-format off
+    domain << 0.25, 0.,
+              0.,   0.75;
+    // clang-format on
+    const Eigen::Matrix<double, Dim, 1> xi(0.3, -0.4);
+    Eigen::VectorXd shapefn;
+    Eigen::MatrixXd grad_shapefn;
+    quad->domain_shapefn_grad_shapefn(xi, domain, &shapefn, &grad_shapefn);
+    const Eigen::Matrix<double, Dim, 1> size = 2. * domain.diagonal();
+    REQUIRE(shapefn.isApprox(quad->shapefn(xi, size, zero)));
+    REQUIRE(grad_shapefn.isApprox(quad->grad_shapefn(xi, size, zero)));
+
+    // A unit square domain sheared by 0.5 at the centre has corners at
+    // (-0.75, -0.5), (0.25, -0.5), (-0.25, 0.5) and (0.75, 0.5)
+    // clang-format off
+    domain << 0.5, 0.25,
+              0.,  0.5;
+    // clang-format on
+    quad->domain_shapefn_grad_shapefn(zero, domain, &shapefn, &grad_shapefn);
+    REQUIRE(shapefn(0) == Approx(0.28125).epsilon(Tolerance));
+    REQUIRE(shapefn(1) == Approx(0.21875).epsilon(Tolerance));
+    REQUIRE(shapefn(2) == Approx(0.28125).epsilon(Tolerance));
+    REQUIRE(shapefn(3) == Approx(0.21875).epsilon(Tolerance));
+    for (unsigned i = 4; i < 16; ++i)
+      REQUIRE(shapefn(i) == Approx(0.).margin(Tolerance));
+
+    // Sheared, rotated, degenerate and oversized (clamped) domains
+    std::vector<Eigen::Matrix<double, Dim, Dim>> domains;
+    // clang-format off
+    domain << 0.5, 0.3,
+              0.,  0.25;
+    domains.emplace_back(domain);
+    domain << 0.6 * std::cos(0.5), -0.4 * std::sin(0.5),
+              0.6 * std::sin(0.5),  0.4 * std::cos(0.5);
+    domains.emplace_back(domain);
+    domain << 0.5, 1.,
+              0.25, 0.5;
+    domains.emplace_back(domain);
+    domain << 2.5, -1.,
+              0.5,  1.5;
+    domains.emplace_back(domain);
+    // clang-format on
+
+    for (const auto& domain : domains) {
+      for (double x : {-1., -0.6, 0., 0.3, 1.}) {
+        for (double y : {-1., 0.1, 0.5, 1.}) {
+          const Eigen::Matrix<double, Dim, 1> xi(x, y);
+          quad->domain_shapefn_grad_shapefn(xi, domain, &shapefn,
+                                            &grad_shapefn);
+          REQUIRE(shapefn.size() == 16);
+          REQUIRE(grad_shapefn.rows() == 16);
+          REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+          REQUIRE(shapefn.minCoeff() >= 0.);
+          for (unsigned i = 0; i < Dim; ++i) {
+            REQUIRE(grad_shapefn.col(i).sum() ==
+                    Approx(0.).margin(Tolerance));
+            // Reproduces the local coordinates and their gradient
+            REQUIRE(shapefn.dot(nodes.col(i)) ==
+                    Approx(xi(i)).margin(Tolerance));
+            for (unsigned j = 0; j < Dim; ++j)
+              REQUIRE(grad_shapefn.col(j).dot(nodes.col(i)) ==
+                      Approx(i == j ? 1. : 0.).margin(Tolerance));
+          }
+        }
+      }
+    }
+  }
+}
@@ -569,6 +569,26 @@ TEST_CASE("Quadrilateral gimp elements are checked",
         REQUIRE(bmatrix.at(i)(2, 1) == Approx(gradsf(i, 0)).epsilon(Tolerance));
       }
     }
+    // Shape functions form a partition of unity for any particle location
+    SECTION("GIMP shape functions partition of unity") {
+      Eigen::Matrix<double, Dim, 1> psize;
+      psize.fill(0.5);
+      Eigen::Matrix<double, Dim, 1> defgrad;
+      defgrad.setZero();
+
+      for (const double x : {-1., -0.9, -0.3, 0., 0.45, 0.8, 1.}) {
+        Eigen::Matrix<double, Dim, 1> coords;
+        for (unsigned i = 0; i < Dim; ++i) coords(i) = x * (1. - 0.1 * i);
+
+        const auto shapefn = quad->shapefn(coords, psize, defgrad);
+        const auto gradsf = quad->grad_shapefn(coords, psize, defgrad);
+
+        REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+        for (unsigned i = 0; i < Dim; ++i)
+          REQUIRE(gradsf.col(i).sum() == Approx(0.).margin(Tolerance));
+      }
+    }
+
     SECTION("Center cell gimp element length") {
       // Check element length
       REQUIRE(quad->unit_element_length() == Approx(2).epsilon(Tolerance));
@@ -0,0 +1,109 @@
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "catch.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ascii_parser.h"
+#include "io_mesh_ascii.h"
+
+// Check parsing of ascii files
+TEST_CASE("Ascii parser is checked", "[IOMesh][IOMeshAscii][parser]") {
+
+  SECTION("Check numbers") {
+    const std::string numbers =
+        "  12 +7 1.5e-3 -2 +.5 3. 0.0001 -0.12345678901234567890 1E+25 x";
+    const char* first = numbers.data();
+    const char* last = numbers.data() + numbers.size();
+
+    unsigned long long integer;
+    REQUIRE(mpm::ascii::parse(&first, last, &integer) == true);
+    REQUIRE(integer == 12);
+    REQUIRE(mpm::ascii::parse(&first, last, &integer) == true);
+    REQUIRE(integer == 7);
+
+    // Doubles match strtod exactly
+    for (const char* expected :
+         {"1.5e-3", "-2", "+.5", "3.", "0.0001", "-0.12345678901234567890",
+          "1E+25"}) {
+      double value;
+      REQUIRE(mpm::ascii::parse(&first, last, &value) == true);
+      REQUIRE(value == std::strtod(expected, nullptr));
+    }
+
+    // Not a number
+    double value;
+    REQUIRE(mpm::ascii::parse(&first, last, &value) == false);
+    REQUIRE(mpm::ascii::parse(&first, last, &integer) == false);
+  }
+
+  SECTION("Check data lines") {
+    const std::string text =
+        "! comment\n\n  3 2  \r\n# comment\n1 2 # comment\n0.5 0.25\n\t1";
+    std::size_t nlines = 0;
+    const auto chunks =
+        mpm::ascii::split_lines(text.data(), text.size(), &nlines);
+    REQUIRE(nlines == 3);
+
+    const auto integers =
+        mpm::ascii::first_line_integers(text.data(), text.size());
+    REQUIRE(integers == std::vector<unsigned long long>({3, 2}));
+
+    std::vector<std::string> lines(nlines);
+    REQUIRE(mpm::ascii::for_each_data_line(
+                chunks, [&](std::size_t line, const char* begin,
+                            const char* end) {
+                  lines[line] = std::string(begin, end);
+                  return true;
+                }) == true);
+    REQUIRE(lines == std::vector<std::string>({"3 2", "0.5 0.25", "1"}));
+  }
+
+  SECTION("Check a mesh split into many chunks") {
+#ifdef _OPENMP
+    const int nthreads = omp_get_max_threads();
+    omp_set_num_threads(8);
+#endif
+    // Structured mesh of 100 x 100 cells with comments between sections
+    const unsigned ncells_dir = 100;
+    const unsigned nnodes = (ncells_dir + 1) * (ncells_dir + 1);
+    std::ofstream file("mesh-chunks-2d.txt");
+    file << "! elementShape quadrilateral\n";
+    file << nnodes << "\t" << ncells_dir * ncells_dir << "\n";
+    for (unsigned j = 0; j <= ncells_dir; ++j)
+      for (unsigned i = 0; i <= ncells_dir; ++i)
+        file << 0.25 * i << "\t" << 0.125 * j << "\r\n";
+    file << "# cells\n\n";
+    for (unsigned j = 0; j < ncells_dir; ++j)
+      for (unsigned i = 0; i < ncells_dir; ++i) {
+        const unsigned n0 = j * (ncells_dir + 1) + i;
+        file << n0 << " " << n0 + 1 << " " << n0 + ncells_dir + 2 << " "
+             << n0 + ncells_dir + 1 << "\n";
+      }
+    file.close();
+
+    auto io_mesh = std::make_unique<mpm::IOMeshAscii<2>>();
+    const auto coordinates = io_mesh->read_mesh_nodes("mesh-chunks-2d.txt");
+    REQUIRE(coordinates.size() == nnodes);
+    for (unsigned n = 0; n < nnodes; ++n) {
+      REQUIRE(coordinates[n](0) == 0.25 * (n % (ncells_dir + 1)));
+      REQUIRE(coordinates[n](1) == 0.125 * (n / (ncells_dir + 1)));
+    }
+
+    const auto cells = io_mesh->read_mesh_cells("mesh-chunks-2d.txt");
+    REQUIRE(cells.size() == ncells_dir * ncells_dir);
+    for (unsigned c = 0; c < cells.size(); ++c) {
+      const unsigned n0 = (c / ncells_dir) * (ncells_dir + 1) + c % ncells_dir;
+      REQUIRE(cells[c] == std::vector<mpm::Index>(
+                              {n0, n0 + 1, n0 + ncells_dir + 2,
+                               n0 + ncells_dir + 1}));
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(nthreads);
+#endif
+  }
+}
@@ -0,0 +1,92 @@
+#include <fstream>
+#include <stdexcept>
+
+#include "catch.hpp"
+
+#include "entity_sets.h"
+#include "io_mesh_binary.h"
+
+// Check entity sets
+TEST_CASE("Entity sets are checked", "[IO][entity_sets]") {
+
+  // Entity sets as ids and as ranges
+  const std::string json_file = "entity_sets_ranges.json";
+  std::ofstream file(json_file);
+  file << R"({
+  "node_sets": [
+    {"id": 0, "set": [3, 1, 2, 2, 10]},
+    {"id": 5, "set": []}
+  ],
+  "particle_sets": [
+    {"id": 2, "ranges": [[0, 1000000], [2000000, 10]]},
+    {"id": 3, "set": [4], "ranges": [[5, 2]]}
+  ],
+  "cell_sets": [{"set": [1, 0], "id": 7}]
+})";
+  file.close();
+
+  // Set without an id
+  std::ofstream invalid("entity_sets_invalid.json");
+  invalid << R"({"node_sets": [{"set": [0, 1]}]})";
+  invalid.close();
+
+  // Check sets of a read type
+  auto check_sets = [](const std::string& filename) {
+    auto node_sets = mpm::entity_sets::read(filename, "node_sets");
+    REQUIRE(node_sets.size() == 2);
+    REQUIRE(node_sets.at(0).ids() == std::vector<mpm::Index>({3, 1, 2, 10}));
+    REQUIRE(node_sets.at(5).empty() == true);
+
+    auto particle_sets = mpm::entity_sets::read(filename, "particle_sets");
+    REQUIRE(particle_sets.size() == 2);
+    const auto& set = particle_sets.at(2);
+    REQUIRE(set.size() == 1000010);
+    REQUIRE(set.ranges().size() == 2);
+    REQUIRE(set[999999] == 999999);
+    REQUIRE(set[1000000] == 2000000);
+    REQUIRE(set.contains(1000000) == false);
+    REQUIRE(particle_sets.at(3).ids() == std::vector<mpm::Index>({4, 5, 6}));
+    REQUIRE(particle_sets.at(3).ranges().size() == 1);
+
+    auto cell_sets = mpm::entity_sets::read(filename, "cell_sets");
+    REQUIRE(cell_sets.size() == 1);
+    // Ids keep the order of the file
+    REQUIRE(cell_sets.at(7).ids() == std::vector<mpm::Index>({1, 0}));
+  };
+
+  SECTION("Check JSON entity sets") {
+    check_sets(json_file);
+
+    // Invalid files and types of sets
+    REQUIRE_THROWS(mpm::entity_sets::read("missing.json", "node_sets"));
+    REQUIRE_THROWS(mpm::entity_sets::read(json_file, "edge_sets"));
+    REQUIRE_THROWS(
+        mpm::entity_sets::read("entity_sets_invalid.json", "node_sets"));
+  }
+
+  SECTION("Check binary entity sets") {
+    const std::string binary_file = "entity_sets_ranges.bin";
+    mpm::entity_sets::convert_json(json_file, binary_file);
+    check_sets(binary_file);
+
+    // Ranges are stored instead of ids
+    std::ifstream binary(binary_file, std::ios::binary | std::ios::ate);
+    REQUIRE(static_cast<std::size_t>(binary.tellg()) < 1000);
+
+    // Conversion through the ascii to binary converter
+    auto io_mesh = std::make_unique<mpm::IOMeshBinary<2>>();
+    REQUIRE(io_mesh->convert_ascii(mpm::binary::file_type("entity_sets"),
+                                   json_file, binary_file) == true);
+    check_sets(binary_file);
+    REQUIRE(io_mesh->convert_ascii(mpm::binary::FileType::EntitySets,
+                                   "entity_sets_invalid.json",
+                                   binary_file) == false);
+
+    // Binary files of other types are rejected
+    std::vector<Eigen::Matrix<double, 2, 1>> particles(
+        1, Eigen::Matrix<double, 2, 1>::Zero());
+    REQUIRE(io_mesh->write_particles("particles_sets.bin", particles) == true);
+    REQUIRE_THROWS(
+        mpm::entity_sets::read("particles_sets.bin", "particle_sets"));
+  }
+}
@@ -0,0 +1,123 @@
+#include <vector>
+
+#include "catch.hpp"
+
+#include "hdf5_writer.h"
+
+// Check writing and reading HDF5 particles
+TEST_CASE("HDF5 writer is checked", "[hdf5][writer]") {
+  // Particles with distinct values in every field
+  std::vector<mpm::HDF5Particle> particles(3);
+  for (unsigned i = 0; i < particles.size(); ++i) {
+    auto& particle = particles[i];
+    particle.id = 10 + i;
+    particle.mass = 1.5 * i;
+    particle.volume = 0.25 + i;
+    particle.coord_x = 0.1 * i;
+    particle.coord_y = -0.2 * i;
+    particle.velocity_z = 3.0 + i;
+    particle.stress_yy = -1.E+5 * i;
+    particle.gamma_xz = 1.E-6 * i;
+    particle.epsilon_v = 0.01 * i;
+    particle.cell_id = 100 + i;
+    particle.status = (i % 2 == 0);
+    particle.material_id = i;
+    particle.nstate_vars = 2;
+    particle.svars[0] = 0.5 * i;
+    particle.svars[19] = -0.5 * i;
+  }
+
+  // Check all fields of particles read
+  auto check = [&](const std::vector<mpm::HDF5Particle>& read) {
+    REQUIRE(read.size() == particles.size());
+    for (unsigned i = 0; i < particles.size(); ++i) {
+      REQUIRE(read[i].id == particles[i].id);
+      REQUIRE(read[i].mass == particles[i].mass);
+      REQUIRE(read[i].volume == particles[i].volume);
+      REQUIRE(read[i].coord_x == particles[i].coord_x);
+      REQUIRE(read[i].coord_y == particles[i].coord_y);
+      REQUIRE(read[i].velocity_z == particles[i].velocity_z);
+      REQUIRE(read[i].stress_yy == particles[i].stress_yy);
+      REQUIRE(read[i].gamma_xz == particles[i].gamma_xz);
+      REQUIRE(read[i].epsilon_v == particles[i].epsilon_v);
+      REQUIRE(read[i].cell_id == particles[i].cell_id);
+      REQUIRE(read[i].status == particles[i].status);
+      REQUIRE(read[i].material_id == particles[i].material_id);
+      REQUIRE(read[i].nstate_vars == particles[i].nstate_vars);
+      REQUIRE(read[i].svars[0] == particles[i].svars[0]);
+      REQUIRE(read[i].svars[19] == particles[i].svars[19]);
+    }
+  };
+
+  SECTION("Check layouts") {
+    REQUIRE(mpm::hdf5::layout("table") == mpm::hdf5::Layout::Table);
+    REQUIRE(mpm::hdf5::layout("columns") == mpm::hdf5::Layout::Columns);
+    REQUIRE_THROWS(mpm::hdf5::layout("rows"));
+  }
+
+  SECTION("Check table layout") {
+    const std::string filename = "hdf5-table.h5";
+    mpm::hdf5::write_particles(filename, particles, mpm::hdf5::Layout::Table,
+                               false);
+    check(mpm::hdf5::read_particles(filename));
+
+    // Shared file of a single rank
+    mpm::hdf5::write_particles(filename, particles, mpm::hdf5::Layout::Table,
+                               true);
+    check(mpm::hdf5::read_particles(filename));
+  }
+
+  SECTION("Check columns layout") {
+    const std::string filename = "hdf5-columns.h5";
+    mpm::hdf5::write_particles(filename, particles,
+                               mpm::hdf5::Layout::Columns, true);
+    check(mpm::hdf5::read_particles(filename));
+
+    // No particles
+    mpm::hdf5::write_particles(filename, std::vector<mpm::HDF5Particle>(),
+                               mpm::hdf5::Layout::Columns, true);
+    REQUIRE(mpm::hdf5::read_particles(filename).empty());
+  }
+
+  SECTION("Check checkpoint") {
+    const std::string filename = "hdf5-checkpoint.h5";
+    std::vector<Eigen::Matrix<double, 3, 1>> xi(particles.size());
+    for (unsigned i = 0; i < xi.size(); ++i) xi[i] << -0.5 * i, 0.25, 0.;
+    std::vector<Eigen::Matrix<double, 3, 3>> deformation_gradients(
+        particles.size(), Eigen::Matrix<double, 3, 3>::Identity());
+    for (unsigned i = 0; i < xi.size(); ++i) {
+      deformation_gradients[i](0, 0) = 1. + 0.1 * i;
+      deformation_gradients[i](0, 1) = -0.2 * i;
+      deformation_gradients[i](1, 0) = 0.05;
+    }
+
+    // Compressed and uncompressed checkpoints
+    for (const unsigned compression : {0, 1, 9}) {
+      mpm::hdf5::write_checkpoint(filename, particles, xi,
+                                  deformation_gradients, compression);
+      std::vector<Eigen::Matrix<double, 3, 1>> read_xi;
+      std::vector<Eigen::Matrix<double, 3, 3>> read_deformation_gradients;
+      check(mpm::hdf5::read_checkpoint(filename, &read_xi,
+                                       &read_deformation_gradients));
+      REQUIRE(read_xi.size() == xi.size());
+      REQUIRE(read_deformation_gradients.size() == xi.size());
+      for (unsigned i = 0; i < xi.size(); ++i) {
+        REQUIRE(read_xi[i] == xi[i]);
+        REQUIRE(read_deformation_gradients[i] == deformation_gradients[i]);
+      }
+    }
+
+    // Reference locations and deformation gradients of every particle are
+    // required
+    deformation_gradients.pop_back();
+    REQUIRE_THROWS(mpm::hdf5::write_checkpoint(filename, particles, xi,
+                                               deformation_gradients, 1));
+    xi.pop_back();
+    REQUIRE_THROWS(mpm::hdf5::write_checkpoint(filename, particles, xi,
+                                               deformation_gradients, 1));
+  }
+
+  SECTION("Check missing file") {
+    REQUIRE_THROWS(mpm::hdf5::read_particles("hdf5-missing.h5"));
+  }
+}
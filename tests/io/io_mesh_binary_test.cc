@@ -0,0 +1,184 @@
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "catch.hpp"
+
+#include "factory.h"
+#include "io_mesh_binary.h"
+
+// Check IOMeshBinary
+TEST_CASE("IOMeshBinary is checked for 2D", "[IOMesh][IOMeshBinary][2D]") {
+
+  // Dimension
+  const unsigned dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Nodal coordinates of two cells
+  std::vector<Eigen::Matrix<double, dim, 1>> coordinates;
+  Eigen::Matrix<double, dim, 1> node;
+  node << 0., 0.;
+  coordinates.emplace_back(node);
+  node << 0.5, 0.;
+  coordinates.emplace_back(node);
+  node << 0.5, 0.5;
+  coordinates.emplace_back(node);
+  node << 0., 0.5;
+  coordinates.emplace_back(node);
+  node << 1.0, 0.;
+  coordinates.emplace_back(node);
+  node << 1.0, 0.5;
+  coordinates.emplace_back(node);
+
+  // Cell with node ids
+  std::vector<std::vector<mpm::Index>> cells{{0, 1, 2, 3}, {1, 4, 5, 2}};
+
+  auto io_mesh = std::make_unique<mpm::IOMeshBinary<dim>>();
+
+  // Binary reader is registered in the factory
+  REQUIRE(Factory<mpm::IOMesh<dim>>::instance()->check("Binary2D") == true);
+
+  SECTION("Check mesh file") {
+    REQUIRE(io_mesh->write_mesh("mesh-2d.bin", coordinates, cells) == true);
+
+    // Read nodes
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-missing.bin").size() == 0);
+    const auto check_coords = io_mesh->read_mesh_nodes("mesh-2d.bin");
+    REQUIRE(check_coords.size() == coordinates.size());
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(check_coords[i][j] ==
+                Approx(coordinates[i][j]).epsilon(Tolerance));
+
+    // Read cells
+    REQUIRE(io_mesh->read_mesh_cells("mesh-missing.bin").size() == 0);
+    REQUIRE(io_mesh->read_mesh_cells("mesh-2d.bin") == cells);
+
+    // A mesh file is not a particles file, nor a 3D mesh
+    REQUIRE(io_mesh->read_particles("mesh-2d.bin").size() == 0);
+    auto io_mesh_3d = std::make_unique<mpm::IOMeshBinary<3>>();
+    REQUIRE(io_mesh_3d->read_mesh_nodes("mesh-2d.bin").size() == 0);
+
+    // Truncated file
+    std::ifstream input("mesh-2d.bin", std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(input)),
+                         std::istreambuf_iterator<char>());
+    std::ofstream truncated("mesh-truncated.bin", std::ios::binary);
+    truncated.write(contents.data(), contents.size() - 8);
+    truncated.close();
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-truncated.bin").size() ==
+            coordinates.size());
+    REQUIRE(io_mesh->read_mesh_cells("mesh-truncated.bin").size() == 0);
+
+    // Unsupported version
+    contents[8] = 2;
+    std::ofstream version("mesh-version.bin", std::ios::binary);
+    version.write(contents.data(), contents.size());
+    version.close();
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-version.bin").size() == 0);
+
+    // Numbers of records that overflow or exceed the file
+    contents[8] = 1;
+    for (std::uint64_t nrecords :
+         {std::uint64_t(1) << 63, std::uint64_t(contents.size())}) {
+      std::memcpy(&contents[24], &nrecords, sizeof(nrecords));
+      std::ofstream records("mesh-records.bin", std::ios::binary);
+      records.write(contents.data(), contents.size());
+      records.close();
+      REQUIRE(io_mesh->read_mesh_nodes("mesh-records.bin").size() == 0);
+      REQUIRE(io_mesh->read_mesh_cells("mesh-records.bin").size() == 0);
+    }
+  }
+
+  SECTION("Check particle files") {
+    // Coordinates
+    REQUIRE(io_mesh->write_particles("particles-2d.bin", coordinates) == true);
+    const auto check_coords = io_mesh->read_particles("particles-2d.bin");
+    REQUIRE(check_coords.size() == coordinates.size());
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      REQUIRE((check_coords[i] - coordinates[i]).norm() ==
+              Approx(0.).margin(Tolerance));
+
+    // Stresses
+    std::vector<Eigen::Matrix<double, 6, 1>> stresses(
+        3, Eigen::Matrix<double, 6, 1>::Zero());
+    stresses[1] << -10.5, -2., 3., 0.25, 0., 1.;
+    REQUIRE(io_mesh->write_particles_stresses("stresses-2d.bin", stresses) ==
+            true);
+    const auto check_stresses =
+        io_mesh->read_particles_stresses("stresses-2d.bin");
+    REQUIRE(check_stresses.size() == stresses.size());
+    REQUIRE(check_stresses[1].isApprox(stresses[1]));
+
+    // Volumes
+    std::vector<std::tuple<mpm::Index, double>> volumes{
+        std::make_tuple(0, 1.5), std::make_tuple(7, 0.25)};
+    REQUIRE(io_mesh->write_particles_volumes("volumes-2d.bin", volumes) ==
+            true);
+    REQUIRE(io_mesh->read_particles_volumes("volumes-2d.bin") == volumes);
+
+    // Particle cells
+    std::vector<std::array<mpm::Index, 2>> particles_cells{{0, 1}, {3, 2}};
+    io_mesh->write_particles_cells("particles-cells-2d.bin", particles_cells);
+    REQUIRE(io_mesh->read_particles_cells("particles-cells-2d.bin") ==
+            particles_cells);
+  }
+
+  SECTION("Check constraint files") {
+    // Euler angles
+    std::map<mpm::Index, Eigen::Matrix<double, dim, 1>> euler_angles;
+    euler_angles[3] = Eigen::Matrix<double, dim, 1>(0.5, -0.25);
+    euler_angles[5] = Eigen::Matrix<double, dim, 1>(1.5, 0.);
+    REQUIRE(io_mesh->write_euler_angles("euler-2d.bin", euler_angles) == true);
+    const auto check_angles = io_mesh->read_euler_angles("euler-2d.bin");
+    REQUIRE(check_angles.size() == 2);
+    REQUIRE(check_angles.at(3).isApprox(euler_angles[3]));
+    REQUIRE(check_angles.at(5).isApprox(euler_angles[5]));
+
+    // Velocity constraints and forces
+    std::vector<std::tuple<mpm::Index, unsigned, double>> constraints{
+        std::make_tuple(0, 0, 10.5), std::make_tuple(4, 1, -1.)};
+    REQUIRE(io_mesh->write_velocity_constraints("velocity-2d.bin",
+                                                constraints) == true);
+    REQUIRE(io_mesh->read_velocity_constraints("velocity-2d.bin") ==
+            constraints);
+    REQUIRE(io_mesh->write_forces("forces-2d.bin", constraints) == true);
+    REQUIRE(io_mesh->read_forces("forces-2d.bin") == constraints);
+
+    // Friction constraints
+    std::vector<std::tuple<mpm::Index, unsigned, int, double>> frictions{
+        std::make_tuple(2, 1, -1, 0.3), std::make_tuple(5, 0, 1, 0.5)};
+    REQUIRE(io_mesh->write_friction_constraints("friction-2d.bin",
+                                                frictions) == true);
+    REQUIRE(io_mesh->read_friction_constraints("friction-2d.bin") ==
+            frictions);
+  }
+
+  SECTION("Check conversion of ascii files") {
+    // Ascii mesh with comments
+    std::ofstream file("mesh-ascii-2d.txt");
+    file << "! elementShape quadrilateral\n";
+    file << coordinates.size() << "\t" << cells.size() << "\n";
+    for (const auto& coord : coordinates)
+      file << coord[0] << "\t" << coord[1] << "\n";
+    for (const auto& cell : cells) {
+      for (auto nid : cell) file << nid << "\t";
+      file << "\n";
+    }
+    file.close();
+
+    REQUIRE(io_mesh->convert_ascii(mpm::binary::file_type("mesh"),
+                                   "mesh-ascii-2d.txt",
+                                   "mesh-converted-2d.bin") == true);
+    REQUIRE(io_mesh->read_mesh_nodes("mesh-converted-2d.bin").size() ==
+            coordinates.size());
+    REQUIRE(io_mesh->read_mesh_cells("mesh-converted-2d.bin") == cells);
+
+    // Missing ascii file and invalid type
+    REQUIRE(io_mesh->convert_ascii(mpm::binary::FileType::Mesh,
+                                   "mesh-missing.txt",
+                                   "mesh-missing.bin") == false);
+    REQUIRE_THROWS(mpm::binary::file_type("cells"));
+  }
+}
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "output_pipeline.h"
+
+// Check output pipeline
+TEST_CASE("Output pipeline is checked", "[output][pipeline]") {
+
+  SECTION("Check writes in order") {
+    std::vector<unsigned> written;
+    {
+      mpm::OutputPipeline output(2);
+      REQUIRE(output.nbuffers() == 2);
+      for (unsigned i = 0; i < 10; ++i)
+        output.submit([&written, i]() -> mpm::OutputPipeline::Task {
+          return [&written, i]() { written.emplace_back(i); };
+        });
+      output.flush();
+      REQUIRE(written.size() == 10);
+      for (unsigned i = 0; i < 10; ++i) REQUIRE(written[i] == i);
+    }
+
+    // Queued writes are finished on destruction
+    written.clear();
+    {
+      mpm::OutputPipeline output(4);
+      for (unsigned i = 0; i < 4; ++i)
+        output.submit([&written, i]() -> mpm::OutputPipeline::Task {
+          return [&written, i]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            written.emplace_back(i);
+          };
+        });
+    }
+    REQUIRE(written.size() == 4);
+  }
+
+  SECTION("Check bounded snapshots") {
+    mpm::OutputPipeline output(2);
+    std::atomic<unsigned> nsnapshots{0};
+    std::atomic<unsigned> max_snapshots{0};
+    for (unsigned i = 0; i < 8; ++i)
+      output.submit([&]() -> mpm::OutputPipeline::Task {
+        // Snapshot staged while the writer is behind
+        const unsigned n = ++nsnapshots;
+        if (n > max_snapshots) max_snapshots = n;
+        return [&]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          --nsnapshots;
+        };
+      });
+    output.flush();
+    REQUIRE(nsnapshots == 0);
+    REQUIRE(max_snapshots <= 2);
+    // Staging waited for the slow writer
+    REQUIRE(output.nstalls() > 0);
+  }
+
+  SECTION("Check synchronous writes and errors") {
+    mpm::OutputPipeline output(0);
+    unsigned nwritten = 0;
+    output.submit([&]() -> mpm::OutputPipeline::Task {
+      return [&]() { ++nwritten; };
+    });
+    REQUIRE(nwritten == 1);
+
+    // Errors of staging and writing are logged and do not stop the pipeline
+    output.submit([&]() -> mpm::OutputPipeline::Task {
+      throw std::runtime_error("Snapshot failed");
+    });
+    mpm::OutputPipeline async_output(1);
+    async_output.submit([&]() -> mpm::OutputPipeline::Task {
+      return []() { throw std::runtime_error("Write failed"); };
+    });
+    async_output.submit([&]() -> mpm::OutputPipeline::Task {
+      return [&]() { ++nwritten; };
+    });
+    async_output.flush();
+    REQUIRE(nwritten == 2);
+  }
+}
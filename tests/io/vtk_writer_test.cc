@@ -39,6 +39,24 @@ TEST_CASE("VTK Writer is checked", "[vtk][writer]") {
       REQUIRE_NOTHROW(
           vtk_writer->write_tensor_point_data(vtk_file, data, attribute));
     }
+
+    SECTION("Write all point data") {
+      std::vector<std::pair<std::string, std::vector<double>>> scalars;
+      scalars.emplace_back("mass", std::vector<double>());
+      scalars.emplace_back("volume", std::vector<double>());
+      std::vector<std::pair<std::string, std::vector<Eigen::Vector3d>>>
+          vectors;
+      vectors.emplace_back("velocities", std::vector<Eigen::Vector3d>());
+      std::vector<
+          std::pair<std::string, std::vector<Eigen::Matrix<double, 6, 1>>>>
+          tensors;
+      tensors.emplace_back("stresses",
+                           std::vector<Eigen::Matrix<double, 6, 1>>());
+
+      for (const std::string compressor : {"none", "zlib", "lz4"})
+        REQUIRE_NOTHROW(vtk_writer->write_point_data(
+            "point_data_vtk.vtp", scalars, vectors, tensors, compressor));
+    }
   }
 
   SECTION("Check parallel vtk vector file ") {
@@ -134,5 +152,51 @@ TEST_CASE("VTK Writer is checked", "[vtk][writer]") {
     REQUIRE(content.length() == ppolydata.length());
     REQUIRE(content == ppolydata);
   }
+
+  SECTION("Check parallel vtk file of many fields") {
+    std::vector<Eigen::Matrix<double, 3, 1>> coordinates;
+    // VTK PolyData writer
+    auto vtk_writer = std::make_unique<VtkWriter>(coordinates);
+
+    const std::string parallel_vtk_file = "parallel_fields_vtk.pvtp";
+    const std::string attribute = "particles";
+    int mpi_size = 2;
+    unsigned step = 1000;
+    unsigned max_steps = 10000;
+    vtk_writer->write_parallel_vtk(
+        parallel_vtk_file, attribute,
+        {{"mass", 1}, {"velocities", 3}, {"volume", 1}, {"stresses", 9}},
+        mpi_size, step, max_steps);
+
+    // Check file data
+    std::string ppolydata =
+        "<?xml version=\"1.0\"?>\n<VTKFile type=\"PPolyData\" version=\"0.1\" "
+        "byte_order=\"LittleEndian\" "
+        "compressor=\"vtkZLibDataCompressor\">\n<PPolyData "
+        "GhostLevel=\"0\">\n\t<PPointData Scalars=\"mass\" "
+        "Vectors=\"velocities\" Tensors=\"stresses\">"
+        "\n\t\t<PDataArray type=\"Float64\" Name=\"mass\"/>"
+        "\n\t\t<PDataArray type=\"Float64\" Name=\"velocities\" "
+        "NumberOfComponents=\"3\"/>"
+        "\n\t\t<PDataArray type=\"Float64\" Name=\"volume\"/>"
+        "\n\t\t<PDataArray type=\"Float64\" Name=\"stresses\" "
+        "NumberOfComponents=\"9\"/>\n\t</"
+        "PPointData>\n\n\t<PPoints>\n\t\t<PDataArray "
+        "type=\"Float32\" Name=\"Points\" "
+        "NumberOfComponents=\"3\"/>\n\t</PPoints>\n";
+
+    for (unsigned i = 0; i < mpi_size; ++i)
+      ppolydata += "\n\t<Piece Source=\"particles-" + std::to_string(i) + "_" +
+                   std::to_string(mpi_size) + "-01000.vtp\"/>";
+
+    ppolydata += "\n</PPolyData>\n\n</VTKFile>";
+
+    std::ifstream ifs(parallel_vtk_file);
+    std::string content((std::istreambuf_iterator<char>(ifs)),
+                        (std::istreambuf_iterator<char>()));
+
+    // Check file content
+    REQUIRE(content == ppolydata);
+  }
 }
 #endif
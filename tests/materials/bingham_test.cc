@@ -5,6 +5,7 @@
 #include "catch.hpp"
 #include "json.hpp"
 
+#include "bingham.h"
 #include "element.h"
 #include "factory.h"
 #include "hexahedron_element.h"
@@ -359,6 +360,35 @@ TEST_CASE("Bingham is checked in 2D", "[material][bingham][2D]") {
             Approx(volumetric_strain).epsilon(Tolerance));
     REQUIRE(state_vars.at("pressure") ==
             Approx(-K * volumetric_strain).epsilon(Tolerance));
+
+    // Check the particle-independent fluid kernel
+    auto bingham = std::dynamic_pointer_cast<mpm::Bingham<Dim>>(material);
+    REQUIRE(bingham != nullptr);
+    double pressure = 0.;
+    auto fluid_stress = bingham->compute_fluid_stress(
+        particle->strain_rate(), particle->dvolumetric_strain(), &pressure);
+    REQUIRE(pressure == Approx(state_vars.at("pressure")).epsilon(Tolerance));
+    for (unsigned i = 0; i < 6; ++i)
+      REQUIRE(fluid_stress(i) == Approx(check_stress(i)).epsilon(Tolerance));
+
+    // Check the batch of stress updates of two particles
+    std::vector<mpm::dense_map> batch_state_vars(
+        2, material->initialise_state_variables());
+    std::vector<mpm::Material<Dim>::Vector6d> batch_stresses(2, stress);
+    std::vector<mpm::Material<Dim>::StressPoint> points;
+    for (unsigned i = 0; i < 2; ++i)
+      points.emplace_back(mpm::Material<Dim>::StressPoint{
+          material.get(), &batch_stresses[i], &dstrain,
+          &particle->strain_rate(), particle->dvolumetric_strain(),
+          &batch_state_vars[i], particle.get()});
+    material->compute_stresses(points.data(), points.size());
+    for (unsigned i = 0; i < 2; ++i) {
+      REQUIRE(batch_state_vars[i].at("pressure") ==
+              Approx(state_vars.at("pressure")).epsilon(Tolerance));
+      for (unsigned j = 0; j < 6; ++j)
+        REQUIRE(batch_stresses[i](j) ==
+                Approx(check_stress(j)).epsilon(Tolerance));
+    }
   }
 
   SECTION("Bingham check stresses incompressible, with strain rate, yielded") {
@@ -252,6 +252,22 @@ TEST_CASE("materials utility is checked", "[materials]") {
     REQUIRE(dtheta_dsigma_tolerance(5) ==
             Approx(0.00189011673149042).epsilon(Tolerance));
 
+    // Check derivatives from known invariants
+    const Eigen::Matrix<double, 6, 1> dq_dsigma_invariants =
+        mpm::materials::dq_dsigma(deviatoric_stress, std::sqrt(3. * j2));
+    const Eigen::Matrix<double, 6, 1> dj3_dsigma_invariants =
+        mpm::materials::dj3_dsigma(deviatoric_stress, j2);
+    const Eigen::Matrix<double, 6, 1> dtheta_dsigma_invariants =
+        mpm::materials::dtheta_dsigma(deviatoric_stress, j2, j3, Tolerance);
+    for (unsigned i = 0; i < 6; ++i) {
+      REQUIRE(dq_dsigma_invariants(i) ==
+              Approx(dq_dsigma(i)).epsilon(Tolerance));
+      REQUIRE(dj3_dsigma_invariants(i) ==
+              Approx(dj3_dsigma(i)).epsilon(Tolerance));
+      REQUIRE(dtheta_dsigma_invariants(i) ==
+              Approx(dtheta_dsigma_tolerance(i)).epsilon(Tolerance));
+    }
+
     // Initialise strain
     Eigen::Matrix<double, 6, 1> strain;
     strain(0) = 0.001;
@@ -10,6 +10,7 @@
 #include "hexahedron_element.h"
 #include "material.h"
 #include "mesh.h"
+#include "newtonian.h"
 #include "node.h"
 
 //! \brief Check Newtonian class
@@ -436,6 +437,35 @@ TEST_CASE("Newtonian is checked in 3D", "[material][newtonian][3D]") {
             Approx(volumetric_strain).epsilon(Tolerance));
     REQUIRE(state_vars.at("pressure") ==
             Approx(-K * volumetric_strain).epsilon(Tolerance));
+
+    // Check the particle-independent fluid kernel
+    auto newtonian = std::dynamic_pointer_cast<mpm::Newtonian<Dim>>(material);
+    REQUIRE(newtonian != nullptr);
+    double pressure = 0.;
+    auto fluid_stress = newtonian->compute_fluid_stress(
+        particle->strain_rate(), particle->dvolumetric_strain(), &pressure);
+    REQUIRE(pressure == Approx(state_vars.at("pressure")).epsilon(Tolerance));
+    for (unsigned i = 0; i < 6; ++i)
+      REQUIRE(fluid_stress(i) == Approx(check_stress(i)).epsilon(Tolerance));
+
+    // Check the batch of stress updates of two particles
+    std::vector<mpm::dense_map> batch_state_vars(
+        2, material->initialise_state_variables());
+    std::vector<mpm::Material<Dim>::Vector6d> batch_stresses(2, stress);
+    std::vector<mpm::Material<Dim>::StressPoint> points;
+    for (unsigned i = 0; i < 2; ++i)
+      points.emplace_back(mpm::Material<Dim>::StressPoint{
+          material.get(), &batch_stresses[i], &dstrain,
+          &particle->strain_rate(), particle->dvolumetric_strain(),
+          &batch_state_vars[i], particle.get()});
+    material->compute_stresses(points.data(), points.size());
+    for (unsigned i = 0; i < 2; ++i) {
+      REQUIRE(batch_state_vars[i].at("pressure") ==
+              Approx(state_vars.at("pressure")).epsilon(Tolerance));
+      for (unsigned j = 0; j < 6; ++j)
+        REQUIRE(batch_stresses[i](j) ==
+                Approx(check_stress(j)).epsilon(Tolerance));
+    }
   }
 
   SECTION("Newtonian check stresses incompressible") {
@@ -253,6 +253,12 @@ TEST_CASE("Mesh cell neighbours 2D", "[MeshCell][2D][mpi]") {
       REQUIRE(cell0->nneighbours() == 1);
       for (auto n : cell0->neighbours()) REQUIRE(n == 1);
 
+      // Neighbours are kept in ascending order
+      REQUIRE(cell0->add_neighbour(3) == true);
+      REQUIRE(cell0->add_neighbour(2) == true);
+      REQUIRE(cell0->add_neighbour(3) == false);
+      REQUIRE(cell0->neighbours() == std::vector<mpm::Index>({1, 2, 3}));
+
       // Add neighbours to cell 1
       REQUIRE(cell1->nneighbours() == 0);
       REQUIRE(cell1->add_neighbour(0) == true);
@@ -275,15 +281,15 @@ TEST_CASE("Mesh cell neighbours 2D", "[MeshCell][2D][mpi]") {
       REQUIRE(cell8->nneighbours() == 3);
 
       // Check solutions
-      std::set<mpm::Index> n0 = {1, 2, 3};
-      std::set<mpm::Index> n1 = {0, 2, 3, 4, 5};
-      std::set<mpm::Index> n2 = {0, 1, 3, 4, 5, 6, 7, 8};
-      std::set<mpm::Index> n3 = {0, 1, 2, 7, 8};
-      std::set<mpm::Index> n4 = {1, 2, 5};
-      std::set<mpm::Index> n5 = {1, 2, 4, 6, 7};
-      std::set<mpm::Index> n6 = {2, 5, 7};
-      std::set<mpm::Index> n7 = {2, 3, 5, 6, 8};
-      std::set<mpm::Index> n8 = {2, 3, 7};
+      std::vector<mpm::Index> n0 = {1, 2, 3};
+      std::vector<mpm::Index> n1 = {0, 2, 3, 4, 5};
+      std::vector<mpm::Index> n2 = {0, 1, 3, 4, 5, 6, 7, 8};
+      std::vector<mpm::Index> n3 = {0, 1, 2, 7, 8};
+      std::vector<mpm::Index> n4 = {1, 2, 5};
+      std::vector<mpm::Index> n5 = {1, 2, 4, 6, 7};
+      std::vector<mpm::Index> n6 = {2, 5, 7};
+      std::vector<mpm::Index> n7 = {2, 3, 5, 6, 8};
+      std::vector<mpm::Index> n8 = {2, 3, 7};
 
       REQUIRE(cell0->neighbours() == n0);
       REQUIRE(cell1->neighbours() == n1);
@@ -958,15 +964,15 @@ TEST_CASE("Mesh cell neighbours 3D", "[MeshCell][3D][mpi]") {
       REQUIRE(cell8->nneighbours() == 3);
 
       // Check solutions
-      std::set<mpm::Index> n0 = {1, 2, 3};
-      std::set<mpm::Index> n1 = {0, 2, 3, 4, 5};
-      std::set<mpm::Index> n2 = {0, 1, 3, 4, 5, 6, 7, 8};
-      std::set<mpm::Index> n3 = {0, 1, 2, 7, 8};
-      std::set<mpm::Index> n4 = {1, 2, 5};
-      std::set<mpm::Index> n5 = {1, 2, 4, 6, 7};
-      std::set<mpm::Index> n6 = {2, 5, 7};
-      std::set<mpm::Index> n7 = {2, 3, 5, 6, 8};
-      std::set<mpm::Index> n8 = {2, 3, 7};
+      std::vector<mpm::Index> n0 = {1, 2, 3};
+      std::vector<mpm::Index> n1 = {0, 2, 3, 4, 5};
+      std::vector<mpm::Index> n2 = {0, 1, 3, 4, 5, 6, 7, 8};
+      std::vector<mpm::Index> n3 = {0, 1, 2, 7, 8};
+      std::vector<mpm::Index> n4 = {1, 2, 5};
+      std::vector<mpm::Index> n5 = {1, 2, 4, 6, 7};
+      std::vector<mpm::Index> n6 = {2, 5, 7};
+      std::vector<mpm::Index> n7 = {2, 3, 5, 6, 8};
+      std::vector<mpm::Index> n8 = {2, 3, 7};
 
       REQUIRE(cell0->neighbours() == n0);
       REQUIRE(cell1->neighbours() == n1);
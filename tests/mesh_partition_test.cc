@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <memory>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "element.h"
+#include "factory.h"
+#include "mesh.h"
+#include "mesh_partition.h"
+
+//! Check partitioned loading of a 2D mesh
+TEST_CASE("Mesh partition is checked for 2D case", "[mesh][partition][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+
+  // Structured mesh of 4 x 4 unit cells, numbered row by row
+  const unsigned ncells_dir = 4;
+  std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+  for (unsigned j = 0; j <= ncells_dir; ++j)
+    for (unsigned i = 0; i <= ncells_dir; ++i)
+      coordinates.emplace_back(Eigen::Matrix<double, Dim, 1>(i, j));
+  std::vector<std::vector<mpm::Index>> cells;
+  for (unsigned j = 0; j < ncells_dir; ++j)
+    for (unsigned i = 0; i < ncells_dir; ++i) {
+      const mpm::Index n0 = j * (ncells_dir + 1) + i;
+      cells.emplace_back(std::vector<mpm::Index>(
+          {n0, n0 + 1, n0 + ncells_dir + 2, n0 + ncells_dir + 1}));
+    }
+
+  SECTION("Check partition of cells") {
+    // Single part
+    auto partition = mpm::partition_cells<Dim>(coordinates, cells, 1);
+    REQUIRE(partition == std::vector<unsigned>(cells.size(), 0));
+
+    // Four parts are blocks of 2 x 2 cells
+    partition = mpm::partition_cells<Dim>(coordinates, cells, 4);
+    for (unsigned part = 0; part < 4; ++part)
+      REQUIRE(std::count(partition.begin(), partition.end(), part) == 4);
+    for (unsigned j = 0; j < ncells_dir; j += 2)
+      for (unsigned i = 0; i < ncells_dir; i += 2) {
+        const unsigned cid = j * ncells_dir + i;
+        REQUIRE(partition[cid + 1] == partition[cid]);
+        REQUIRE(partition[cid + ncells_dir] == partition[cid]);
+        REQUIRE(partition[cid + ncells_dir + 1] == partition[cid]);
+      }
+
+    // Uneven parts
+    partition = mpm::partition_cells<Dim>(coordinates, cells, 3);
+    REQUIRE(std::count(partition.begin(), partition.end(), 0) == 5);
+    REQUIRE(std::count(partition.begin(), partition.end(), 1) == 5);
+    REQUIRE(std::count(partition.begin(), partition.end(), 2) == 6);
+  }
+
+  SECTION("Check bins of boxes") {
+    // Boxes of cells from their nodes
+    std::vector<Eigen::Matrix<double, Dim, 1>> lower, upper;
+    for (const auto& cell : cells) {
+      lower.emplace_back(coordinates[cell[0]]);
+      upper.emplace_back(coordinates[cell[2]]);
+    }
+    mpm::BoxBins<Dim> bins(lower, upper);
+    REQUIRE(bins.contains(Eigen::Matrix<double, Dim, 1>(4.5, 1.)) == false);
+    REQUIRE(bins.contains(Eigen::Matrix<double, Dim, 1>(-0.5, 1.)) == false);
+
+    // Boxes of a bin hold those of the point in ascending order
+    for (const auto& point : {Eigen::Matrix<double, Dim, 1>(1.0, 1.0),
+                              Eigen::Matrix<double, Dim, 1>(3.5, 0.5),
+                              Eigen::Matrix<double, Dim, 1>(4.0, 4.0)}) {
+      REQUIRE(bins.contains(point) == true);
+      const auto boxes = bins.boxes(point);
+      REQUIRE(std::is_sorted(boxes.first, boxes.second) == true);
+      std::vector<mpm::Index> holding;
+      for (auto box = boxes.first; box != boxes.second; ++box)
+        if ((point.array() >= lower[*box].array()).all() &&
+            (point.array() <= upper[*box].array()).all())
+          holding.emplace_back(*box);
+      REQUIRE(holding.empty() == false);
+      // Lowest box of the point
+      for (mpm::Index box = 0; box < holding.front(); ++box)
+        REQUIRE(((point.array() >= lower[box].array()).all() &&
+                 (point.array() <= upper[box].array()).all()) == false);
+    }
+    // Corner of four cells
+    const auto corner = bins.boxes(Eigen::Matrix<double, Dim, 1>(1.0, 1.0));
+    for (mpm::Index box : {0, 1, 4, 5})
+      REQUIRE(std::find(corner.first, corner.second, box) != corner.second);
+
+    // No boxes
+    mpm::BoxBins<Dim> empty({}, {});
+    REQUIRE(empty.contains(Eigen::Matrix<double, Dim, 1>(0., 0.)) == false);
+  }
+
+  SECTION("Check partitioned mesh") {
+    // Rank 0 has the left half of the mesh, rank 1 the right half
+    std::vector<unsigned> partition(cells.size(), 0);
+    for (unsigned cid = 0; cid < cells.size(); ++cid)
+      if (cid % ncells_dir >= 2) partition[cid] = 1;
+
+    auto element = Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    REQUIRE(mesh->is_partitioned() == false);
+    REQUIRE(mesh->create_partitioned_mesh("N2D", coordinates, element, cells,
+                                          std::vector<unsigned>(2, 0)) ==
+            false);
+    REQUIRE(mesh->create_partitioned_mesh("N2D", coordinates, element, cells,
+                                          partition) == true);
+    REQUIRE(mesh->is_partitioned() == true);
+
+    // Cells of rank 0 and a ghost layer of rank 1, with their nodes
+    REQUIRE(mesh->ncells() == 12);
+    REQUIRE(mesh->nnodes() == 20);
+    unsigned nghost = 0;
+    mesh->iterate_over_cells([&](std::shared_ptr<mpm::Cell<Dim>> cell) {
+      REQUIRE(cell->rank() == partition[cell->id()]);
+      REQUIRE(cell->id() % ncells_dir <= 2);
+      if (cell->rank() == 1) ++nghost;
+    });
+    REQUIRE(nghost == 4);
+
+    // Ids of nodes on rank 1 are skipped
+    REQUIRE(mesh->is_nonlocal_node(0) == false);
+    REQUIRE(mesh->is_nonlocal_node(4) == true);
+    tsl::robin_map<mpm::Index, std::vector<mpm::Index>> node_sets;
+    node_sets[0] = std::vector<mpm::Index>({0, 3, 4, 9});
+    REQUIRE(mesh->create_node_sets(node_sets, true) == true);
+    REQUIRE(mesh->nodes(0).size() == 2);
+
+    // Particles in the cells of rank 0 are created, with their position in
+    // the list as id
+    std::vector<Eigen::Matrix<double, Dim, 1>> points;
+    points.emplace_back(Eigen::Matrix<double, Dim, 1>(0.5, 0.5));
+    points.emplace_back(Eigen::Matrix<double, Dim, 1>(2.5, 0.5));
+    points.emplace_back(Eigen::Matrix<double, Dim, 1>(3.5, 3.5));
+    points.emplace_back(Eigen::Matrix<double, Dim, 1>(2.0, 1.5));
+    REQUIRE(mesh->create_particles("P2D", points, {}, 0, false) == true);
+    REQUIRE(mesh->nparticles() == 2);
+    std::vector<mpm::Index> pids;
+    mesh->iterate_over_particles(
+        [&](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+#pragma omp critical
+          pids.emplace_back(particle->id());
+        });
+    std::sort(pids.begin(), pids.end());
+    REQUIRE(pids == std::vector<mpm::Index>({0, 3}));
+  }
+
+  SECTION("Check partitioned mesh of B-spline cells") {
+    // 8 x 2 unit cells with a layer of padding nodes around them
+    const unsigned ncells_x = 8, ncells_y = 2;
+    const unsigned nnodes_x = ncells_x + 3;
+    auto node_id = [&](int i, int j) -> mpm::Index {
+      return (j + 1) * nnodes_x + (i + 1);
+    };
+    std::vector<Eigen::Matrix<double, Dim, 1>> padded_coordinates;
+    for (int j = -1; j <= static_cast<int>(ncells_y) + 1; ++j)
+      for (int i = -1; i <= static_cast<int>(ncells_x) + 1; ++i)
+        padded_coordinates.emplace_back(Eigen::Matrix<double, Dim, 1>(i, j));
+    std::vector<std::vector<mpm::Index>> padded_cells;
+    // Rank 0 has the left half of the mesh, rank 1 the right half
+    std::vector<unsigned> partition;
+    for (unsigned j = 0; j < ncells_y; ++j)
+      for (unsigned i = 0; i < ncells_x; ++i) {
+        padded_cells.emplace_back(std::vector<mpm::Index>(
+            {node_id(i, j), node_id(i + 1, j), node_id(i + 1, j + 1),
+             node_id(i, j + 1)}));
+        partition.emplace_back(i < ncells_x / 2 ? 0 : 1);
+      }
+
+    auto element = Factory<mpm::Element<Dim>>::instance()->create("ED2Q16B2");
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    REQUIRE(mesh->create_partitioned_mesh("N2D", padded_coordinates, element,
+                                          padded_cells, partition) == true);
+
+    // Cells of rank 0 and two layers of ghost cells keep their ids
+    REQUIRE(mesh->ncells() == 12);
+    mesh->iterate_over_cells([&](std::shared_ptr<mpm::Cell<Dim>> cell) {
+      REQUIRE(cell->id() % ncells_x <= 5);
+      REQUIRE(cell->nnodes() == 16);
+      REQUIRE(cell->rank() == partition[cell->id()]);
+    });
+
+    // Nodes of the stencils of these cells, and the padding nodes
+    REQUIRE(mesh->nnodes() == 52);
+    REQUIRE(mesh->is_nonlocal_node(node_id(7, 1)) == false);
+    REQUIRE(mesh->is_nonlocal_node(node_id(8, 1)) == true);
+    REQUIRE(mesh->is_nonlocal_node(node_id(9, 1)) == false);
+  }
+}
@@ -549,6 +549,12 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
       REQUIRE(mesh->generate_material_points(2, particle_type, mids, -1, 0) ==
               true);
       REQUIRE(mesh->nparticles() == 4);
+      // Particles are located in the cell at the Gauss points
+      REQUIRE(cell1->nparticles() == 4);
+      for (const auto& point : mesh->particle_coordinates())
+        for (unsigned i = 0; i < Dim; ++i)
+          REQUIRE(std::fabs(point(i) - 1.) ==
+                  Approx(1. / std::sqrt(3.)).epsilon(Tolerance));
     }
 
     SECTION("Check generating 3 particle / cell") {
@@ -879,6 +885,54 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
             REQUIRE(mesh->particles_statevars_data(attribute).size() ==
                     mesh->nparticles());
 
+            // Particle fields written to buffers
+            const unsigned nparts = mesh->nparticles();
+            std::vector<double> masses(nparts);
+            mesh->particles_field_data("mass", 1, masses.data());
+            REQUIRE(masses == mesh->particles_scalar_data("mass"));
+            // Vectors are padded with zeros
+            std::vector<double> velocities(3 * nparts, -1.);
+            mesh->particles_field_data("velocities", 3, velocities.data());
+            for (unsigned i = 0; i < nparts; ++i)
+              REQUIRE(velocities[3 * i + 2] == Approx(0.).epsilon(Tolerance));
+            for (const auto& pcoordinate : mesh->particle_coordinates())
+              REQUIRE(pcoordinate(2) == Approx(0.).epsilon(Tolerance));
+            // Properties of particles which are not found are NaN
+            std::vector<double> invalid(2 * nparts);
+            mesh->particles_field_data("invalid", 2, invalid.data());
+            for (const auto value : invalid) REQUIRE(std::isnan(value));
+
+            // Sample of particles by stride of ids and box
+            const Eigen::Vector2d lowest = Eigen::Vector2d::Constant(
+                std::numeric_limits<double>::lowest());
+            const Eigen::Vector2d highest = Eigen::Vector2d::Constant(
+                std::numeric_limits<double>::max());
+            REQUIRE(mesh->particles_sample(1, lowest, highest).size() ==
+                    nparts);
+            const auto sample = mesh->particles_sample(2, lowest, highest);
+            REQUIRE(sample.size() == nparts / 2);
+            const auto sampled_coordinates =
+                mesh->particle_coordinates(&sample);
+            const auto sampled_hdf5 = mesh->particles_hdf5(&sample);
+            REQUIRE(sampled_coordinates.size() == sample.size());
+            for (unsigned i = 0; i < sample.size(); ++i) {
+              REQUIRE(sampled_hdf5[i].id % 2 == 0);
+              REQUIRE(sampled_coordinates[i](0) ==
+                      Approx(sampled_hdf5[i].coord_x).epsilon(Tolerance));
+            }
+            // Particles of cell 1 are sampled by a box
+            Eigen::Vector2d min, max;
+            min << 0.5, 0.;
+            max << 1.0, 0.5;
+            const auto box_sample = mesh->particles_sample(1, min, max);
+            REQUIRE(box_sample.size() == 4);
+            for (const auto& stress :
+                 mesh->template particles_tensor_data<6>("stresses",
+                                                         &box_sample))
+              REQUIRE(stress.norm() == Approx(0.).epsilon(Tolerance));
+            REQUIRE(mesh->particles_scalar_data("mass", &box_sample).size() ==
+                    4);
+
             // Locate particles in mesh
             SECTION("Locate particles in mesh") {
               // Locate particles in a mesh
@@ -911,6 +965,48 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
               auto phdf5 = mesh->particles_hdf5();
               REQUIRE(phdf5.size() == mesh->nparticles());
 
+              // Checkpoint restores particles in their cells, with the
+              // deformation of their domains
+              const auto xi = mesh->particles_reference_locations();
+              REQUIRE(xi.size() == mesh->nparticles());
+              Eigen::Matrix2d deformation_gradient;
+              deformation_gradient << 1.25, 0.1, -0.2, 0.8;
+              mesh->iterate_over_particles(
+                  [&](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+                    particle->assign_deformation_gradient(
+                        deformation_gradient);
+                  });
+              REQUIRE(mesh->write_checkpoint_hdf5("checkpoint-2d.h5", 1) ==
+                      true);
+              std::vector<mpm::Index> pids;
+              for (const auto& pparticle : phdf5)
+                pids.emplace_back(pparticle.id);
+              mesh->remove_particles(pids);
+              REQUIRE(mesh->nparticles() == 0);
+
+              REQUIRE(mesh->read_checkpoint_hdf5(0, "checkpoint-2d.h5") ==
+                      true);
+              REQUIRE(mesh->nparticles() == phdf5.size());
+              const auto read_xi = mesh->particles_reference_locations();
+              const auto read_phdf5 = mesh->particles_hdf5();
+              const auto read_deformation_gradients =
+                  mesh->particles_deformation_gradients();
+              for (unsigned i = 0; i < phdf5.size(); ++i) {
+                REQUIRE(read_phdf5[i].id == phdf5[i].id);
+                REQUIRE(read_phdf5[i].cell_id == phdf5[i].cell_id);
+                REQUIRE(read_phdf5[i].coord_x ==
+                        Approx(phdf5[i].coord_x).epsilon(Tolerance));
+                for (unsigned j = 0; j < 3; ++j)
+                  REQUIRE(read_xi[i](j) == Approx(xi[i](j)).epsilon(Tolerance));
+                const Eigen::Matrix2d read_deformation_gradient =
+                    read_deformation_gradients[i].topLeftCorner<Dim, Dim>();
+                REQUIRE(read_deformation_gradient.isApprox(
+                    deformation_gradient));
+                REQUIRE(read_deformation_gradients[i](2, 2) == 1.);
+              }
+              REQUIRE_THROWS(
+                  mesh->read_checkpoint_hdf5(0, "checkpoint-missing.h5"));
+
 #ifdef USE_PARTIO
               REQUIRE_NOTHROW(mpm::partio::write_particles(
                   "partio-2d.bgeo", mesh->particles_hdf5()));
@@ -1267,6 +1363,69 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
     }
   }
 
+  //! Check extended connectivity of elements with nodes beyond the cell
+  SECTION("Check extended cell connectivity") {
+    // Create a new mesh
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+
+    // 5 x 5 nodes with a spacing of 0.5, node id = j * 5 + i
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    for (unsigned j = 0; j < 5; ++j)
+      for (unsigned i = 0; i < 5; ++i)
+        coordinates.emplace_back(
+            Eigen::Matrix<double, Dim, 1>(0.5 * i, 0.5 * j));
+    mpm::Index gnid = 0;
+    REQUIRE(mesh->create_nodes(gnid, "N2D", coordinates, false) == true);
+
+    // 2 x 2 linear cells, with the outer nodes as padding nodes
+    std::vector<std::vector<mpm::Index>> cells;
+    for (mpm::Index j = 1; j < 3; ++j)
+      for (mpm::Index i = 1; i < 3; ++i)
+        cells.push_back({j * 5 + i, j * 5 + i + 1, (j + 1) * 5 + i + 1,
+                         (j + 1) * 5 + i});
+
+    for (const std::string type : {"ED2Q16B2", "ED2Q16B3", "ED2Q16G"}) {
+      std::shared_ptr<mpm::Element<Dim>> bspline =
+          Factory<mpm::Element<Dim>>::instance()->create(type);
+
+      // All cells are extended, in their order
+      const auto extended_cells =
+          mesh->extended_cell_connectivity(bspline, cells);
+      REQUIRE(extended_cells.size() == 4);
+
+      // Cell with corners 6, 7, 12, 11
+      const std::vector<mpm::Index> nodes{6, 7,  12, 11, 0,  1,  2, 3,
+                                          8, 13, 18, 17, 16, 15, 10, 5};
+      REQUIRE(extended_cells.at(0) == nodes);
+      REQUIRE(extended_cells.at(3).at(0) == 12);
+      REQUIRE(extended_cells.at(3).at(4) == 6);
+      REQUIRE(extended_cells.at(3).at(10) == 24);
+    }
+
+    std::shared_ptr<mpm::Element<Dim>> bspline =
+        Factory<mpm::Element<Dim>>::instance()->create("ED2Q16B2");
+    mpm::Index gcid = 0;
+    REQUIRE(mesh->create_cells(
+                gcid, bspline,
+                mesh->extended_cell_connectivity(bspline, cells)) == true);
+    REQUIRE(mesh->ncells() == 4);
+
+    // Linear cells are not extended to a linear element
+    REQUIRE(mesh->extended_cell_connectivity(element, cells) == cells);
+
+    // Cells at the boundary without padding nodes are not dropped but fail
+    std::vector<std::vector<mpm::Index>> all_cells;
+    for (mpm::Index j = 0; j < 4; ++j)
+      for (mpm::Index i = 0; i < 4; ++i)
+        all_cells.push_back({j * 5 + i, j * 5 + i + 1, (j + 1) * 5 + i + 1,
+                             (j + 1) * 5 + i});
+    REQUIRE(mesh->extended_cell_connectivity(bspline, all_cells).empty());
+
+    // Cells that do not match the unit cell of the element
+    cells.push_back({0, 1, 6});
+    REQUIRE(mesh->extended_cell_connectivity(bspline, cells).empty());
+  }
+
   //! Check if nodal properties is initialised
   SECTION("Check nodal properties initialisation") {
     // Create the different meshes
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "parallel_sort.h"
+
+//! \brief Check parallel sort
+TEST_CASE("Parallel sort is checked", "[parallel_sort]") {
+#ifdef _OPENMP
+  // Sort and merge in several chunks even on a single core
+  const int nthreads = omp_get_max_threads();
+  omp_set_num_threads(5);
+#endif
+
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<unsigned> distribution(0, 1000);
+
+  SECTION("Sort integers") {
+    for (unsigned size : {0, 1, 17, 1024, 20000}) {
+      std::vector<unsigned> values(size);
+      for (auto& value : values) value = distribution(generator);
+      std::vector<unsigned> sorted = values;
+      std::sort(sorted.begin(), sorted.end());
+
+      mpm::parallel_sort(values.begin(), values.end());
+      REQUIRE(values == sorted);
+    }
+  }
+
+  SECTION("Sort pairs with a comparison function") {
+    std::vector<std::pair<unsigned, unsigned>> values(10000);
+    for (auto& value : values)
+      value = std::make_pair(distribution(generator), distribution(generator));
+    std::vector<std::pair<unsigned, unsigned>> sorted = values;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+
+    mpm::parallel_sort(values.begin(), values.end(), std::greater<>());
+    REQUIRE(values == sorted);
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(nthreads);
+#endif
+}
@@ -205,6 +205,9 @@ TEST_CASE("Particle cell crossing is checked for 2D case",
       std::bind(&mpm::ParticleBase<Dim>::compute_updated_position,
                 std::placeholders::_1, dt, false));
 
+  // Owners of the nodes of cell1 before the particles cross into it
+  const long node4_owners = node4.use_count();
+
   // Locate particles in a mesh
   particles = mesh->locate_particles_mesh();
 
@@ -214,6 +217,9 @@ TEST_CASE("Particle cell crossing is checked for 2D case",
   // Number of particles in each cell
   REQUIRE(cell0->nparticles() == 2);
   REQUIRE(cell1->nparticles() == 2);
+
+  // Particles refer to the nodes of the cell without sharing ownership
+  REQUIRE(node4.use_count() == node4_owners);
 }
 
 //! \brief Check particle cell crossing for 3D case
@@ -11,6 +11,7 @@
 #include "material.h"
 #include "node.h"
 #include "particle.h"
+#include "quadrilateral_cpdi_element.h"
 #include "quadrilateral_element.h"
 
 //! \brief Check particle class for 1D case
@@ -1660,6 +1661,82 @@ TEST_CASE("Particle is checked for 2D case", "[particle][2D]") {
         REQUIRE(*mitr == material_ids.at(i));
     }
   }
+
+  //! Check tracking of the particle domain for CPDI
+  SECTION("Check CPDI particle domain deformation") {
+    std::shared_ptr<mpm::Element<Dim>> element =
+        std::make_shared<mpm::QuadrilateralCPDIElement<Dim, 16>>();
+
+    // Uniform grid with a unit spacing around a cell centred at the origin
+    const Eigen::MatrixXd& natural_nodes = element->natural_nodal_coordinates();
+    auto cell = std::make_shared<mpm::Cell<Dim>>(0, 16, element);
+    std::vector<std::shared_ptr<mpm::NodeBase<Dim>>> nodes;
+    for (unsigned i = 0; i < 16; ++i) {
+      coords = 0.5 * natural_nodes.row(i).transpose();
+      nodes.emplace_back(
+          std::make_shared<mpm::Node<Dim, Dof, Nphases>>(i, coords));
+      REQUIRE(cell->add_node(i, nodes.back()) == true);
+    }
+    REQUIRE(cell->initialise() == true);
+
+    coords << 0.1, -0.2;
+    auto particle = std::make_shared<mpm::Particle<Dim>>(0, coords);
+    REQUIRE(particle->assign_cell(cell) == true);
+    REQUIRE(particle->assign_volume(0.25) == true);
+    REQUIRE(particle->deformation_gradient().isIdentity());
+    REQUIRE_NOTHROW(particle->compute_shapefn());
+
+    // Nodal velocity field v = (0.5 x + 0.2 y, -0.25 y)
+    for (const auto& node : nodes) {
+      const Eigen::Matrix<double, Dim, 1> velocity(
+          0.5 * node->coordinates()(0) + 0.2 * node->coordinates()(1),
+          -0.25 * node->coordinates()(1));
+      node->update_mass(false, phase, 1.);
+      node->update_momentum(false, phase, velocity);
+      node->compute_velocity();
+    }
+
+    // F = I + L dt for a uniform velocity gradient
+    const double dt = 0.1;
+    particle->compute_strain(dt);
+    Eigen::Matrix<double, Dim, Dim> deformation_gradient;
+    // clang-format off
+    deformation_gradient << 1.05, 0.02,
+                            0.,   0.975;
+    // clang-format on
+    REQUIRE(
+        particle->deformation_gradient().isApprox(deformation_gradient));
+
+    // Shape functions of the sheared domain: the cell has a uniform
+    // Jacobian, so the domain in local coordinates is F times the half sizes
+    REQUIRE_NOTHROW(particle->compute_shapefn());
+    const Eigen::Matrix<double, Dim, Dim> domain =
+        deformation_gradient *
+        (0.5 * particle->natural_size()).asDiagonal();
+    Eigen::VectorXd shapefn;
+    Eigen::MatrixXd grad_shapefn;
+    element->domain_shapefn_grad_shapefn(particle->reference_location(),
+                                         domain, &shapefn, &grad_shapefn);
+    REQUIRE(shapefn.sum() == Approx(1.).epsilon(Tolerance));
+
+    // Shear changes the shape functions of the stretched domain
+    const Eigen::Matrix<double, Dim, 1> zero =
+        Eigen::Matrix<double, Dim, 1>::Zero();
+    const Eigen::VectorXd stretched_shapefn = element->shapefn(
+        particle->reference_location(),
+        particle->natural_size().cwiseProduct(
+            deformation_gradient.diagonal()),
+        zero);
+    REQUIRE((shapefn - stretched_shapefn).cwiseAbs().maxCoeff() > 1.E-4);
+
+    // Unit mass mapped to the nodes follows the shape functions
+    for (const auto& node : nodes) node->update_mass(false, phase, 0.);
+    particle->assign_mass(1.);
+    particle->map_mass_momentum_to_nodes();
+    for (unsigned i = 0; i < nodes.size(); ++i)
+      REQUIRE(nodes.at(i)->mass(phase) ==
+              Approx(shapefn(i)).margin(Tolerance));
+  }
 }
 
 //! \brief Check particle class for 3D case
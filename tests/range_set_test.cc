@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "range_set.h"
+
+//! \brief Check range set
+TEST_CASE("Range set is checked", "[range_set]") {
+
+  SECTION("Check empty set") {
+    mpm::RangeSet set;
+    REQUIRE(set.empty() == true);
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.contains(0) == false);
+    REQUIRE(set.ids().empty() == true);
+
+    mpm::RangeSet empty_ids(std::vector<mpm::Index>{});
+    REQUIRE(empty_ids.size() == 0);
+    mpm::RangeSet empty_ranges(std::vector<mpm::RangeSet::Range>{{5, 0}});
+    REQUIRE(empty_ranges.empty() == true);
+  }
+
+  SECTION("Check set of ids") {
+    // Ids with duplicates keep their input order
+    mpm::RangeSet set(std::vector<mpm::Index>{7, 3, 4, 5, 5, 10, 6, 0, 11});
+    REQUIRE(set.size() == 8);
+    REQUIRE(set.ranges().size() == 6);
+    REQUIRE(set.ranges()[1].first == 3);
+    REQUIRE(set.ranges()[1].count == 3);
+
+    const std::vector<mpm::Index> ids{7, 3, 4, 5, 10, 6, 0, 11};
+    REQUIRE(set.ids() == ids);
+    for (std::size_t i = 0; i < ids.size(); ++i) REQUIRE(set[i] == ids[i]);
+    for (mpm::Index id = 0; id < 14; ++id)
+      REQUIRE(set.contains(id) ==
+              (std::find(ids.begin(), ids.end(), id) != ids.end()));
+
+    // Iterate over positions
+    std::vector<mpm::Index> check;
+    set.for_each(2, 7, [&check](mpm::Index id) { check.emplace_back(id); });
+    REQUIRE(check == std::vector<mpm::Index>(ids.begin() + 2, ids.end() - 1));
+  }
+
+  SECTION("Check set of ranges") {
+    // Ids of overlapping ranges are added once, adjacent ranges are merged
+    mpm::RangeSet set(std::vector<mpm::RangeSet::Range>{
+        {100, 10}, {0, 5}, {105, 10}, {5, 2}, {50, 1}, {95, 20}});
+    REQUIRE(set.size() == 28);
+    REQUIRE(set.ranges().size() == 6);
+    REQUIRE(set.ranges()[1].first == 0);
+    REQUIRE(set.ranges()[1].count == 5);
+    REQUIRE(set.ranges()[2].first == 110);
+    REQUIRE(set.ranges()[2].count == 5);
+    REQUIRE(set.ranges()[3].first == 5);
+    REQUIRE(set.ranges()[3].count == 2);
+    REQUIRE(set[6] == 106);
+    REQUIRE(set[10] == 0);
+    REQUIRE(set[15] == 110);
+    REQUIRE(set[20] == 5);
+    REQUIRE(set[22] == 50);
+    REQUIRE(set[23] == 95);
+    REQUIRE(set[27] == 99);
+    REQUIRE(set.contains(114) == true);
+    REQUIRE(set.contains(115) == false);
+    REQUIRE(set.contains(49) == false);
+    REQUIRE(set.contains(97) == true);
+
+    // Ranges that overflow ids
+    REQUIRE_THROWS(mpm::RangeSet(std::vector<mpm::RangeSet::Range>{
+        {std::numeric_limits<mpm::Index>::max(), 2}}));
+  }
+
+  SECTION("Check random ids") {
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<mpm::Index> distribution(0, 5000);
+    std::vector<mpm::Index> ids(2000);
+    for (auto& id : ids) id = distribution(generator);
+    mpm::RangeSet set(ids);
+
+    // First occurrences of ids
+    std::vector<mpm::Index> unique;
+    for (const auto id : ids)
+      if (std::find(unique.begin(), unique.end(), id) == unique.end())
+        unique.emplace_back(id);
+    ids = unique;
+    REQUIRE(set.size() == ids.size());
+    REQUIRE(set.ids() == ids);
+    for (std::size_t i = 0; i < ids.size(); ++i) REQUIRE(set[i] == ids[i]);
+  }
+}
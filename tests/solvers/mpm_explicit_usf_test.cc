@@ -1,3 +1,5 @@
+#include <fstream>
+
 #include "catch.hpp"
 
 //! Alias for JSON
@@ -99,6 +101,25 @@ TEST_CASE("MPM 2D Explicit implementation is checked",
     }
   }
 
+  SECTION("Check resume from an earlier checkpoint") {
+    REQUIRE(mpm_test::write_json(2, true, analysis, mpm_scheme, fname) == true);
+
+    // Checkpoint of the resume step is complete, and then corrupted
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    const auto checkpoint =
+        io->output_file("checkpoint", ".h5", "mpm-explicit-usf-2d", 5, 10);
+    REQUIRE(boost::filesystem::exists(checkpoint) == true);
+    REQUIRE(boost::filesystem::exists(checkpoint.string() + ".tmp") == false);
+    std::ofstream(checkpoint.string()) << "corrupted";
+
+    auto mpm = std::make_unique<mpm::MPMExplicit<Dim>>(std::move(io));
+    REQUIRE_NOTHROW(mpm->initialise_materials());
+    REQUIRE_NOTHROW(mpm->initialise_mesh());
+
+    // Resume from the checkpoint of step 0
+    REQUIRE(mpm->checkpoint_resume() == true);
+  }
+
   SECTION("Check pressure smoothing") {
     // Create an IO object
     auto io = std::make_unique<mpm::IO>(argc, argv);
@@ -252,4 +252,32 @@ TEST_CASE("Stress update is checked for USF and USL",
     REQUIRE_NOTHROW(mpm_scheme->locate_particles(true));
     REQUIRE_NOTHROW(mpm_scheme->locate_particles(false));
   }
+
+  SECTION("Check reuse of shape functions") {
+    auto mpm_scheme = std::make_shared<mpm::MPMSchemeUSL<Dim>>(mesh, 0.01);
+    // Shape functions are recomputed every step by default
+    REQUIRE(mpm_scheme->shapefn_tolerance() == Approx(0.));
+    REQUIRE_NOTHROW(mpm_scheme->initialise());
+    REQUIRE(mpm_scheme->nshapefn() == 0);
+
+    // Particles have not moved since the last evaluation
+    mpm_scheme->assign_shapefn_tolerance(1.E-6);
+    REQUIRE_NOTHROW(mpm_scheme->initialise());
+    REQUIRE(mpm_scheme->nshapefn() == 2);
+    REQUIRE(mpm_scheme->nshapefn_skipped() == 2);
+
+    // Move a particle within the cell
+    Eigen::Matrix<double, Dim, 1> coordinates = particle1->coordinates();
+    coordinates(0) += 0.1;
+    particle1->assign_coordinates(coordinates);
+    REQUIRE(particle1->compute_reference_location() == true);
+    REQUIRE_NOTHROW(mpm_scheme->initialise());
+    REQUIRE(mpm_scheme->nshapefn() == 4);
+    REQUIRE(mpm_scheme->nshapefn_skipped() == 3);
+
+    // Logging resets the statistics
+    REQUIRE_NOTHROW(mpm_scheme->log_shapefn_statistics());
+    REQUIRE(mpm_scheme->nshapefn() == 0);
+    REQUIRE(mpm_scheme->nshapefn_skipped() == 0);
+  }
 }